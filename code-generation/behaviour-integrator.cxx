@@ -1,6 +1,7 @@
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <sstream>
 #include <fstream>
 #include <iostream>
 #include <functional>
@@ -53,6 +54,8 @@ struct BehaviourIntegratorDescription {
   //! \brief
   bool requires_unknown_value_as_external_state_variable = false;
   bool isotropic = true;
+  //! \brief if true, kernels vectorised over the nodes are also generated
+  bool vectorised_kernels = false;
 };  // end of struct BehaviourIntegratorDescription
 
 static bool isTwoDimensionalHypothesis(const std::string& h) {
@@ -228,8 +231,23 @@ void generateUpdateInnerForces(std::ostream& os,
   os << "} // end of updateInnerForces\n\n";
 }  // end of generateUpdateInnerForces
 
+/*!
+ * \brief generate the kernel updating the stiffness matrix
+ * \param[in] os: output stream
+ * \param[in] d: behaviour integrator description
+ * \param[in] symmetric: if true, the tangent operator is assumed symmetric
+ * and only the blocks associated with nodes greater or equal than the
+ * current node are computed. The other blocks must be deduced by symmetry.
+ */
 void generateUpdateStiffnessMatrix(std::ostream& os,
-                                   const BehaviourIntegratorDescription& d) {
+                                   const BehaviourIntegratorDescription& d,
+                                   const bool symmetric) {
+  const auto fname = std::string(symmetric ? "updateSymmetricStiffnessMatrix"
+                                           : "updateStiffnessMatrix");
+  const auto nj0 = std::string(symmetric ? "ni" : "0");
+  if (symmetric && d.requires_unknown_value_as_external_state_variable) {
+    raise("generateUpdateStiffnessMatrix: invalid call");
+  }
   if (d.requires_unknown_value_as_external_state_variable) {
     os << "inline void\n"
        << d.name << "::updateStiffnessMatrix(mfem::DenseMatrix &Ke,\n"
@@ -240,7 +258,7 @@ void generateUpdateStiffnessMatrix(std::ostream& os,
        << "const size_type ni) const noexcept {\n";
   } else {
     os << "inline void\n"
-       << d.name << "::updateStiffnessMatrix(mfem::DenseMatrix &Ke,\n"
+       << d.name << "::" << fname << "(mfem::DenseMatrix &Ke,\n"
        << "const mgis::span<const real> &Kip,\n"
        << "const mfem::DenseMatrix &dN,\n"
        << "const real w,\n"
@@ -250,7 +268,7 @@ void generateUpdateStiffnessMatrix(std::ostream& os,
   const auto [bi, Bi] = d.generator(os, "i", true);
   const auto K = makeMatrixOfSymbols("Kip", Bi.rows(), Bi.rows());
   generateUnknownOffsets(os, "ni", Bi.cols());
-  os << "for (size_type nj = 0; nj != nnodes; ++nj) {\n";
+  os << "for (size_type nj = " << nj0 << "; nj != nnodes; ++nj) {\n";
   const auto [bj, Bj] = d.generator(os, "j", true);
   const auto Ke = transpose(Bi).mul(K).mul(Bj);
   generateUnknownOffsets(os, "nj", Bj.cols());
@@ -282,10 +300,136 @@ void generateUpdateStiffnessMatrix(std::ostream& os,
       }
     }
   }
-  os << "} // end of for (size_type nj = 0; nj != nnodes; ++nj)\n"
-     << "} // end of updateStiffnessMatrix\n\n";
+  os << "} // end of for (size_type nj = " << nj0 << "; nj != nnodes; ++nj)\n"
+     << "} // end of " << fname << "\n\n";
 }  // end of generateUpdateStiffnessMatrix
 
+/*!
+ * \brief generate the kernel updating the gradients with the contributions
+ * of all the nodes. The components of the gradients are accumulated in local
+ * variables so that the loop over the nodes can be vectorised.
+ * \param[in] os: output stream
+ * \param[in] d: behaviour integrator description
+ */
+void generateVectorisedUpdateGradients(
+    std::ostream& os, const BehaviourIntegratorDescription& d) {
+  os << "template <size_type N>\n"
+     << "inline void\n"
+     << d.name << "::updateGradientsVectorised(mgis::span<real> &g,\n"
+     << "const mfem::Vector &u,\n"
+     << "const mfem::DenseMatrix &dN) noexcept {\n"
+     << "const size_type nnodes = (N != 0) ? N : dN.NumRows();\n";
+  // the body of the loop is generated first to get the number of components
+  // of the gradients
+  auto body = std::ostringstream{};
+  const auto [b, Bi] = d.generator(body, "i", true);
+  const auto u = makeVectorOfUnknowns(body, "u", "ni", Bi.cols(), false);
+  const auto g = Bi.mul(u);
+  auto accumulators = std::string{};
+  for (size_type i = 0; i != Bi.rows(); ++i) {
+    const auto gi = "g_" + std::to_string(i);
+    os << "auto " << gi << " = real{0};\n";
+    accumulators += (i == 0) ? gi : ", " + gi;
+    body << gi << " += " << simplify(g(i, 0)) << ";\n";
+  }
+  os << "MFEM_MGIS_SIMD_REDUCTION_LOOP(" << accumulators << ")\n"
+     << "for (size_type ni = 0; ni < nnodes; ++ni) {\n"
+     << body.str()  //
+     << "} // end of for (size_type ni = 0; ni < nnodes; ++ni)\n";
+  for (size_type i = 0; i != Bi.rows(); ++i) {
+    os << "g[" << i << "] += g_" << i << ";\n";
+  }
+  os << "} // end of updateGradientsVectorised\n\n";
+}  // end of generateVectorisedUpdateGradients
+
+/*!
+ * \brief generate the kernel updating the inner forces of all the nodes. The
+ * loop over the nodes is vectorised.
+ * \param[in] os: output stream
+ * \param[in] d: behaviour integrator description
+ */
+void generateVectorisedUpdateInnerForces(
+    std::ostream& os, const BehaviourIntegratorDescription& d) {
+  os << "template <size_type N>\n"
+     << "inline void\n"
+     << d.name << "::updateInnerForcesVectorised(mfem::Vector &Fe,\n"
+     << "const mgis::span<const real> &s,\n"
+     << "const mfem::DenseMatrix &dN,\n"
+     << "const real w) const noexcept {\n"
+     << "const size_type nnodes = (N != 0) ? N : dN.NumRows();\n"
+     << "MFEM_MGIS_SIMD_LOOP\n"
+     << "for (size_type ni = 0; ni < nnodes; ++ni) {\n";
+  const auto [bi, Bi] = d.generator(os, "i", true);
+  const auto S = makeVectorOfSymbols("s", Bi.rows());
+  const auto Fe = transpose(Bi).mul(S);
+  generateUnknownOffsets(os, "ni", Bi.cols());
+  for (size_type i = 0; i != Bi.cols(); ++i) {
+    const auto ni = getUnknownOffset("ni", i, Bi.cols());
+    os << "Fe[" << ni << "] += "
+       << "w * (" << simplify(Fe(i, 0)) << ");\n";
+  }
+  os << "} // end of for (size_type ni = 0; ni < nnodes; ++ni)\n"
+     << "} // end of updateInnerForcesVectorised\n\n";
+}  // end of generateVectorisedUpdateInnerForces
+
+/*!
+ * \brief generate the kernel updating the stiffness matrix with the
+ * contribution of an integration point. The loop over the nodes associated
+ * with the rows of the stiffness matrix is the inner loop and is vectorised:
+ * since `mfem::DenseMatrix` stores its values by columns, this loop
+ * accesses contiguous values of the derivatives of the shape functions and
+ * of the stiffness matrix.
+ * \param[in] os: output stream
+ * \param[in] d: behaviour integrator description
+ * \param[in] symmetric: if true, the tangent operator is assumed symmetric
+ * and only the blocks associated with nodes lower or equal than the
+ * current column node are computed.
+ */
+void generateVectorisedUpdateStiffnessMatrix(
+    std::ostream& os,
+    const BehaviourIntegratorDescription& d,
+    const bool symmetric) {
+  const auto fname =
+      std::string(symmetric ? "updateSymmetricStiffnessMatrixVectorised"
+                            : "updateStiffnessMatrixVectorised");
+  const auto ni1 = std::string(symmetric ? "nj + 1" : "nnodes");
+  if (d.requires_unknown_value_as_external_state_variable) {
+    raise("generateVectorisedUpdateStiffnessMatrix: invalid call");
+  }
+  os << "template <size_type N>\n"
+     << "inline void\n"
+     << d.name << "::" << fname << "(mfem::DenseMatrix &Ke,\n"
+     << "const mgis::span<const real> &Kip,\n"
+     << "const mfem::DenseMatrix &dN,\n"
+     << "const real w) const noexcept {\n"
+     << "const size_type nnodes = (N != 0) ? N : dN.NumRows();\n"
+     << "for (size_type nj = 0; nj != nnodes; ++nj) {\n";
+  // the symbols associated with the row node are created first, as in
+  // generateUpdateStiffnessMatrix, but their definitions are written in the
+  // inner loop
+  auto inner = std::ostringstream{};
+  const auto [bi, Bi] = d.generator(inner, "i", true);
+  const auto K = makeMatrixOfSymbols("Kip", Bi.rows(), Bi.rows());
+  generateUnknownOffsets(inner, "ni", Bi.cols());
+  const auto [bj, Bj] = d.generator(os, "j", true);
+  const auto Ke = transpose(Bi).mul(K).mul(Bj);
+  generateUnknownOffsets(os, "nj", Bj.cols());
+  os << "MFEM_MGIS_SIMD_LOOP\n"
+     << "for (size_type ni = 0; ni < " << ni1 << "; ++ni) {\n"
+     << inner.str();
+  for (size_type i = 0; i != Bi.cols(); ++i) {
+    const auto ni = getUnknownOffset("ni", i, Bi.cols());
+    for (size_type j = 0; j != Bi.cols(); ++j) {
+      const auto nj = getUnknownOffset("nj", j, Bj.cols());
+      os << "Ke(" << ni << ", " << nj << ") += "
+         << "w * (" << simplify(Ke(i, j)) << ");\n";
+    }
+  }
+  os << "} // end of for (size_type ni = 0; ni < " << ni1 << "; ++ni)\n"
+     << "} // end of for (size_type nj = 0; nj != nnodes; ++nj)\n"
+     << "} // end of " << fname << "\n\n";
+}  // end of generateVectorisedUpdateStiffnessMatrix
+
 std::pair<bool, GiNaC::matrix> makePlaneStrainSmallStrainMechanicsBMatrix(
     std::ostream& os, const std::string& nid, const bool b) {
   auto B = GiNaC::matrix(4, 2);
@@ -421,6 +565,14 @@ void generateHeaderFile(std::ostream& os,
     os << "static constexpr bool "
           "updateExternalStateVariablesFromUnknownsValues = false;\n";
   }
+  os << "//! \\brief\n"
+     << "static constexpr bool hasSymmetricStiffnessMatrixKernel = "
+     << (d.requires_unknown_value_as_external_state_variable ? "false"
+                                                             : "true")
+     << ";\n";
+  os << "//! \\brief\n"
+     << "static constexpr bool hasVectorisedKernels = "
+     << (d.vectorised_kernels ? "true" : "false") << ";\n";
   os << "}; // end of struct BehaviourIntegratorTraits<" << d.name << ">\n"
      << '\n'
      << "/*!\n"
@@ -500,6 +652,14 @@ void generateHeaderFile(std::ostream& os,
      << "               const mfem::Vector &,\n"
      << "               const IntegrationType) override;\n"
      << '\n'
+     << "void computeGradients(const mfem::FiniteElement &,\n"
+     << "                      mfem::ElementTransformation &,\n"
+     << "                      const mfem::Vector &,\n"
+     << "                      const IntegrationType) override;\n"
+     << '\n'
+     << "bool performsBehaviourIntegration(const IntegrationType,\n"
+     << "                                  const size_type) override;\n"
+     << '\n'
      << "void updateResidual(mfem::Vector &,\n"
      << "                    const mfem::FiniteElement &,\n"
      << "                    mfem::ElementTransformation &,\n"
@@ -510,6 +670,18 @@ void generateHeaderFile(std::ostream& os,
      << "                    mfem::ElementTransformation &,\n"
      << "                    const mfem::Vector &) override;\n"
      << '\n'
+     << "void updateResidualAndJacobian(mfem::Vector &,\n"
+     << "                               mfem::DenseMatrix &,\n"
+     << "                               const mfem::FiniteElement &,\n"
+     << "                               mfem::ElementTransformation &,\n"
+     << "                               const mfem::Vector &) override;\n"
+     << '\n'
+     << "void updateJacobianAction(mfem::Vector &,\n"
+     << "                          const mfem::FiniteElement &,\n"
+     << "                          mfem::ElementTransformation &,\n"
+     << "                          const mfem::Vector &,\n"
+     << "                          const mfem::Vector &) override;\n"
+     << '\n'
      << "void computeInnerForces(mfem::Vector &,\n"
      << "                        const mfem::FiniteElement &,\n"
      << "                        mfem::ElementTransformation &) override;\n"
@@ -602,8 +774,97 @@ void generateHeaderFile(std::ostream& os,
        << "                           const mgis::span<const real>&,\n"
        << "                           const mfem::DenseMatrix &,\n"
        << "                           const real,\n"
+       << "                           const size_type) const noexcept;\n"
+       << "/*!\n"
+       << " * \\brief update the stiffness matrix of the given node\n"
+       << " * with the contribution of a symmetric consistent tangent\n"
+       << " * operator of an integration point. Only the blocks associated\n"
+       << " * with the nodes greater or equal than the given node are\n"
+       << " * updated.\n"
+       << " *\n"
+       << " * \\param[out] Ke: inner forces\n"
+       << " * \\param[in] Kip: stress\n"
+       << " * \\param[in] dN: derivatives of the shape function\n"
+       << " * \\param[in] w: weight of the integration point\n"
+       << " * \\param[in] n: node index\n"
+       << " */\n"
+       << "void updateSymmetricStiffnessMatrix(mfem::DenseMatrix &,\n"
+       << "                           const mgis::span<const real>&,\n"
+       << "                           const mfem::DenseMatrix &,\n"
+       << "                           const real,\n"
        << "                           const size_type) const noexcept;\n";
   }
+  if (d.vectorised_kernels) {
+    os << "/*!\n"
+       << " * \\brief update the strain with the contributions of all the\n"
+       << " * nodes. The loop over the nodes is vectorised.\n"
+       << " * \\param[in] g: strain\n"
+       << " * \\param[in] u: nodal displacements\n"
+       << " * \\param[in] dN: derivatives of the shape function\n"
+       << " * \\tparam N: number of nodes if known at compile-time, 0 "
+       << "otherwise\n"
+       << " */\n"
+       << "template <size_type N>\n"
+       << "void updateGradientsVectorised(mgis::span<real> &,\n"
+       << "                               const mfem::Vector &,\n"
+       << "                               const mfem::DenseMatrix &) "
+       << "noexcept;\n"
+       << "/*!\n"
+       << " * \\brief update the inner forces of all the nodes with the\n"
+       << " * contribution of the stress of an integration point. The loop\n"
+       << " * over the nodes is vectorised.\n"
+       << " *\n"
+       << " * \\param[out] Fe: inner forces\n"
+       << " * \\param[in] s: stress\n"
+       << " * \\param[in] dN: derivatives of the shape function\n"
+       << " * \\param[in] w: weight of the integration point\n"
+       << " * \\tparam N: number of nodes if known at compile-time, 0 "
+       << "otherwise\n"
+       << " */\n"
+       << "template <size_type N>\n"
+       << "void updateInnerForcesVectorised(mfem::Vector &,\n"
+       << "                                 const mgis::span<const real> &,\n"
+       << "                                 const mfem::DenseMatrix &,\n"
+       << "                                 const real) const noexcept;\n"
+       << "/*!\n"
+       << " * \\brief update the stiffness matrix with the contribution of\n"
+       << " * the consistent tangent operator of an integration point. The\n"
+       << " * loop over the nodes associated with the rows of the stiffness\n"
+       << " * matrix is vectorised.\n"
+       << " *\n"
+       << " * \\param[out] Ke: stiffness matrix\n"
+       << " * \\param[in] Kip: tangent operator\n"
+       << " * \\param[in] dN: derivatives of the shape function\n"
+       << " * \\param[in] w: weight of the integration point\n"
+       << " * \\tparam N: number of nodes if known at compile-time, 0 "
+       << "otherwise\n"
+       << " */\n"
+       << "template <size_type N>\n"
+       << "void updateStiffnessMatrixVectorised(mfem::DenseMatrix &,\n"
+       << "                           const mgis::span<const real>&,\n"
+       << "                           const mfem::DenseMatrix &,\n"
+       << "                           const real) const noexcept;\n"
+       << "/*!\n"
+       << " * \\brief update the stiffness matrix with the contribution of\n"
+       << " * a symmetric consistent tangent operator of an integration\n"
+       << " * point. Only the blocks associated with a row node lower or\n"
+       << " * equal than the column node are updated. The loop over the\n"
+       << " * row nodes is vectorised.\n"
+       << " *\n"
+       << " * \\param[out] Ke: stiffness matrix\n"
+       << " * \\param[in] Kip: tangent operator\n"
+       << " * \\param[in] dN: derivatives of the shape function\n"
+       << " * \\param[in] w: weight of the integration point\n"
+       << " * \\tparam N: number of nodes if known at compile-time, 0 "
+       << "otherwise\n"
+       << " */\n"
+       << "template <size_type N>\n"
+       << "void updateSymmetricStiffnessMatrixVectorised(\n"
+       << "    mfem::DenseMatrix &,\n"
+       << "    const mgis::span<const real>&,\n"
+       << "    const mfem::DenseMatrix &,\n"
+       << "    const real) const noexcept;\n";
+  }
   os << '\n';
   if (!d.isotropic) {
     if (isTwoDimensionalHypothesis(d.hypothesis)) {
@@ -746,7 +1007,7 @@ void generateSourceFile(std::ostream& os,
   } else {
     os << d.name << "::RotationMatrix\n"
        << d.name << "::getRotationMatrix(const size_type i) const{\n"
-       << "return this->get_rotation_fct_ptr(this->r2D, this->r3D, i);\n"
+       << "return Material::getRotationMatrix(i);\n"
        << "} // end of getRotationMatrix\n"
        << '\n';
   }
@@ -794,7 +1055,16 @@ void generateSourceFile(std::ostream& os,
   os << '\n';
   generateUpdateGradient(os, d);
   generateUpdateInnerForces(os, d);
-  generateUpdateStiffnessMatrix(os, d);
+  generateUpdateStiffnessMatrix(os, d, false);
+  if (!d.requires_unknown_value_as_external_state_variable) {
+    generateUpdateStiffnessMatrix(os, d, true);
+  }
+  if (d.vectorised_kernels) {
+    generateVectorisedUpdateGradients(os, d);
+    generateVectorisedUpdateInnerForces(os, d);
+    generateVectorisedUpdateStiffnessMatrix(os, d, false);
+    generateVectorisedUpdateStiffnessMatrix(os, d, true);
+  }
   os << "bool " << d.name << "::integrate(const mfem::FiniteElement &e,\n"
      << "                                 mfem::ElementTransformation &tr,\n"
      << "                                 const mfem::Vector &u,\n"
@@ -802,6 +1072,18 @@ void generateSourceFile(std::ostream& os,
      << "  return this->implementIntegrate(e, tr, u, it);\n"
      << "}  // end of integrate\n"
      << '\n'
+     << "void " << d.name << "::computeGradients(const mfem::FiniteElement &e,\n"
+     << "                              mfem::ElementTransformation &tr,\n"
+     << "                              const mfem::Vector &u,\n"
+     << "                              const IntegrationType it) {\n"
+     << "  this->implementComputeGradients(e, tr, u, it);\n"
+     << "}  // end of computeGradients\n"
+     << '\n'
+     << "bool " << d.name << "::performsBehaviourIntegration(\n"
+     << "    const IntegrationType it, const size_type nthreads) {\n"
+     << "  return this->implementPerformsBehaviourIntegration(it, nthreads);\n"
+     << "}  // end of performsBehaviourIntegration\n"
+     << '\n'
      << "void " << d.name << "::updateResidual(mfem::Vector &Fe,\n"
      << "                         const mfem::FiniteElement &e,\n"
      << "                         mfem::ElementTransformation &tr,\n"
@@ -816,6 +1098,24 @@ void generateSourceFile(std::ostream& os,
      << "  this->implementUpdateJacobian(Ke, e, tr);\n"
      << "}  // end of updateJacobian\n"
      << '\n'
+     << "void " << d.name << "::updateResidualAndJacobian(\n"
+     << "    mfem::Vector &Fe,\n"
+     << "    mfem::DenseMatrix &Ke,\n"
+     << "    const mfem::FiniteElement &e,\n"
+     << "    mfem::ElementTransformation &tr,\n"
+     << "    const mfem::Vector &) {\n"
+     << "  this->implementUpdateResidualAndJacobian(Fe, Ke, e, tr);\n"
+     << "}  // end of updateResidualAndJacobian\n"
+     << '\n'
+     << "void " << d.name << "::updateJacobianAction(\n"
+     << "    mfem::Vector &Ye,\n"
+     << "    const mfem::FiniteElement &e,\n"
+     << "    mfem::ElementTransformation &tr,\n"
+     << "    const mfem::Vector &,\n"
+     << "    const mfem::Vector &Xe) {\n"
+     << "  this->implementUpdateJacobianAction(Ye, e, tr, Xe);\n"
+     << "}  // end of updateJacobianAction\n"
+     << '\n'
      << "void " << d.name << "::computeInnerForces(mfem::Vector &Fe,\n"
      << "                         const mfem::FiniteElement &e,\n"
      << "                         mfem::ElementTransformation &tr) {\n"
@@ -1122,9 +1422,12 @@ int main(const int argc, const char* const* const argv) {
                                      d.unknown_name = n;
                                    })
       .registerCommandLineArgument(
-          "requires-unknown-values-as-external-state-variable", [&d]() {
+          "requires-unknown-values-as-external-state-variable",
+          [&d]() {
             d.requires_unknown_value_as_external_state_variable = true;
-          });
+          })
+      .registerCommandLineArgument(
+          "vectorised-kernels", [&d]() { d.vectorised_kernels = true; });
   args_parser.parse(argc, argv);
   //
   if (generator.empty()) {
@@ -1156,6 +1459,12 @@ int main(const int argc, const char* const* const argv) {
       raise("unknown name must be specified\n");
     }
   }
+  if ((d.vectorised_kernels) &&
+      (d.requires_unknown_value_as_external_state_variable)) {
+    raise(
+        "vectorised kernels are not supported when the unknowns are "
+        "external state variables");
+  }
   if (generate_header_file) {
     std::ofstream out(d.name + ".hxx");
     generateHeaderFile(out, d);
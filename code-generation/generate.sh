@@ -10,7 +10,7 @@ do
   do
     for generator in StandardFiniteStrainMechanics StandardSmallStrainMechanics
     do
-      ./behaviour-integrator -s ${symmetry} --hypothesis=${hypothesis} --generator=${generator} --source-file --header-file
+      ./behaviour-integrator -s ${symmetry} --hypothesis=${hypothesis} --generator=${generator} --vectorised-kernels --source-file --header-file
     done
   done
 done
@@ -38,6 +38,16 @@ namespace mfem_mgis {
     static const char *const SolverRelativeTolerance;
     static const char *const SolverAbsoluteTolerance;
     static const char *const SolverMaximumNumberOfIterations;
+    /*!
+     * \brief name of the solver parameter selecting the prediction performed
+     * at the beginning of each time step. The following values are allowed:
+     *
+     * - `"None"`: no prediction is performed (default).
+     * - `"ElasticOperator"`: the prediction uses the elastic operator.
+     * - `"SecantOperator"`: the prediction uses the secant operator.
+     * - `"TangentOperator"`: the prediction uses the tangent operator.
+     */
+    static const char *const SolverPredictionPolicy;
     //! \return the underlying finite element discretization
     virtual FiniteElementDiscretization &getFiniteElementDiscretization() = 0;
     //! \return the underlying finite element discretization
@@ -196,10 +206,47 @@ namespace mfem_mgis {
      * \param[in] dt: time increment
      */
     virtual void executePostProcessings(const real, const real) = 0;
-    //! \brief revert the state to the beginning of the time step.
+    /*!
+     * \brief revert the state to the beginning of the time step.
+     *
+     * \note after this call, the states of the materials at the beginning
+     * and at the end of the time step share the same buffers until the next
+     * resolution (see `Material::revertStates`).
+     */
     virtual void revert() = 0;
-    //! \brief update the state to the end of the time step.
+    /*!
+     * \brief update the state to the end of the time step.
+     *
+     * \note after this call, the states of the materials at the beginning
+     * and at the end of the time step share the same buffers until the next
+     * resolution (see `Material::updateStates`): modifying one of them, for
+     * example to initialise some internal state variables, also modifies
+     * the other.
+     */
     virtual void update() = 0;
+    /*!
+     * \brief save the state at the beginning of the time step (unknowns and
+     * states of the materials) on top of a stack of snapshots.
+     *
+     * Snapshots allow to go back to a state older than the beginning of the
+     * current time step, for instance to resume a computation from an
+     * intermediate state of an adaptive time stepping scheme.
+     *
+     * \note the values of the states of the materials are only copied when
+     * they are about to be overwritten, so a snapshot which is never used
+     * costs almost nothing.
+     */
+    virtual void pushSnapshot() = 0;
+    /*!
+     * \brief restore the state saved by the last snapshot as the state at the
+     * beginning of the time step. The state at the end of the time step is
+     * reverted to this state. The snapshot is kept on the stack.
+     */
+    virtual void restoreSnapshot() = 0;
+    //! \brief remove the last snapshot from the stack
+    virtual void popSnapshot() = 0;
+    //! \return the number of snapshots on the stack
+    virtual size_type getNumberOfSnapshots() const = 0;
     //! \brief destructor
     virtual ~AbstractNonLinearEvolutionProblem();
   };  // end of struct AbstractNonLinearEvolutionProblem
@@ -0,0 +1,136 @@
+/*!
+ * \file   include/MFEMMGIS/AdaptiveTimeStepping.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#ifndef LIB_MFEMMGIS_ADAPTIVETIMESTEPPING_HXX
+#define LIB_MFEMMGIS_ADAPTIVETIMESTEPPING_HXX
+
+#include <limits>
+#include <string>
+#include <vector>
+#include "MFEMMGIS/Config.hxx"
+#include "MFEMMGIS/NonLinearResolutionOutput.hxx"
+
+namespace mfem_mgis {
+
+  // forward declaration
+  struct Parameters;
+  // forward declaration
+  struct AbstractNonLinearEvolutionProblem;
+
+  //! \brief statistics gathered by the adaptive time stepping
+  struct AdaptiveTimeSteppingStatistics {
+    //! \brief number of accepted time steps
+    size_type number_of_accepted_steps = size_type{};
+    //! \brief number of rejected time steps
+    size_type number_of_rejected_steps = size_type{};
+    //! \brief total number of iterations of the accepted time steps
+    size_type number_of_iterations = size_type{};
+    //! \brief total number of iterations of the rejected time steps
+    size_type number_of_rejected_iterations = size_type{};
+    //! \brief smallest accepted time increment
+    real minimal_time_increment = std::numeric_limits<real>::max();
+    //! \brief largest accepted time increment
+    real maximal_time_increment = real{0};
+  };  // end of struct AdaptiveTimeSteppingStatistics
+
+  /*!
+   * \brief a driver solving a non linear evolution problem over a time
+   * interval using an adaptive time step.
+   *
+   * After a successful resolution, the state of the problem is updated and
+   * the next time increment is chosen from the number of iterations of the
+   * resolution and from the time step scaling factor proposed by the
+   * behaviours. After a failed resolution, the state of the problem is
+   * reverted and the time increment is reduced.
+   *
+   * \note post-processings are not executed by the driver.
+   */
+  struct MFEM_MGIS_EXPORT AdaptiveTimeStepping {
+    //! \brief name of the parameter giving the initial time increment
+    static const char *const InitialTimeIncrement;
+    //! \brief name of the parameter giving the minimal time increment
+    static const char *const MinimalTimeIncrement;
+    //! \brief name of the parameter giving the maximal time increment
+    static const char *const MaximalTimeIncrement;
+    /*!
+     * \brief name of the parameter giving the number of iterations of the
+     * non linear solver targeted when choosing the next time increment. The
+     * default value is 5.
+     */
+    static const char *const TargetNumberOfIterations;
+    /*!
+     * \brief name of the parameter giving the minimal ratio between two
+     * successive time increments. The default value is 0.1.
+     */
+    static const char *const MinimalTimeStepScalingFactor;
+    /*!
+     * \brief name of the parameter giving the maximal ratio between two
+     * successive time increments. The default value is 2.
+     */
+    static const char *const MaximalTimeStepScalingFactor;
+    /*!
+     * \brief name of the parameter giving the maximum number of successive
+     * failed resolutions. The default value is 10.
+     */
+    static const char *const MaximumNumberOfSuccessiveFailures;
+    //! \return the list of valid parameters
+    static std::vector<std::string> getParametersList();
+    /*!
+     * \brief constructor
+     * \param[in] p: non linear evolution problem
+     * \param[in] params: parameters
+     *
+     * If the `InitialTimeIncrement` parameter is not given, the first time
+     * step spans the whole time interval given to the `solve` method.
+     */
+    AdaptiveTimeStepping(AbstractNonLinearEvolutionProblem &,
+                         const Parameters &);
+    /*!
+     * \brief solve the problem from the given time to the given time.
+     * \return the output of the last resolution. The resolution failed if
+     * the time increment has been reduced below its minimal value or if the
+     * maximum number of successive failures has been reached.
+     * \param[in] t0: initial time
+     * \param[in] t1: final time
+     */
+    NonLinearResolutionOutput solve(const real, const real);
+    //! \return the time increment proposed for the next time step
+    real getTimeIncrement() const;
+    //! \return the statistics gathered since the creation of the driver
+    const AdaptiveTimeSteppingStatistics &getStatistics() const;
+    //! \brief destructor
+    ~AdaptiveTimeStepping();
+
+   private:
+    /*!
+     * \return the ratio between the next time increment and the current one
+     * \param[in] r: output of the last resolution
+     */
+    real getTimeStepScalingFactor(const NonLinearResolutionOutput &) const;
+    //! \brief underlying problem
+    AbstractNonLinearEvolutionProblem &problem;
+    //! \brief statistics
+    AdaptiveTimeSteppingStatistics statistics;
+    //! \brief time increment proposed for the next time step, if any
+    real dt = real{0};
+    //! \brief minimal time increment
+    real dt_min = real{0};
+    //! \brief maximal time increment
+    real dt_max = std::numeric_limits<real>::max();
+    //! \brief targeted number of iterations
+    size_type target_number_of_iterations = 5;
+    //! \brief minimal ratio between two successive time increments
+    real minimal_scaling_factor = real(0.1);
+    //! \brief maximal ratio between two successive time increments
+    real maximal_scaling_factor = real(2);
+    //! \brief maximum number of successive failures
+    size_type maximum_number_of_successive_failures = 10;
+  };  // end of struct AdaptiveTimeStepping
+
+}  // end of namespace mfem_mgis
+
+#endif /* LIB_MFEMMGIS_ADAPTIVETIMESTEPPING_HXX */
@@ -12,6 +12,7 @@
 #include <memory>
 #include "MGIS/Span.hxx"
 #include "MFEMMGIS/Config.hxx"
+#include "MFEMMGIS/TimeStepScalingFactorHistogram.hxx"
 
 namespace mfem_mgis {
 
@@ -77,6 +78,41 @@ namespace mfem_mgis {
                            mfem::ElementTransformation &,
                            const mfem::Vector &,
                            const IntegrationType) = 0;
+    /*!
+     * \brief compute the gradients at the integration points of the given
+     * element, without integrating the behaviour.
+     *
+     * This method is the first step of the batched integration of the
+     * behaviour. The second step is performed by the
+     * `performsBehaviourIntegration` method once the gradients have been
+     * computed on every element.
+     *
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] u: current estimate of the unknowns
+     * \param[in] it: integration type
+     */
+    virtual void computeGradients(const mfem::FiniteElement &,
+                                  mfem::ElementTransformation &,
+                                  const mfem::Vector &,
+                                  const IntegrationType) = 0;
+    /*!
+     * \brief integrate the mechanical behaviour over the time step at all the
+     * integration points of the material.
+     * If successful, the value of the stress, consistent tangent
+     * operator and internal state variables are updated.
+     *
+     * \param[in] it: integration type
+     * \param[in] nthreads: number of threads
+     *
+     * \note the gradients must have been computed by the `computeGradients`
+     * method.
+     * \note if the local substepping is enabled (see the
+     * `setNumberOfLocalSubsteppingLevels` method) and the integration fails,
+     * the integration points are integrated again one by one.
+     */
+    virtual bool performsBehaviourIntegration(const IntegrationType,
+                                              const size_type) = 0;
     /*!
      * \brief compute the contribution of the given element to the inner forces
      * \param[out] Fe: inner forces
@@ -108,22 +144,82 @@ namespace mfem_mgis {
                                 const mfem::FiniteElement &,
                                 mfem::ElementTransformation &,
                                 const mfem::Vector &) = 0;
+    /*!
+     * \brief compute the contributions of the given element to the residual
+     * and to the jacobian in a single pass over the integration points.
+     * \param[out] Fe: element contribution to the residual
+     * \param[out] Ke: element stiffness matrix
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] u: current estimation of the displacement field
+     */
+    virtual void updateResidualAndJacobian(mfem::Vector &,
+                                           mfem::DenseMatrix &,
+                                           const mfem::FiniteElement &,
+                                           mfem::ElementTransformation &,
+                                           const mfem::Vector &) = 0;
+    /*!
+     * \brief compute the product of the element stiffness matrix by the
+     * given vector using the tangent operator blocks stored at the
+     * integration points, without building the element stiffness matrix
+     * whenever possible.
+     * \param[out] Ye: product of the element stiffness matrix by `Xe`
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] u: current estimation of the displacement field
+     * \param[in] Xe: values of the vector on the element
+     */
+    virtual void updateJacobianAction(mfem::Vector &,
+                                      const mfem::FiniteElement &,
+                                      mfem::ElementTransformation &,
+                                      const mfem::Vector &,
+                                      const mfem::Vector &) = 0;
     /*!
      * \brief revert the internal state variables.
      *
-     * The values of the internal state variables at the beginning of the time
-     * step are copied on the values of the internal state variables at
-     * end of the time step.
+     * The values of the internal state variables at the end of the time step
+     * are reset to the values of the internal state variables at the
+     * beginning of the time step.
+     *
+     * \note the implementation provided by the `BehaviourIntegratorBase`
+     * class does not copy any value (see `Material::revertStates`).
      */
     virtual void revert() = 0;
     /*!
      * \brief update the internal state variables.
      *
      * The values of the internal state variables at the end of the time step
-     * are copied on the values of the internal state variables at beginning of
+     * become the values of the internal state variables at beginning of
      * the time step.
+     *
+     * \note the implementation provided by the `BehaviourIntegratorBase`
+     * class does not copy any value (see `Material::updateStates`).
      */
     virtual void update() = 0;
+    /*!
+     * \brief reset the time step scaling factor before a new integration of
+     * the behaviour.
+     */
+    virtual void resetTimeStepScalingFactor() = 0;
+    /*!
+     * \return the minimum, over the integration points, of the ratios between
+     * the time step proposed by the behaviour and the current time step,
+     * since the last call to `resetTimeStepScalingFactor`.
+     *
+     * \note integration points where the integration of the behaviour failed
+     * are not taken into account.
+     */
+    virtual real getTimeStepScalingFactor() const = 0;
+    /*!
+     * \return the histogram, over the integration points, of the ratios
+     * between the time step proposed by the behaviour and the current time
+     * step, since the last call to `resetTimeStepScalingFactor`.
+     *
+     * \note the batched integration of the behaviour only adds the minimum
+     * of those ratios, or a failure, to the histogram.
+     */
+    virtual TimeStepScalingFactorHistogram getTimeStepScalingFactorHistogram()
+        const = 0;
     //! \return the underlying material
     virtual Material &getMaterial() = 0;
     //! \return the underlying material
@@ -133,6 +229,42 @@ namespace mfem_mgis {
      * \param[in] g: macroscopic gradients
      */
     virtual void setMacroscopicGradients(mgis::span<const real>) = 0;
+    /*!
+     * \brief set the number of levels of the local substepping.
+     *
+     * If this number, denoted \f$n\f$, is strictly positive, the behaviour is
+     * integrated again at an integration point where its integration failed,
+     * by dividing the time step in \f$2\f$, \f$4\f$, ..., \f$2^{n}\f$
+     * substeps until success. The integration of the behaviour over the
+     * whole material is only considered as failed if all those attempts
+     * failed. By default, the local substepping is disabled.
+     *
+     * \param[in] n: number of levels
+     */
+    virtual void setNumberOfLocalSubsteppingLevels(const size_type) = 0;
+    /*!
+     * \brief allow or forbid the use of a kernel computing the element
+     * stiffness matrices from their upper triangular part when the tangent
+     * operators of the element are symmetric. By default, the use of such a
+     * kernel is allowed.
+     *
+     * \param[in] b: boolean
+     *
+     * \note this setting has no effect if the integrator does not provide such
+     * a kernel.
+     */
+    virtual void setSymmetricStiffnessMatrixKernelUsage(const bool) = 0;
+    /*!
+     * \brief allow or forbid the use of the kernels treating all the nodes of
+     * an element at once, whose loop over the nodes is vectorised. By
+     * default, the use of those kernels is allowed.
+     *
+     * \param[in] b: boolean
+     *
+     * \note this setting has no effect if the integrator does not provide
+     * such kernels.
+     */
+    virtual void setVectorisedKernelsUsage(const bool) = 0;
     //! \brief destructor
     virtual ~BehaviourIntegrator();
   };  // end of struct BehaviourIntegrator
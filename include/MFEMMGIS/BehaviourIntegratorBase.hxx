@@ -9,6 +9,7 @@
 #define LIB_MFEM_MGIS_BEHAVIOURINTEGRATORBASE_HXX
 
 #include <memory>
+#include <mfem/linalg/densemat.hpp>
 #include "MFEMMGIS/Config.hxx"
 #include "MFEMMGIS/BehaviourIntegrator.hxx"
 #include "MFEMMGIS/Material.hxx"
@@ -23,11 +24,20 @@ namespace mfem_mgis {
     void setTimeIncrement(const real) override;
     const PartialQuadratureSpace &getPartialQuadratureSpace() const override;
     void setup(const real, const real) override;
+    bool performsBehaviourIntegration(const IntegrationType,
+                                      const size_type) override;
     void revert() override;
     void update() override;
+    void resetTimeStepScalingFactor() override;
+    real getTimeStepScalingFactor() const override;
+    TimeStepScalingFactorHistogram getTimeStepScalingFactorHistogram()
+        const override;
     Material& getMaterial() override;
     const Material& getMaterial() const override;
     void setMacroscopicGradients(mgis::span<const real>) override;
+    void setNumberOfLocalSubsteppingLevels(const size_type) override;
+    void setSymmetricStiffnessMatrixKernelUsage(const bool) override;
+    void setVectorisedKernelsUsage(const bool) override;
     //! \brief destructor
     ~BehaviourIntegratorBase() override;
 
@@ -74,8 +84,27 @@ namespace mfem_mgis {
      */
     virtual bool performsLocalBehaviourIntegration(const size_type,
                                                    const IntegrationType);
-    //! \brief workspace
-    struct {
+    /*!
+     * \return if the tangent operators of the given integration points are
+     * symmetric, up to rounding errors.
+     * \param[in] o: offset of the first integration point
+     * \param[in] n: number of integration points
+     */
+    bool areTangentOperatorsSymmetric(const size_type, const size_type) const;
+    /*!
+     * \brief compute the blocks of an elementary stiffness matrix
+     * associated with a node and a node of lower index by symmetry.
+     * \param[in,out] Ke: elementary stiffness matrix
+     * \param[in] nnodes: number of nodes
+     *
+     * \note the components of the unknowns are assumed to be ordered by
+     * nodes, i.e. the row associated with the `c`-th component of the unknown
+     * of the node `n` is `n + c * nnodes`.
+     */
+    static void completeStiffnessMatrixBySymmetry(mfem::DenseMatrix&,
+                                                  const size_type);
+    //! \brief workspace associated with a thread
+    struct ThreadWorkspace {
       //! \brief array for material properties at the end of the time step
       std::vector<real> mps;
       //! \brief array for external state variables at the beginning of the time
@@ -83,6 +112,69 @@ namespace mfem_mgis {
       std::vector<real> esvs0;
       //! \brief array for external state variables at the end of the time step
       std::vector<real> esvs1;
+      //! \brief ratio between the time step proposed by the behaviour and the
+      //! current time step
+      real rdt = real{1};
+      //! \brief minimum of the values of `rdt` since the last reset
+      real minimal_rdt = real{1};
+      //! \brief histogram of the values of `rdt` since the last reset
+      TimeStepScalingFactorHistogram rdt_histogram;
+      //! \brief vector used to store the value of the shape functions
+      mfem::Vector shape;
+      //! \brief matrix used to store the derivatives of the shape functions
+      mfem::DenseMatrix dshape;
+      /*!
+       * \brief non-owning view on the derivatives of the shape functions
+       * stored in the geometric cache of the quadrature space
+       */
+      mfem::DenseMatrix cached_dshape;
+      //! \brief buffer used to store the linearised gradients
+      std::vector<real> gradients_increment;
+      //! \brief buffer used to store the linearised thermodynamic forces
+      std::vector<real> thermodynamic_forces_increment;
+      //! \brief matrix used to store an element stiffness matrix
+      mfem::DenseMatrix Ke;
+      //! \brief buffer used to store nodal values in lexicographic order
+      std::vector<real> lexicographic_nodal_values;
+      /*!
+       * \brief buffer used to store the derivatives of the unknowns with
+       * respect to the reference coordinates at the integration points
+       */
+      std::vector<real> reference_gradients;
+      //! \brief buffer used to store the gradients of the unknowns
+      std::vector<real> physical_gradients;
+      //! \brief buffer used by the sum factorisation kernels
+      std::vector<real> sum_factorisation_workspace;
+      //! \brief buffer used by the local substepping
+      std::vector<real> substepping_workspace;
+    };
+    /*!
+     * \return the workspace associated with the calling thread
+     * \note the workspaces are allocated by the `setup` method.
+     */
+    ThreadWorkspace& getThreadWorkspace();
+    /*!
+     * \return the derivatives of the shape functions at an integration point.
+     * Those derivatives are taken from the geometric cache of the quadrature
+     * space if available or computed otherwise.
+     * \param[in] lw: workspace of the calling thread
+     * \param[in] e: finite element
+     * \param[in] tr: element transformation. The integration point must have
+     * been set.
+     * \param[in] o: offset of the integration point
+     */
+    const mfem::DenseMatrix& getShapeFunctionsDerivatives(
+        ThreadWorkspace&,
+        const mfem::FiniteElement&,
+        mfem::ElementTransformation&,
+        const size_type) const;
+    //! \brief workspace
+    struct {
+      /*!
+       * \brief workspaces associated with each thread. The first element is
+       * used in sequential computations.
+       */
+      std::vector<ThreadWorkspace> threads;
       /*!
        * \brief evaluators for the material properties at the end of the time
        * step
@@ -101,6 +193,23 @@ namespace mfem_mgis {
     } wks;
     //! \brief time increment for the given time step
     real time_increment;
+    //! \brief number of levels of the local substepping
+    size_type number_of_local_substepping_levels = 0;
+    /*!
+     * \brief boolean stating if a symmetric kernel may be used to compute the
+     * element stiffness matrices
+     */
+    bool use_symmetric_stiffness_matrix_kernel = true;
+    /*!
+     * \brief boolean stating if the kernels vectorised over the nodes of an
+     * element may be used
+     */
+    bool use_vectorised_kernels = true;
+    /*!
+     * \brief thread pool used by the `performsBehaviourIntegration` method
+     * to integrate the behaviour in parallel
+     */
+    std::unique_ptr<mgis::ThreadPool> thread_pool;
   };  // end of struct BehaviourIntegratorBase
 
 }  // end of namespace mfem_mgis
@@ -25,6 +25,20 @@ namespace mfem_mgis {
     //! \brief
     static constexpr bool updateExternalStateVariablesFromUnknownsValues =
         false;
+    /*!
+     * \brief if true, the behaviour integrator provides a method called
+     * `updateSymmetricStiffnessMatrix` which is used instead of the
+     * `updateStiffnessMatrix` method when the tangent operator is symmetric.
+     */
+    static constexpr bool hasSymmetricStiffnessMatrixKernel = false;
+    /*!
+     * \brief if true, the behaviour integrator provides kernels treating all
+     * the nodes of an element at once, whose loop over the nodes is
+     * vectorised. Those kernels are used instead of the per-node ones,
+     * unless their use is forbidden (see the
+     * `BehaviourIntegrator::setVectorisedKernelsUsage` method).
+     */
+    static constexpr bool hasVectorisedKernels = false;
   };  // end of struct BehaviourIntegratorTraits
 
 }  // end of namespace mfem_mgis
@@ -39,6 +39,34 @@
 #define MFEM_MGIS_EXPORT MGIS_VISIBILITY_EXPORT
 #endif /* */
 
+//! \brief a portable wrapper around the `_Pragma` operator
+#define MFEM_MGIS_PRAGMA(X) _Pragma(#X)
+
+/*!
+ * \def MFEM_MGIS_SIMD_LOOP
+ * \brief states that the iterations of the following loop are independent
+ * and that this loop shall be vectorised.
+ *
+ * \def MFEM_MGIS_SIMD_REDUCTION_LOOP
+ * \brief states that the iterations of the following loop are independent,
+ * except for the sums accumulated in the variables given in argument, and
+ * that this loop shall be vectorised.
+ */
+#if defined _OPENMP
+#define MFEM_MGIS_SIMD_LOOP MFEM_MGIS_PRAGMA(omp simd)
+#define MFEM_MGIS_SIMD_REDUCTION_LOOP(...) \
+  MFEM_MGIS_PRAGMA(omp simd reduction(+ : __VA_ARGS__))
+#elif defined __clang__
+#define MFEM_MGIS_SIMD_LOOP MFEM_MGIS_PRAGMA(clang loop vectorize(enable))
+#define MFEM_MGIS_SIMD_REDUCTION_LOOP(...) MFEM_MGIS_SIMD_LOOP
+#elif defined __GNUC__
+#define MFEM_MGIS_SIMD_LOOP MFEM_MGIS_PRAGMA(GCC ivdep)
+#define MFEM_MGIS_SIMD_REDUCTION_LOOP(...) MFEM_MGIS_SIMD_LOOP
+#else
+#define MFEM_MGIS_SIMD_LOOP
+#define MFEM_MGIS_SIMD_REDUCTION_LOOP(...)
+#endif
+
 namespace mfem_mgis {
 
   //! a simple alias
@@ -78,6 +106,18 @@ namespace mfem_mgis {
    * \brief gives MPI global communicator size.
    */
   MFEM_MGIS_EXPORT int getMPIsize();
+  /*!
+   * \return the maximum number of threads that can be used in a shared
+   * memory parallel region. This function returns 1 if the support of
+   * OpenMP has not been enabled.
+   */
+  MFEM_MGIS_EXPORT size_type getMaximumNumberOfThreads();
+  /*!
+   * \return the identifier of the calling thread in the current shared
+   * memory parallel region. This function returns 0 outside a parallel
+   * region or if the support of OpenMP has not been enabled.
+   */
+  MFEM_MGIS_EXPORT size_type getThreadIdentifier();
   
   /*!
    * \brief a small wrapper used to build the exception outside the
@@ -10,6 +10,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <memory>
 #include "MFEMMGIS/Config.hxx"
 
@@ -25,6 +26,23 @@ namespace mfem_mgis {
    * - create and handle a finite element space
    */
   struct MFEM_MGIS_EXPORT FiniteElementDiscretization {
+    /*!
+     * \brief partition of the elements of the mesh by material.
+     *
+     * \note in parallel computations, only the elements of the local part
+     * of the mesh are considered and the elements are numbered locally.
+     */
+    struct ElementsPartition {
+      //! \brief elements of each material, sorted in increasing order
+      std::map<size_type, std::vector<size_type>> elements;
+      //! \brief material identifier of each element
+      std::vector<size_type> attributes;
+      /*!
+       * \brief position of each element in the list of the elements of its
+       * material
+       */
+      std::vector<size_type> positions;
+    };
     //! \brief string associated to the `Parallel` parameter
     static const char* const Parallel;
     //! \brief string associated to the `MeshFileName` parameter
@@ -186,6 +204,16 @@ namespace mfem_mgis {
     const FiniteElementCollection& getFiniteElementCollection() const;
     //! \return if this object is built to run parallel computations
     bool describesAParallelComputation() const;
+    /*!
+     * \return the partition of the elements of the mesh by material.
+     *
+     * This partition is built in a single traversal of the mesh when this
+     * method is first called.
+     *
+     * \note this method is not thread-safe.
+     * \note the partition is only valid as long as the mesh is not modified.
+     */
+    const ElementsPartition& getElementsPartition() const;
     //! \brief destructor
     ~FiniteElementDiscretization();
 
@@ -206,6 +234,8 @@ namespace mfem_mgis {
     std::map<size_type, std::string> materials_names;
     //! \brief mapping between materials boundaries and names
     std::map<size_type, std::string> boundaries_names;
+    //! \brief partition of the elements by material, built on demand
+    mutable std::unique_ptr<ElementsPartition> elements_partition;
   };  // end of FiniteElementDiscretization
 
   /*!
@@ -29,6 +29,10 @@ namespace mfem_mgis {
     static constexpr bool gradientsComputationRequiresShapeFunctions = false;
     //! \brief
     static constexpr bool updateExternalStateVariablesFromUnknownsValues = true;
+    //! \brief
+    static constexpr bool hasSymmetricStiffnessMatrixKernel = false;
+    //! \brief
+    static constexpr bool hasVectorisedKernels = false;
   };  // end of struct
       // BehaviourIntegratorTraits<IsotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator>
 
@@ -100,6 +104,14 @@ namespace mfem_mgis {
                    const mfem::Vector &,
                    const IntegrationType) override;
 
+    void computeGradients(const mfem::FiniteElement &,
+                          mfem::ElementTransformation &,
+                          const mfem::Vector &,
+                          const IntegrationType) override;
+
+    bool performsBehaviourIntegration(const IntegrationType,
+                                      const size_type) override;
+
     void updateResidual(mfem::Vector &,
                         const mfem::FiniteElement &,
                         mfem::ElementTransformation &,
@@ -110,6 +122,18 @@ namespace mfem_mgis {
                         mfem::ElementTransformation &,
                         const mfem::Vector &) override;
 
+    void updateResidualAndJacobian(mfem::Vector &,
+                                   mfem::DenseMatrix &,
+                                   const mfem::FiniteElement &,
+                                   mfem::ElementTransformation &,
+                                   const mfem::Vector &) override;
+
+    void updateJacobianAction(mfem::Vector &,
+                              const mfem::FiniteElement &,
+                              mfem::ElementTransformation &,
+                              const mfem::Vector &,
+                              const mfem::Vector &) override;
+
     void computeInnerForces(mfem::Vector &,
                             const mfem::FiniteElement &,
                             mfem::ElementTransformation &) override;
@@ -30,6 +30,10 @@ namespace mfem_mgis {
     //! \brief
     static constexpr bool updateExternalStateVariablesFromUnknownsValues =
         false;
+    //! \brief
+    static constexpr bool hasSymmetricStiffnessMatrixKernel = true;
+    //! \brief
+    static constexpr bool hasVectorisedKernels = true;
   };  // end of struct
       // BehaviourIntegratorTraits<IsotropicPlaneStressStandardSmallStrainMechanicsBehaviourIntegrator>
 
@@ -86,6 +90,14 @@ namespace mfem_mgis {
                    const mfem::Vector &,
                    const IntegrationType) override;
 
+    void computeGradients(const mfem::FiniteElement &,
+                          mfem::ElementTransformation &,
+                          const mfem::Vector &,
+                          const IntegrationType) override;
+
+    bool performsBehaviourIntegration(const IntegrationType,
+                                      const size_type) override;
+
     void updateResidual(mfem::Vector &,
                         const mfem::FiniteElement &,
                         mfem::ElementTransformation &,
@@ -96,6 +108,18 @@ namespace mfem_mgis {
                         mfem::ElementTransformation &,
                         const mfem::Vector &) override;
 
+    void updateResidualAndJacobian(mfem::Vector &,
+                                   mfem::DenseMatrix &,
+                                   const mfem::FiniteElement &,
+                                   mfem::ElementTransformation &,
+                                   const mfem::Vector &) override;
+
+    void updateJacobianAction(mfem::Vector &,
+                              const mfem::FiniteElement &,
+                              mfem::ElementTransformation &,
+                              const mfem::Vector &,
+                              const mfem::Vector &) override;
+
     void computeInnerForces(mfem::Vector &,
                             const mfem::FiniteElement &,
                             mfem::ElementTransformation &) override;
@@ -165,6 +189,88 @@ namespace mfem_mgis {
                                const mfem::DenseMatrix &,
                                const real,
                                const size_type) const noexcept;
+    /*!
+     * \brief update the stiffness matrix of the given node
+     * with the contribution of a symmetric consistent tangent
+     * operator of an integration point. Only the blocks associated
+     * with the nodes greater or equal than the given node are
+     * updated.
+     *
+     * \param[out] Ke: inner forces
+     * \param[in] Kip: stress
+     * \param[in] dN: derivatives of the shape function
+     * \param[in] w: weight of the integration point
+     * \param[in] n: node index
+     */
+    void updateSymmetricStiffnessMatrix(mfem::DenseMatrix &,
+                                        const mgis::span<const real> &,
+                                        const mfem::DenseMatrix &,
+                                        const real,
+                                        const size_type) const noexcept;
+    /*!
+     * \brief update the strain with the contributions of all the
+     * nodes. The loop over the nodes is vectorised.
+     * \param[in] g: strain
+     * \param[in] u: nodal displacements
+     * \param[in] dN: derivatives of the shape function
+     * \tparam N: number of nodes if known at compile-time, 0 otherwise
+     */
+    template <size_type N>
+    void updateGradientsVectorised(mgis::span<real> &,
+                                   const mfem::Vector &,
+                                   const mfem::DenseMatrix &) noexcept;
+    /*!
+     * \brief update the inner forces of all the nodes with the
+     * contribution of the stress of an integration point. The loop
+     * over the nodes is vectorised.
+     *
+     * \param[out] Fe: inner forces
+     * \param[in] s: stress
+     * \param[in] dN: derivatives of the shape function
+     * \param[in] w: weight of the integration point
+     * \tparam N: number of nodes if known at compile-time, 0 otherwise
+     */
+    template <size_type N>
+    void updateInnerForcesVectorised(mfem::Vector &,
+                                     const mgis::span<const real> &,
+                                     const mfem::DenseMatrix &,
+                                     const real) const noexcept;
+    /*!
+     * \brief update the stiffness matrix with the contribution of
+     * the consistent tangent operator of an integration point. The
+     * loop over the nodes associated with the rows of the stiffness
+     * matrix is vectorised.
+     *
+     * \param[out] Ke: stiffness matrix
+     * \param[in] Kip: tangent operator
+     * \param[in] dN: derivatives of the shape function
+     * \param[in] w: weight of the integration point
+     * \tparam N: number of nodes if known at compile-time, 0 otherwise
+     */
+    template <size_type N>
+    void updateStiffnessMatrixVectorised(mfem::DenseMatrix &,
+                                         const mgis::span<const real> &,
+                                         const mfem::DenseMatrix &,
+                                         const real) const noexcept;
+    /*!
+     * \brief update the stiffness matrix with the contribution of
+     * a symmetric consistent tangent operator of an integration
+     * point. Only the blocks associated with a row node lower or
+     * equal than the column node are updated. The loop over the
+     * row nodes is vectorised.
+     *
+     * \param[out] Ke: stiffness matrix
+     * \param[in] Kip: tangent operator
+     * \param[in] dN: derivatives of the shape function
+     * \param[in] w: weight of the integration point
+     * \tparam N: number of nodes if known at compile-time, 0 otherwise
+     */
+    template <size_type N>
+    void updateSymmetricStiffnessMatrixVectorised(
+        mfem::DenseMatrix &,
+        const mgis::span<const real> &,
+        const mfem::DenseMatrix &,
+        const real) const noexcept;
 
   };  // end of struct
       // IsotropicPlaneStressStandardSmallStrainMechanicsBehaviourIntegrator
@@ -33,6 +33,7 @@ namespace mfem {
   class Solver;
   class IterativeSolver;
   class IntegrationPoint;
+  class DofToQuad;
   //
   template <class>
   class Array;
@@ -12,6 +12,8 @@
 
 namespace mgis {
 
+  struct ThreadPool;
+
   namespace behaviour {
 
     struct Behaviour;
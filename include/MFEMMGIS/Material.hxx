@@ -61,11 +61,85 @@ namespace mfem_mgis {
      * \note this call is only meaningfull in 3D for orthotropic behaviours
      */
     void setRotationMatrix(const RotationMatrix3D &);
+    /*!
+     * \return the rotation matrix at the given integration point
+     * \param[in] i: integration point
+     */
+    inline std::array<real, 9u> getRotationMatrix(const size_type) const;
     //! \return the quadrature space
     const PartialQuadratureSpace &getPartialQuadratureSpace() const;
     //! \return the quadrature space
     std::shared_ptr<const PartialQuadratureSpace>
     getPartialQuadratureSpacePointer() const;
+    /*!
+     * \brief make the state at the end of the time step the state at the
+     * beginning of the time step.
+     *
+     * No value is copied: the state at the beginning of the time step takes
+     * over the buffers of the state at the end of the time step. Both states
+     * share those buffers until the next call to the
+     * `detachEndOfTimeStepState` method.
+     *
+     * \warning `s0` and `s1` are aliases until then: writing in `s1`, either
+     * directly or through a partial quadrature function, also modifies
+     * `s0`, and conversely. In particular, values set in `s1` after an
+     * update are the ones used at the beginning of the next time step.
+     */
+    void updateStates();
+    /*!
+     * \brief reset the state at the end of the time step to the state at the
+     * beginning of the time step.
+     *
+     * No value is copied: the state at the end of the time step shares the
+     * buffers of the state at the beginning of the time step until the next
+     * call to the `detachEndOfTimeStepState` method. Nothing is done if
+     * those buffers are already shared, i.e. if the state at the end of the
+     * time step has not been computed since the last update or revert.
+     *
+     * \warning as after a call to `updateStates`, `s0` and `s1` are aliases
+     * until the next call to the `detachEndOfTimeStepState` method.
+     */
+    void revertStates();
+    /*!
+     * \brief give back to the state at the end of the time step its own
+     * buffers, if they are shared with the state at the beginning of the time
+     * step.
+     *
+     * The thermodynamic forces at the beginning of the time step are copied
+     * in the state at the end of the time step, since the integrations of
+     * the behaviour performed to compute a prediction operator do not
+     * compute them while the residual is assembled from them.
+     *
+     * \note after this call, the other fields of the state at the end of the
+     * time step hold outdated values which are meant to be overwritten by the
+     * integration of the behaviour. This method must thus be called before
+     * any integration following a call to `updateStates` or `revertStates`.
+     */
+    void detachEndOfTimeStepState();
+    /*!
+     * \brief save the state at the beginning of the time step on top of the
+     * stack of snapshots.
+     *
+     * No value is copied by this method: the snapshot refers to the buffers
+     * of the state at the beginning of the time step. The values are only
+     * copied when those buffers are about to be overwritten by the
+     * integration of the behaviour.
+     *
+     * \note modifying the state at the beginning of the time step through
+     * a partial quadrature function also modifies the snapshots which have
+     * not been copied yet.
+     */
+    void pushStateSnapshot();
+    /*!
+     * \brief restore the state at the beginning of the time step saved by the
+     * last snapshot. The state at the end of the time step is reverted to the
+     * restored state. The snapshot is kept on the stack.
+     */
+    void restoreStateSnapshot();
+    //! \brief remove the last snapshot from the stack
+    void popStateSnapshot();
+    //! \return the number of snapshots on the stack
+    size_type getNumberOfStateSnapshots() const;
     //! \brief destructor
     ~Material();
 
@@ -88,8 +162,93 @@ namespace mfem_mgis {
     std::array<real, 9u> (*get_rotation_fct_ptr)(const RotationMatrix2D &,
                                                  const RotationMatrix3D &,
                                                  const size_type);
+    /*!
+     * \brief rotation matrices at each integration point, stored
+     * contiguously. Those matrices are only computed if the rotation matrix
+     * is defined by partial quadrature functions.
+     *
+     * \note the rotation matrices are computed when the `setRotationMatrix`
+     * method is called. This method must be called again if the values of
+     * the partial quadrature functions are modified.
+     */
+    std::vector<real> rotation_matrices;
 
    private:
+    //! \brief buffers holding the state of the material
+    struct StateBuffers {
+      //! \brief gradients
+      mgis::span<real> gradients;
+      //! \brief thermodynamic forces
+      mgis::span<real> thermodynamic_forces;
+      //! \brief internal state variables
+      mgis::span<real> internal_state_variables;
+      //! \brief stored energies
+      mgis::span<real> stored_energies;
+      //! \brief dissipated energies
+      mgis::span<real> dissipated_energies;
+    };
+    /*!
+     * \return the buffers used by a state
+     * \param[in] s: state
+     */
+    static StateBuffers getStateBuffers(
+        const mgis::behaviour::MaterialStateManager &);
+    /*!
+     * \brief make a state use the given buffers
+     * \param[out] s: state
+     * \param[in] b: buffers
+     */
+    static void setStateBuffers(mgis::behaviour::MaterialStateManager &,
+                                const StateBuffers &);
+    /*!
+     * \return if the given buffers are the same
+     * \param[in] b1: first buffers
+     * \param[in] b2: second buffers
+     */
+    static bool areSameStateBuffers(const StateBuffers &,
+                                    const StateBuffers &);
+    /*!
+     * \brief copy the values of the given buffers into the storage of the
+     * snapshots which refer to them. This method must be called before
+     * overwriting those buffers.
+     * \param[in] b: buffers
+     */
+    void preserveStateSnapshots(const StateBuffers &);
+    //! \brief a snapshot of the state at the beginning of the time step
+    struct StateSnapshot {
+      //! \brief buffers holding the saved state
+      StateBuffers buffers;
+      /*!
+       * \brief storage of the saved state, used once the buffers holding the
+       * state when the snapshot was taken have been overwritten.
+       */
+      std::vector<real> storage;
+      //! \brief boolean stating if the saved state is held by `storage`
+      bool copied = false;
+    };
+    /*!
+     * \brief stack of snapshots. Only the first `number_of_state_snapshots`
+     * elements are used. The other ones are kept so that their storage is
+     * reused by the next snapshots.
+     */
+    std::vector<StateSnapshot> state_snapshots;
+    //! \brief number of snapshots on the stack
+    size_type number_of_state_snapshots = 0;
+    /*!
+     * \brief buffers which are not used by the states at the beginning and at
+     * the end of the time step when those states share their buffers.
+     */
+    StateBuffers spare_state_buffers;
+    /*!
+     * \brief boolean stating if the states at the beginning and at the end of
+     * the time step share their buffers.
+     */
+    bool shared_state_buffers = false;
+    /*!
+     * \brief compute the rotation matrices at each integration point if the
+     * rotation matrix is defined by partial quadrature functions.
+     */
+    void updateRotationMatrices();
     //! \brief copy constructor (disabled)
     Material(const Material &) = delete;
     //! \brief move constructor (disabled)
@@ -12,10 +12,16 @@
 
 namespace mfem_mgis {
 
-  //   inline std::array<real, 9u> Material::getRotationMatrix(
-  //       const size_type i) const {
-  //     return this->get_rotation_fct_ptr(this->r2D, this->r3D, i);
-  //   }  // end of getRotationMatrix
+  inline std::array<real, 9u> Material::getRotationMatrix(
+      const size_type i) const {
+    if (this->rotation_matrices.empty()) {
+      return this->get_rotation_fct_ptr(this->r2D, this->r3D, i);
+    }
+    assert(static_cast<std::size_t>(9 * (i + 1)) <=
+           this->rotation_matrices.size());
+    const auto *const r = this->rotation_matrices.data() + 9 * i;
+    return {r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], r[8]};
+  }  // end of getRotationMatrix
 
 }  // end of namespace mfem_mgis
 
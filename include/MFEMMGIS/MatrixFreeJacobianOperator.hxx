@@ -0,0 +1,99 @@
+/*!
+ * \file   include/MFEMMGIS/MatrixFreeJacobianOperator.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#ifndef LIB_MFEMMGIS_MATRIXFREEJACOBIANOPERATOR_HXX
+#define LIB_MFEMMGIS_MATRIXFREEJACOBIANOPERATOR_HXX
+
+#include "mfem/linalg/operator.hpp"
+#include "mfem/linalg/vector.hpp"
+#include "mfem/general/array.hpp"
+#include "MFEMMGIS/Config.hxx"
+
+namespace mfem_mgis {
+
+  // forward declaration
+  struct MultiMaterialNonLinearIntegrator;
+
+  /*!
+   * \brief an operator computing the product of the jacobian of a non linear
+   * evolution problem by a vector without assembling the jacobian matrix.
+   *
+   * The product is computed element by element using the tangent operator
+   * blocks stored at the integration points by the last integration of the
+   * behaviours (see `BehaviourIntegrator::updateJacobianAction`).
+   *
+   * The operator acts on the true degrees of freedom. The rows and the
+   * columns associated with the essential degrees of freedom are replaced by
+   * the ones of the identity, as done when the jacobian matrix is assembled.
+   *
+   * \note the operator is only consistent as long as the tangent operator
+   * blocks are not modified, i.e. until the next integration of the
+   * behaviours.
+   */
+  struct MFEM_MGIS_EXPORT MatrixFreeJacobianOperator final : mfem::Operator {
+    /*!
+     * \brief constructor
+     * \param[in] mi: multi-material integrator
+     * \param[in] fes: finite element space
+     * \param[in] P: prolongation operator from the true degrees of freedom to
+     * the degrees of freedom of the finite element space. A null pointer
+     * means that the prolongation operator is the identity.
+     * \param[in] ess_tdofs: list of the essential true degrees of freedom
+     *
+     * \note the integrator, the finite element space, the prolongation
+     * operator and the list of the essential degrees of freedom must outlive
+     * the operator.
+     */
+    MatrixFreeJacobianOperator(MultiMaterialNonLinearIntegrator &,
+                               const mfem::FiniteElementSpace &,
+                               const mfem::Operator *const,
+                               const mfem::Array<int> &);
+    /*!
+     * \brief set the estimate of the unknowns at which the jacobian is
+     * evaluated.
+     * \param[in] u: estimate of the unknowns, defined on the degrees of
+     * freedom of the finite element space
+     */
+    void setUnknowns(const mfem::Vector &);
+    //
+    void Mult(const mfem::Vector &, mfem::Vector &) const override;
+    /*!
+     * \brief compute the diagonal of the operator from the diagonals of the
+     * element stiffness matrices.
+     * \param[out] d: diagonal
+     *
+     * \note the element stiffness matrices are built one at a time, the
+     * jacobian matrix is never assembled.
+     * \note on non-conforming meshes, the returned diagonal is only an
+     * approximation of the diagonal of the operator.
+     */
+    void AssembleDiagonal(mfem::Vector &) const override;
+    //! \brief destructor
+    ~MatrixFreeJacobianOperator() override;
+
+   private:
+    //! \brief multi-material integrator
+    MultiMaterialNonLinearIntegrator &integrator;
+    //! \brief finite element space
+    const mfem::FiniteElementSpace &fespace;
+    //! \brief prolongation operator
+    const mfem::Operator *const prolongation;
+    //! \brief list of the essential true degrees of freedom
+    const mfem::Array<int> &essential_true_dofs;
+    //! \brief estimate of the unknowns
+    mfem::Vector unknowns;
+    //! \brief vector with null values on the essential degrees of freedom
+    mutable mfem::Vector constrained_vector;
+    //! \brief prolongation of the vector
+    mutable mfem::Vector prolongated_vector;
+    //! \brief product of the vector by the unconstrained jacobian
+    mutable mfem::Vector prolongated_result;
+  };  // end of struct MatrixFreeJacobianOperator
+
+}  // end of namespace mfem_mgis
+
+#endif /* LIB_MFEMMGIS_MATRIXFREEJACOBIANOPERATOR_HXX */
@@ -9,10 +9,12 @@
 #define LIB_MFEM_MGIS_MULTIMATERIALNONLINEARINTEGRATOR_HXX
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include "mfem/fem/nonlininteg.hpp"
 #include "MFEMMGIS/Config.hxx"
 #include "MFEMMGIS/Material.hxx"
+#include "MFEMMGIS/TimeStepScalingFactorHistogram.hxx"
 
 namespace mfem_mgis {
 
@@ -48,6 +50,36 @@ namespace mfem_mgis {
                              mfem::ElementTransformation &,
                              const mfem::Vector &,
                              mfem::DenseMatrix &) override;
+    /*!
+     * \brief compute the contributions of the given element to the residual
+     * and to the jacobian in a single pass.
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] u: current estimate of the unknowns
+     * \param[out] F: element contribution to the residual
+     * \param[out] K: element stiffness matrix
+     */
+    virtual void AssembleElementVectorAndGrad(const mfem::FiniteElement &,
+                                              mfem::ElementTransformation &,
+                                              const mfem::Vector &,
+                                              mfem::Vector &,
+                                              mfem::DenseMatrix &);
+    /*!
+     * \brief compute the product of the element stiffness matrix of the
+     * given element by a vector without building this matrix whenever
+     * possible.
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] u: current estimate of the unknowns
+     * \param[in] X: values of the vector on the element
+     * \param[out] Y: product of the element stiffness matrix by `X`
+     * \see `BehaviourIntegrator::updateJacobianAction`
+     */
+    virtual void updateJacobianAction(const mfem::FiniteElement &,
+                                      mfem::ElementTransformation &,
+                                      const mfem::Vector &,
+                                      const mfem::Vector &,
+                                      mfem::Vector &);
     /*!
      * \brief integrate the behaviour for the current estimate of the unknowns
      * at the end of the time step.
@@ -60,6 +92,27 @@ namespace mfem_mgis {
                            mfem::ElementTransformation &,
                            const mfem::Vector &,
                            const IntegrationType);
+    /*!
+     * \brief compute the gradients at the integration points of the given
+     * element for the current estimate of the unknowns at the end of the time
+     * step.
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] u: current estimate of the unknowns
+     * \param[in] it: integration type
+     */
+    virtual void computeGradients(const mfem::FiniteElement &,
+                                  mfem::ElementTransformation &,
+                                  const mfem::Vector &,
+                                  const IntegrationType);
+    /*!
+     * \brief integrate the behaviours of all materials once the gradients
+     * have been computed (see the `computeGradients` method).
+     * \param[in] it: integration type
+     * \param[in] nthreads: number of threads
+     */
+    virtual bool performsBehaviourIntegration(const IntegrationType,
+                                              const size_type);
     /*!
      * \brief set the value of the time increment
      * \param[in] dt: time increment
@@ -71,6 +124,17 @@ namespace mfem_mgis {
      * \param[in] dt: time increment
      */
     virtual void setup(const real, const real);
+    /*!
+     * \brief build the geometric caches of the quadrature spaces of all
+     * materials.
+     * \see `PartialQuadratureSpace::buildGeometricCache`
+     */
+    virtual void buildGeometricCaches();
+    /*!
+     * \return the memory used by the geometric caches of all materials, in
+     * bytes
+     */
+    virtual std::size_t getGeometricCachesMemoryUsage() const;
     /*!
      * \brief add a new material
      * \param[in] n: name of the behaviour integrator
@@ -106,19 +170,54 @@ namespace mfem_mgis {
     /*!
      * \brief revert the internal state variables.
      *
-     * The values of the internal state variables at the beginning of the time
-     * step are copied on the values of the internal state variables at
-     * end of the time step.
+     * The state at the end of the time step of each material is reset to the
+     * state at the beginning of the time step, without copy (see
+     * `Material::revertStates`).
      */
     virtual void revert();
     /*!
      * \brief update the internal state variables.
      *
-     * The values of the internal state variables at the end of the time step
-     * are copied on the values of the internal state variables at beginning of
-     * the time step.
+     * The state at the end of the time step of each material becomes the
+     * state at the beginning of the time step, without copy (see
+     * `Material::updateStates`).
      */
     virtual void update();
+    /*!
+     * \brief save the states of all materials at the beginning of the time
+     * step on top of their stacks of snapshots.
+     * \see `Material::pushStateSnapshot`
+     */
+    virtual void pushStateSnapshot();
+    /*!
+     * \brief restore the states of all materials saved by their last
+     * snapshots.
+     * \see `Material::restoreStateSnapshot`
+     */
+    virtual void restoreStateSnapshot();
+    /*!
+     * \brief remove the last snapshots of all materials.
+     * \see `Material::popStateSnapshot`
+     */
+    virtual void popStateSnapshot();
+    /*!
+     * \brief reset the time step scaling factors of all behaviour integrators
+     * before a new integration of the behaviours.
+     */
+    virtual void resetTimeStepScalingFactor();
+    /*!
+     * \return the minimum of the time step scaling factors of all behaviour
+     * integrators.
+     * \see `BehaviourIntegrator::getTimeStepScalingFactor`
+     */
+    virtual real getTimeStepScalingFactor() const;
+    /*!
+     * \return the histogram of the time step scaling factors of all
+     * behaviour integrators.
+     * \see `BehaviourIntegrator::getTimeStepScalingFactorHistogram`
+     */
+    virtual TimeStepScalingFactorHistogram getTimeStepScalingFactorHistogram()
+        const;
     /*!
      * \brief set the macroscropic gradients
      * \param[in] g: macroscopic gradients
@@ -8,16 +8,163 @@
 #ifndef LIB_MFEM_MGIS_NEWTONSOLVER_HXX
 #define LIB_MFEM_MGIS_NEWTONSOLVER_HXX
 
+#include <memory>
 #include <vector>
+#include <string>
 #include <functional>
 #include "mfem/linalg/solvers.hpp"
 #include "MFEMMGIS/Config.hxx"
+#include "MFEMMGIS/IntegrationType.hxx"
 #include "MFEMMGIS/NonLinearEvolutionProblemImplementation.hxx"
 
 namespace mfem_mgis {
 
+  // forward declaration
+  struct Parameters;
+
   //! \brief custom implementation of the Newton Solver
   struct NewtonSolver : public mfem::IterativeSolver {
+    /*!
+     * \brief name of the parameter selecting when the jacobian matrix is
+     * updated. The following values are allowed:
+     *
+     * - `"EveryIteration"`: the jacobian matrix is updated at each iteration
+     *   (default).
+     * - `"Periodic"`: the jacobian matrix is updated every `n` iterations,
+     *   where `n` is given by the `JacobianUpdatePeriod` parameter. The
+     *   jacobian matrix is always updated at the first iteration of each
+     *   resolution.
+     * - `"OnSlowConvergence"`: the jacobian matrix is kept across iterations
+     *   and time steps as long as the ratio of the norms of two successive
+     *   residuals is lower than the `JacobianUpdateConvergenceRateThreshold`
+     *   parameter.
+     * - `"InitialTangent"`: the jacobian matrix is computed once, at the
+     *   first iteration of the first resolution, and never updated.
+     *
+     * When the jacobian matrix is not updated, the behaviours are integrated
+     * without computing the tangent operator. If the linear solver fails with
+     * a reused jacobian matrix, the behaviours are integrated again and the
+     * jacobian matrix is updated before retrying.
+     *
+     * \note policies other than `"EveryIteration"` are not compatible with
+     * the fused assembly of the residual and of the jacobian matrix.
+     */
+    static const char *const JacobianUpdatePolicy;
+    /*!
+     * \brief name of the parameter giving the number of iterations between
+     * two updates of the jacobian matrix for the `"Periodic"` policy. The
+     * default value is 2.
+     */
+    static const char *const JacobianUpdatePeriod;
+    /*!
+     * \brief name of the parameter giving the maximum ratio of the norms of
+     * two successive residuals above which the jacobian matrix is updated for
+     * the `"OnSlowConvergence"` policy. The default value is 0.5.
+     */
+    static const char *const JacobianUpdateConvergenceRateThreshold;
+    /*!
+     * \brief name of the parameter selecting the line search applied to the
+     * Newton correction. The following values are allowed:
+     *
+     * - `"None"`: the full correction is applied (default).
+     * - `"Backtracking"`: the step is reduced, using a quadratic
+     *   interpolation, until the norm of the residual decreases sufficiently.
+     * - `"CriticalPoint"`: the step is chosen, using secant iterations, to
+     *   cancel the projection of the residual on the Newton correction.
+     *
+     * In both cases, the full step is tried first and kept if it decreases
+     * sufficiently the norm of the residual. The other trials are integrated
+     * without computing the tangent operator. A step for which the
+     * integration of the behaviours fails is halved.
+     */
+    static const char *const LineSearch;
+    /*!
+     * \brief name of the parameter giving the maximum number of trials of
+     * the line search, in addition to the full step. The default value is 4.
+     */
+    static const char *const LineSearchMaximumNumberOfIterations;
+    /*!
+     * \brief name of the parameter used to replace the jacobian matrix, in
+     * the computation of the Newton correction, by a finite difference
+     * approximation of the directional derivative of the residual.
+     *
+     * The linear system is solved by a flexible GMRES solver, each product by
+     * the jacobian requiring an evaluation of the residual at a perturbed
+     * estimate of the unknowns. The linear solver set by `setLinearSolver`
+     * is used as a preconditioner. The jacobian matrix it holds is updated
+     * following the `JacobianUpdatePolicy` parameter, which allows to
+     * compute and assemble the tangent operator only occasionally.
+     *
+     * The evaluation of the residual at a perturbed estimate integrates the
+     * behaviours without computing the tangent operator. The state at the
+     * beginning of the time step and the time step scaling factor are not
+     * affected. The state at the end of the time step is overwritten, which
+     * is harmless since the behaviours are always integrated again at the
+     * next estimate of the unknowns.
+     *
+     * \note this parameter is not compatible with the fused assembly nor
+     * with the matrix-free jacobian, which are both invalidated by the
+     * evaluation of the residual at a perturbed estimate.
+     */
+    static const char *const JacobianFreeNewtonKrylov;
+    /*!
+     * \brief name of the parameter giving the relative perturbation used to
+     * compute the directional derivative of the residual in the
+     * jacobian-free Newton-Krylov mode. The perturbation of the unknowns
+     * `u` in the direction `v` is `e * (1 + ||u||) / ||v||`, where `e` is
+     * the value of this parameter. The default value is 1e-7.
+     */
+    static const char *const JacobianFreeNewtonKrylovPerturbation;
+    /*!
+     * \brief name of the parameter giving the relative tolerance of the
+     * flexible GMRES solver used in the jacobian-free Newton-Krylov mode.
+     * The default value is 1e-6.
+     */
+    static const char *const JacobianFreeNewtonKrylovRelativeTolerance;
+    /*!
+     * \brief name of the parameter giving the maximum number of iterations of
+     * the flexible GMRES solver used in the jacobian-free Newton-Krylov mode.
+     * The default value is 100.
+     */
+    static const char *const JacobianFreeNewtonKrylovMaximumNumberOfIterations;
+    /*!
+     * \brief name of the parameter selecting how the relative tolerance of
+     * the iterative linear solver, i.e. the forcing term of the inexact
+     * Newton method, is chosen. The following values are allowed:
+     *
+     * - `"Constant"`: the relative tolerance of the linear solver is not
+     *   modified (default).
+     * - `"EisenstatWalker"`: the forcing term is computed from the ratio of
+     *   the norms of the last two residuals, following the second choice of
+     *   Eisenstat and Walker, with their safeguard against a too fast
+     *   decrease of the forcing term. The forcing term is also kept large
+     *   enough not to solve the linear system beyond the accuracy required
+     *   by the convergence criterion of the Newton solver. It is bounded by
+     *   the `ForcingTermMinimumValue` and `ForcingTermMaximumValue`
+     *   parameters.
+     *
+     * The forcing term is applied to the flexible GMRES solver in the
+     * jacobian-free Newton-Krylov mode and to the linear solver otherwise.
+     * It has no effect on direct linear solvers.
+     *
+     * \note with the `"EisenstatWalker"` policy, the relative tolerance of
+     * the linear solver is overwritten.
+     */
+    static const char *const ForcingTerm;
+    /*!
+     * \brief name of the parameter giving the maximum value of the forcing
+     * term for the `"EisenstatWalker"` policy. The default value is 0.9.
+     */
+    static const char *const ForcingTermMaximumValue;
+    /*!
+     * \brief name of the parameter giving the minimum value of the forcing
+     * term for the `"EisenstatWalker"` policy. This value is also used as the
+     * reference relative tolerance to estimate the number of iterations of
+     * the linear solver saved by the policy. The default value is 1e-12.
+     */
+    static const char *const ForcingTermMinimumValue;
+    //! \return the list of parameters specific to the Newton solver
+    static std::vector<std::string> getParametersList();
 #ifdef MFEM_USE_MPI
     //! \brief default constructor
     NewtonSolver(NonLinearEvolutionProblemImplementation<true> &);
@@ -31,6 +178,12 @@ namespace mfem_mgis {
      * \param[in] s: linear solver
      */
     virtual void setLinearSolver(LinearSolver &);
+    /*!
+     * \brief set the parameters specific to the Newton solver
+     * \param[in] params: parameters
+     * \see `getParametersList` for the list of allowed parameters
+     */
+    virtual void setParameters(const Parameters &);
     /*!
      * \brief add a new action called when a new estimate of the unknowns is
      * available.
@@ -39,7 +192,8 @@ namespace mfem_mgis {
     virtual void addNewUnknownsEstimateActions(
         std::function<bool(const mfem::Vector &)>);
     /*!
-     * \brief compute the correction associated with the given residual
+     * \brief compute the correction associated with the given residual,
+     * after having updated the jacobian matrix.
      * \param[in] c: Newton' correction
      * \param[in] r: residual
      * \param[in] u: current estimate of the unknowns
@@ -47,6 +201,24 @@ namespace mfem_mgis {
     bool computeNewtonCorrection(mfem::Vector &,
                                  const mfem::Vector &,
                                  const mfem::Vector &) const;
+    /*!
+     * \brief solve a linear system whose operator is the jacobian at the
+     * given estimate of the unknowns, after having updated the jacobian
+     * matrix.
+     * \param[in] c: solution
+     * \param[in] r: right hand side
+     * \param[in] u: estimate of the unknowns
+     *
+     * \note contrary to `computeNewtonCorrection`, the jacobian-free
+     * Newton-Krylov method is never used, since the finite difference
+     * approximation of the jacobian is only consistent if the right hand
+     * side is the residual of the non linear problem at `u`. This method is
+     * thus meant to solve linearised problems, such as the one defining the
+     * prediction of the unknowns at the end of the time step.
+     */
+    bool solveLinearisedProblem(mfem::Vector &,
+                                const mfem::Vector &,
+                                const mfem::Vector &) const;
     /*!
      * \brief compute the residual
      * \param[in] r: residual
@@ -57,6 +229,22 @@ namespace mfem_mgis {
     mfem::Operator &getJacobian(const mfem::Vector&) const;
     //! \brief get initial norm
     virtual real GetInitialNorm() const;
+    /*!
+     * \return the number of iterations of the iterative linear solver during
+     * the last resolution.
+     */
+    virtual size_type getNumberOfLinearSolverIterations() const;
+    /*!
+     * \return an estimate of the number of iterations of the iterative
+     * linear solver saved during the last resolution by the
+     * `"EisenstatWalker"` policy, compared to linear solves with the
+     * relative tolerance set on the linear solver.
+     *
+     * The estimate assumes that the norm of the residual of the linear
+     * solver decreases geometrically, at the rate observed during each
+     * solve.
+     */
+    virtual size_type getEstimatedNumberOfSavedLinearSolverIterations() const;
     //
     [[noreturn]] void SetPreconditioner(Solver &) override;
     [[noreturn]] void SetOperator(const mfem::Operator &) override;
@@ -66,6 +254,87 @@ namespace mfem_mgis {
     ~NewtonSolver() override;
 
    protected:
+    //! \brief line searches
+    enum struct LineSearchType { NONE, BACKTRACKING, CRITICAL_POINT };
+    //! \brief finite difference approximation of the jacobian
+    struct FiniteDifferenceJacobian;
+    //! \brief policies for the choice of the forcing term
+    enum struct ForcingTermType { CONSTANT, EISENSTAT_WALKER };
+    //! \brief policies for the update of the jacobian matrix
+    enum struct JacobianUpdatePolicyType {
+      EVERY_ITERATION,
+      PERIODIC,
+      ON_SLOW_CONVERGENCE,
+      INITIAL_TANGENT
+    };
+    /*!
+     * \brief create the finite difference approximation of the jacobian and
+     * set the default parameters of the linear solver used in the
+     * jacobian-free Newton-Krylov mode.
+     */
+    void initializeJacobianFreeLinearSolver();
+    /*!
+     * \return the iterative linear solver used to compute the Newton
+     * correction, or a null pointer if the linear solver is not iterative.
+     */
+    mfem::IterativeSolver *getIterativeLinearSolver() const;
+    /*!
+     * \brief compute the forcing term for the `"EisenstatWalker"` policy and
+     * set the relative tolerance of the iterative linear solver accordingly.
+     * \param[in] norm: norm of the current residual
+     * \param[in] previous_norm: norm of the previous residual, or zero at
+     * the first iteration
+     * \param[in] norm_goal: norm of the residual required for convergence
+     */
+    void updateForcingTerm(const real, const real, const real) const;
+    /*!
+     * \brief update the number of iterations of the linear solver, and the
+     * estimate of the number of saved iterations, after a linear solve.
+     */
+    void updateLinearSolverStatistics() const;
+    /*!
+     * \brief solve the linear system using the last jacobian matrix passed
+     * to the linear solver.
+     * \param[in] c: Newton' correction
+     * \param[in] r: residual
+     */
+    bool solveLinearSystem(mfem::Vector &, const mfem::Vector &) const;
+    /*!
+     * \brief solve the linear system using the finite difference
+     * approximation of the jacobian, preconditioned by the linear solver.
+     * \param[in] c: Newton' correction
+     * \param[in] r: residual
+     * \param[in] u: current estimate of the unknowns
+     */
+    bool solveJacobianFreeLinearSystem(mfem::Vector &,
+                                       const mfem::Vector &,
+                                       const mfem::Vector &) const;
+    /*!
+     * \brief update the estimate of the unknowns using the Newton correction
+     * and the line search, and compute the associated residual.
+     * \return if the update succeeded
+     * \param[in,out] u: estimate of the unknowns
+     * \param[out] r: residual at the new estimate of the unknowns
+     * \param[in] c: Newton' correction
+     * \param[in] norm: norm of the residual at the current estimate of the
+     * unknowns
+     */
+    bool applyNewtonCorrection(mfem::Vector &,
+                               mfem::Vector &,
+                               const mfem::Vector &,
+                               const real) const;
+    /*!
+     * \return if the jacobian matrix must be updated at the given iteration
+     * \param[in] i: iteration number
+     * \param[in] rate: ratio of the norms of the last two residuals, or zero
+     * if not available
+     */
+    bool mustUpdateJacobian(const size_type, const real) const;
+    /*!
+     * \return the integration type used to integrate the behaviours for a new
+     * estimate of the unknowns
+     */
+    IntegrationType getIntegrationType() const;
     /*!
      * \brief method called when a new estimate of the unknowns is available.
      * \param[in] u: new unknown estimate
@@ -78,6 +347,57 @@ namespace mfem_mgis {
     std::vector<std::function<bool(const mfem::Vector &)>> nue_actions;
     //! \brief norm of the first estimation of the residual
     mutable real initial_norm;
+    //! \brief policy used to update the jacobian matrix
+    JacobianUpdatePolicyType jacobian_update_policy =
+        JacobianUpdatePolicyType::EVERY_ITERATION;
+    //! \brief number of iterations between two updates of the jacobian matrix
+    size_type jacobian_update_period = 2;
+    //! \brief convergence rate above which the jacobian matrix is updated
+    real jacobian_update_convergence_rate_threshold = real(0.5);
+    //! \brief line search
+    LineSearchType line_search = LineSearchType::NONE;
+    //! \brief maximum number of trials of the line search
+    size_type line_search_maximum_number_of_iterations = 4;
+    //! \brief estimate of the unknowns at the beginning of the line search
+    mutable mfem::Vector line_search_unknowns;
+    /*!
+     * \brief function evaluating the residual at a trial estimate of the
+     * unknowns, used by the jacobian-free Newton-Krylov mode
+     */
+    std::function<bool(mfem::Vector &, const mfem::Vector &)>
+        trial_residual_evaluator;
+    //! \brief list of the essential true degrees of freedom
+    const mfem::Array<int> *essential_true_dofs = nullptr;
+    //! \brief boolean stating if the jacobian-free Newton-Krylov mode is used
+    bool use_jacobian_free_newton_krylov = false;
+    //! \brief relative perturbation used by the jacobian-free mode
+    real jacobian_free_newton_krylov_perturbation = real(1e-7);
+    //! \brief finite difference approximation of the jacobian
+    mutable std::unique_ptr<FiniteDifferenceJacobian> jfnk_jacobian;
+    //! \brief linear solver used in the jacobian-free mode
+    std::unique_ptr<mfem::FGMRESSolver> jfnk_linear_solver;
+    //! \brief policy used to choose the forcing term
+    ForcingTermType forcing_term_policy = ForcingTermType::CONSTANT;
+    //! \brief maximum value of the forcing term
+    real forcing_term_maximum_value = real(0.9);
+    //! \brief minimum value of the forcing term
+    real forcing_term_minimum_value = real(1e-12);
+    //! \brief last forcing term
+    mutable real forcing_term = real{0};
+    /*!
+     * \brief relative tolerance of the iterative linear solver at the
+     * beginning of the last resolution. This tolerance is modified by the
+     * `"EisenstatWalker"` policy and restored at the end of the resolution.
+     */
+    mutable real linear_solver_relative_tolerance = real{0};
+    //! \brief number of iterations of the linear solver
+    mutable size_type linear_solver_iterations = size_type{};
+    //! \brief estimate of the number of saved iterations of the linear solver
+    mutable real saved_linear_solver_iterations = real{0};
+    //! \brief boolean stating if the linear solver holds a jacobian matrix
+    mutable bool jacobian_available = false;
+    //! \brief boolean stating if the jacobian matrix is updated
+    mutable bool update_jacobian = true;
   };  // end of struct NewtonSolver
 
 }  // end of namespace mfem_mgis
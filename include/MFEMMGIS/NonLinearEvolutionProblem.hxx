@@ -111,6 +111,10 @@ namespace mfem_mgis {
     BehaviourIntegrator &getBehaviourIntegrator(const size_type) override;
     void revert() override;
     void update() override;
+    void pushSnapshot() override;
+    void restoreSnapshot() override;
+    void popSnapshot() override;
+    size_type getNumberOfSnapshots() const override;
     NonLinearResolutionOutput solve(const real, const real) override;
     //! \brief destructor
     ~NonLinearEvolutionProblem() override;
@@ -58,6 +58,7 @@ namespace mfem_mgis {
     const FiniteElementSpace<true>& getFiniteElementSpace() const;
     //
     void Mult(const mfem::Vector&, mfem::Vector&) const override;
+    mfem::Operator& GetGradient(const mfem::Vector&) const override;
     /*!
      * \brief add a new post-processing
      * \param[in] p: post-processing
@@ -65,6 +66,21 @@ namespace mfem_mgis {
     virtual void addPostProcessing(std::unique_ptr<PostProcessing<true>>);
     //
     bool integrate(const mfem::Vector&, const IntegrationType) override;
+    /*!
+     * \brief compute the residual at a trial estimate of the unknowns.
+     * \return if the integration of the behaviours succeeded
+     * \param[out] r: residual
+     * \param[in] u: trial estimate of the unknowns
+     *
+     * The behaviours are integrated without computing the tangent operator.
+     * The state at the beginning of the time step and the time step scaling
+     * factor are not modified. The state at the end of the time step is
+     * overwritten and is only meaningful until the next integration.
+     *
+     * \note this method is meant to be used by the jacobian-free mode of the
+     * Newton solver.
+     */
+    bool evaluateTrialResidual(mfem::Vector&, const mfem::Vector&);
     void setLinearSolver(std::string_view, const Parameters&) override;
     void addPostProcessing(
         const std::function<void(const real, const real)>&) override;
@@ -74,6 +90,35 @@ namespace mfem_mgis {
     ~NonLinearEvolutionProblemImplementation() override;
 
    protected:
+    /*!
+     * \return if the fused assembly of the residual and of the jacobian
+     * matrix can be used, i.e. if it has been requested and if the only
+     * integrator is the multi-material integrator.
+     */
+    bool useFusedAssembly() const;
+    /*!
+     * \return if the scatter maps can be used to assemble the jacobian
+     * matrix, i.e. if they have been requested and if the only integrator is
+     * the multi-material integrator.
+     */
+    bool useScatterMaps() const;
+    /*!
+     * \return if the matrix-free jacobian can be used, i.e. if it has been
+     * requested and if the only integrator is the multi-material integrator.
+     */
+    bool useMatrixFreeJacobian() const;
+    /*!
+     * \return the matrix-free jacobian for the given estimate of the
+     * unknowns
+     * \param[in] u: current estimate of the unknowns
+     */
+    mfem::Operator& getMatrixFreeJacobian(const mfem::Vector&) const;
+    /*!
+     * \brief allocate the jacobian matrix if required and set its values to
+     * zero. If the scatter maps are used, the sparsity pattern of the
+     * jacobian matrix and the scatter maps are built at the first call.
+     */
+    void initializeJacobianMatrix() const;
     //
     void markDegreesOfFreedomHandledByDirichletBoundaryConditions(
         std::vector<size_type>) override;
@@ -107,6 +152,9 @@ namespace mfem_mgis {
     FiniteElementSpace<false>& getFiniteElementSpace();
     //! \return the finite element space
     const FiniteElementSpace<false>& getFiniteElementSpace() const;
+    //
+    void Mult(const mfem::Vector&, mfem::Vector&) const override;
+    mfem::Operator& GetGradient(const mfem::Vector&) const override;
     /*!
      * \brief add a new post-processing
      * \param[in] p: post-processing
@@ -115,6 +163,21 @@ namespace mfem_mgis {
     //
     void setLinearSolver(std::string_view, const Parameters&) override;
     bool integrate(const mfem::Vector&, const IntegrationType) override;
+    /*!
+     * \brief compute the residual at a trial estimate of the unknowns.
+     * \return if the integration of the behaviours succeeded
+     * \param[out] r: residual
+     * \param[in] u: trial estimate of the unknowns
+     *
+     * The behaviours are integrated without computing the tangent operator.
+     * The state at the beginning of the time step and the time step scaling
+     * factor are not modified. The state at the end of the time step is
+     * overwritten and is only meaningful until the next integration.
+     *
+     * \note this method is meant to be used by the jacobian-free mode of the
+     * Newton solver.
+     */
+    bool evaluateTrialResidual(mfem::Vector&, const mfem::Vector&);
     void addPostProcessing(
         const std::function<void(const real, const real)>&) override;
     void addPostProcessing(std::string_view, const Parameters&) override;
@@ -123,11 +186,70 @@ namespace mfem_mgis {
     ~NonLinearEvolutionProblemImplementation() override;
 
    protected:
+    /*!
+     * \return if the fused assembly of the residual and of the jacobian
+     * matrix can be used, i.e. if it has been requested and if the only
+     * integrator is the multi-material integrator.
+     */
+    bool useFusedAssembly() const;
+    /*!
+     * \return if the scatter maps can be used to assemble the jacobian
+     * matrix, i.e. if they have been requested and if the only integrator is
+     * the multi-material integrator.
+     */
+    bool useScatterMaps() const;
+    /*!
+     * \return if the matrix-free jacobian can be used, i.e. if it has been
+     * requested and if the only integrator is the multi-material integrator.
+     */
+    bool useMatrixFreeJacobian() const;
+    /*!
+     * \return the matrix-free jacobian for the given estimate of the
+     * unknowns
+     * \param[in] u: current estimate of the unknowns
+     */
+    mfem::Operator& getMatrixFreeJacobian(const mfem::Vector&) const;
+    /*!
+     * \brief allocate the jacobian matrix if required and set its values to
+     * zero. If the scatter maps are used, the sparsity pattern of the
+     * jacobian matrix and the scatter maps are built at the first call.
+     */
+    void initializeJacobianMatrix() const;
+    /*!
+     * \return if the residual and the jacobian matrix are assembled using
+     * more than one thread, i.e. if more than one thread has been requested,
+     * if the multi-threaded assembly has not been disabled and if the only
+     * integrator is the multi-material integrator.
+     */
+    bool useMultiThreadedAssembly() const;
+    /*!
+     * \brief assemble the residual and/or the jacobian matrix using more
+     * than one thread.
+     * \param[out] r: residual, not restricted to the true degrees of
+     * freedom, if not null
+     * \param[out] K: jacobian matrix, if not null. The scatter maps must
+     * have been built.
+     * \param[in] u: current estimate of the unknowns (prolongated)
+     */
+    void assembleUsingThreads(mfem::Vector* const,
+                              mfem::SparseMatrix* const,
+                              const mfem::Vector&) const;
     //
     void markDegreesOfFreedomHandledByDirichletBoundaryConditions(
         std::vector<size_type>) override;
     //! \brief registred post-processings
     std::vector<std::unique_ptr<PostProcessing<false>>> postprocessings;
+    /*!
+     * \brief groups of elements sharing no degree of freedom, built at the
+     * first multi-threaded assembly using the `ElementColouring` strategy.
+     */
+    mutable std::vector<std::vector<size_type>> element_colours;
+    /*!
+     * \brief buffers used by the threads to accumulate the residual and the
+     * values of the jacobian matrix when the `PrivateBuffers` strategy is
+     * used.
+     */
+    mutable std::vector<std::vector<real>> assembly_buffers;
   };  // end of struct NonLinearEvolutionProblemImplementation
 
   /*!
@@ -49,39 +49,37 @@ namespace mfem_mgis {
       NonLinearEvolutionProblemImplementation<parallel>& p) {
     auto nmax = p.getFiniteElementSpace().GetMesh()->attributes.Max() + 1;
     std::vector<std::vector<mfem_mgis::real>> stress_integrals(nmax);
-    const auto& mis = p.getAssignedMaterialsIdentifiers();
-    for (const auto& mi : mis) {
-      const auto& bi = p.getBehaviourIntegrator(mi);
-      const auto& s1 = bi.getMaterial().s1;
-      const auto thsize = s1.thermodynamic_forces_stride;
-      stress_integrals[mi].resize(thsize, mfem_mgis::real(0));
-    }
     std::vector<mfem_mgis::real> volumes(stress_integrals.size(),
                                          mfem_mgis::real(0));
     const auto& fes = p.getFiniteElementSpace();
-    for (mfem_mgis::size_type i = 0; i < fes.GetNE(); i++) {
-      auto& e = *(fes.GetFE(i));
-      auto& tr = *(fes.GetElementTransformation(i));
-      const auto& bi = p.getBehaviourIntegrator(tr.Attribute);
-      const auto& ir = bi.getIntegrationRule(e, tr);
+    const auto& mis = p.getAssignedMaterialsIdentifiers();
+    for (const auto& mi : mis) {
+      const auto& bi = p.getBehaviourIntegrator(mi);
       const auto& m = bi.getMaterial();
-      const auto& s1 = bi.getMaterial().s1;
+      const auto& s1 = m.s1;
       const auto& qspace = m.getPartialQuadratureSpace();
       const auto thsize =
           static_cast<mfem_mgis::size_type>(s1.thermodynamic_forces_stride);
-      auto& s = stress_integrals[tr.Attribute];
-      auto& v = volumes[tr.Attribute];
-      const auto eoffset = qspace.getOffset(tr.ElementNo);
-      for (mfem_mgis::size_type j = 0; j < ir.GetNPoints(); j++) {
-        const auto o = eoffset + j;
-        const auto& ip = ir.IntPoint(j);
-        tr.SetIntPoint(&ip);
-        const auto thf = s1.thermodynamic_forces.subspan(o * thsize, thsize);
-        const auto w = bi.getIntegrationPointWeight(tr, ip);
-        for (mfem_mgis::size_type k = 0; k != thsize; ++k) {
-          s[k] += w * thf[k];
+      auto& s = stress_integrals[mi];
+      auto& v = volumes[mi];
+      s.resize(thsize, mfem_mgis::real(0));
+      // loop over the elements of the material
+      for (const auto i : qspace.getElements()) {
+        const auto& e = *(fes.GetFE(i));
+        auto& tr = *(fes.GetElementTransformation(i));
+        const auto& ir = bi.getIntegrationRule(e, tr);
+        const auto eoffset = qspace.getOffset(i);
+        for (mfem_mgis::size_type j = 0; j < ir.GetNPoints(); j++) {
+          const auto o = eoffset + j;
+          const auto& ip = ir.IntPoint(j);
+          tr.SetIntPoint(&ip);
+          const auto thf = s1.thermodynamic_forces.subspan(o * thsize, thsize);
+          const auto w = bi.getIntegrationPointWeight(tr, ip);
+          for (mfem_mgis::size_type k = 0; k != thsize; ++k) {
+            s[k] += w * thf[k];
+          }
+          v += w;
         }
-        v += w;
       }
     }
     return {stress_integrals, volumes};
@@ -10,12 +10,15 @@
 
 #include <memory>
 #include <vector>
+#include <cstddef>
+#include <optional>
 #include "mfem/linalg/vector.hpp"
 #ifdef MFEM_USE_PETSC
 #include "mfem/linalg/petsc.hpp"
 #endif /* MFEM_USE_PETSC */
 
 #include "MFEMMGIS/Config.hxx"
+#include "MFEMMGIS/IntegrationType.hxx"
 #include "MFEMMGIS/AbstractNonLinearEvolutionProblem.hxx"
 
 namespace mfem_mgis {
@@ -35,9 +38,9 @@ namespace mfem_mgis {
   // forward declaration
   struct NewtonSolver;
   // forward declaration
-  enum struct IntegrationType;
-  // forward declaration
   struct LinearSolverHandler;
+  // forward declaration
+  struct MatrixFreeJacobianOperator;
 
   /*!
    * \brief class for solving non linear evolution problems.
@@ -54,6 +57,142 @@ namespace mfem_mgis {
      * this use of the `MultiMaterialNonLinearIntegrator` class
      */
     static const char* const UseMultiMaterialNonLinearIntegrator;
+    /*!
+     * \brief name of the parameter used to specify the number of threads
+     * used to integrate the behaviours over the elements.
+     *
+     * \note this parameter is only meaningful if the support of OpenMP has
+     * been enabled. By default, the integration is sequential.
+     */
+    static const char* const NumberOfThreads;
+    /*!
+     * \brief name of the parameter used to activate the batched integration
+     * of the behaviours.
+     *
+     * In this case, the integration is performed in two passes: the gradients
+     * are first computed on every element and the behaviours are then
+     * integrated at once on every material.
+     */
+    static const char* const UseBatchedBehaviourIntegration;
+    /*!
+     * \brief name of the parameter used to precompute and store the
+     * derivatives of the shape functions and the weights of the integration
+     * points.
+     *
+     * This trades memory for a faster assembly of the residual and of the
+     * jacobian matrix. The memory used by those caches is returned by the
+     * `MultiMaterialNonLinearIntegrator::getGeometricCachesMemoryUsage`
+     * method.
+     */
+    static const char* const UseGeometricCache;
+    /*!
+     * \brief name of the parameter used to assemble the residual and the
+     * jacobian matrix in a single loop over the elements.
+     *
+     * In this case, each evaluation of the residual also assembles the
+     * jacobian matrix, which is then reused if the jacobian is requested for
+     * the same estimate of the unknowns, as done by the Newton solver.
+     *
+     * \note the jacobian matrix is assembled uselessly when the Newton solver
+     * converges.
+     * \note only the residual is assembled if the last integration of the
+     * behaviours did not compute the tangent operators.
+     * \note this parameter is not compatible with PETSc.
+     */
+    static const char* const UseFusedAssembly;
+    /*!
+     * \brief name of the parameter used to build the sparsity pattern of the
+     * jacobian matrix once for all and to precompute, for each element, the
+     * positions of the entries of the elementary matrix in this pattern.
+     *
+     * In this case, the assembly of the jacobian matrix does not require to
+     * search the positions of the entries of the elementary matrices. This
+     * assumes that the mesh is not modified during the computation.
+     */
+    static const char* const UseScatterMaps;
+    /*!
+     * \brief name of the parameter selecting how the residual and the
+     * jacobian matrix are assembled in sequential computations when more
+     * than one thread is used (see the `NumberOfThreads` parameter). Valid
+     * values are:
+     *
+     * - `ElementColouring` (default): the elements are partitioned in groups
+     *   of elements sharing no degree of freedom. The elements of a group are
+     *   assembled concurrently without any synchronisation.
+     * - `PrivateBuffers`: each thread assembles its elements in private
+     *   buffers which are summed afterwards. This requires more memory but
+     *   may be more efficient if the colouring leads to many small groups.
+     * - `None`: the assembly is performed by one thread.
+     *
+     * \note the jacobian matrix is assembled using the scatter maps (see the
+     * `UseScatterMaps` parameter) in the first two cases.
+     * \note this parameter is ignored in parallel computations.
+     */
+    static const char* const MultiThreadedAssembly;
+    /*!
+     * \brief name of the parameter used to replace the jacobian matrix by an
+     * operator computing its product by a vector element by element from the
+     * tangent operator blocks stored at the integration points (see the
+     * `MatrixFreeJacobianOperator` class).
+     *
+     * The jacobian matrix is never assembled, which saves memory and the
+     * cost of the assembly, notably for high order elements.
+     *
+     * \note the linear solver must be an iterative solver that only
+     * requires the product of the jacobian by a vector, such as the `CGSolver`
+     * or the `GMRESSolver` solvers. The only compatible preconditioner is the
+     * `Jacobi` preconditioner.
+     * \note the jacobian must be updated at each iteration of the Newton
+     * solver, since the tangent operator blocks are overwritten by each
+     * integration of the behaviours.
+     * \note line searches are not supported, since the behaviours are
+     * integrated at trial points which are not accepted, so that the
+     * tangent operator blocks would not correspond to the accepted point.
+     * \note this parameter is not compatible with the fused assembly nor
+     * with PETSc.
+     */
+    static const char* const UseMatrixFreeJacobian;
+    /*!
+     * \brief name of the parameter used to specify the number of levels of
+     * the local substepping (see the
+     * `BehaviourIntegrator::setNumberOfLocalSubsteppingLevels` method).
+     *
+     * If this number is strictly positive, the integration points where the
+     * integration of the behaviour failed are integrated again by dividing
+     * the time step in substeps, rather than reporting a failure which
+     * leads to a revert of the whole time step. The number of successful
+     * recoveries is reported by the `LocalSubsteppingRecoveries` counter of
+     * the profiler.
+     *
+     * \note if the batched integration of the behaviours fails (see the
+     * `UseBatchedBehaviourIntegration` parameter), all the integration points
+     * of the material are integrated again one by one, using the local
+     * substepping where needed.
+     * \note this parameter only affects the behaviour integrators added
+     * after the construction of the problem.
+     */
+    static const char* const NumberOfLocalSubsteppingLevels;
+    /*!
+     * \brief name of the parameter used to allow or forbid the use of the
+     * symmetric kernels computing the element stiffness matrices (see the
+     * `BehaviourIntegrator::setSymmetricStiffnessMatrixKernelUsage` method).
+     * By default, those kernels are used when the tangent operators of an
+     * element are symmetric.
+     *
+     * \note this parameter only affects the behaviour integrators added
+     * after the construction of the problem.
+     */
+    static const char* const UseSymmetricStiffnessMatrixKernel;
+    /*!
+     * \brief name of the parameter used to allow or forbid the use of the
+     * kernels vectorised over the nodes of an element (see the
+     * `BehaviourIntegrator::setVectorisedKernelsUsage` method). By default,
+     * those kernels are used when the behaviour integrators provide them.
+     *
+     * \note this parameter only affects the behaviour integrators added
+     * after the construction of the problem.
+     */
+    static const char* const UseVectorisedKernels;
     //! \return the list of valid parameters
     static std::vector<std::string> getParametersList();
     /*!
@@ -121,6 +260,10 @@ namespace mfem_mgis {
         std::unique_ptr<DirichletBoundaryCondition>) override;
     void revert() override;
     void update() override;
+    void pushSnapshot() override;
+    void restoreSnapshot() override;
+    void popSnapshot() override;
+    size_type getNumberOfSnapshots() const override;
     NonLinearResolutionOutput solve(const real, const real) override;
     //! \brief destructor
     virtual ~NonLinearEvolutionProblemImplementationBase();
@@ -150,7 +293,14 @@ namespace mfem_mgis {
      */
     virtual void setup(const real, const real);
     /*!
-     * \brief compute prediction
+     * \brief compute a prediction of the unknowns at the end of the time step
+     * by solving the problem linearized around the unknowns at the beginning
+     * of the time step, using the prediction operator selected by the
+     * `SolverPredictionPolicy` solver parameter.
+     *
+     * The unknowns at the end of the time step are left unchanged if no
+     * prediction is requested or if the prediction fails.
+     *
      * \param[in] t: time at the beginning of the time step
      * \param[in] dt: time increment
      */
@@ -162,6 +312,24 @@ namespace mfem_mgis {
      * \param[in] it: integration type
      */
     virtual bool integrate(const mfem::Vector&, const IntegrationType) = 0;
+    /*!
+     * \return if the jacobian matrix assembled by the last fused assembly is
+     * available for the given estimate of the unknowns.
+     * \param[in] u: current estimate of the unknowns
+     */
+    bool isFusedJacobianAvailable(const mfem::Vector&) const;
+    /*!
+     * \return if the fused assembly of the residual and of the jacobian
+     * matrix shall be performed by the next evaluation of the residual, i.e.
+     * if it has been requested and if the last integration of the behaviours
+     * computed the tangent operators.
+     *
+     * Otherwise, the jacobian matrix would either be assembled from
+     * outdated tangent operators or be useless: this is the case of the
+     * evaluations of the residual at trial points by the line searches or by
+     * the jacobian-free mode of the Newton solver.
+     */
+    bool mustPerformFusedAssembly() const;
     //! \brief underlying finite element discretization
     const std::shared_ptr<FiniteElementDiscretization> fe_discretization;
     //! \brief list of boundary conditions
@@ -179,6 +347,14 @@ namespace mfem_mgis {
     mfem::Vector u0;
     //! \brief unknowns at the end of the time step
     mfem::Vector u1;
+    /*!
+     * \brief unknowns saved by the snapshots. Only the first
+     * `number_of_snapshots` elements are used. The other ones are kept so that
+     * their memory is reused by the next snapshots.
+     */
+    std::vector<mfem::Vector> unknowns_snapshots;
+    //! \brief number of snapshots on the stack
+    size_type number_of_snapshots = 0;
     //! \brief newton solver
     std::unique_ptr<NewtonSolver> solver;
 #ifdef MFEM_USE_PETSC
@@ -196,6 +372,89 @@ namespace mfem_mgis {
     MultiMaterialNonLinearIntegrator* const mgis_integrator = nullptr;
     //! \brief modelling hypothesis
     const Hypothesis hypothesis;
+    //! \brief number of threads used to integrate the behaviours
+    const size_type number_of_threads = 1;
+    //! \brief boolean stating if the batched integration is used
+    const bool use_batched_behaviour_integration = false;
+    //! \brief boolean stating if the geometric caches are used
+    const bool use_geometric_cache = false;
+    /*!
+     * \brief type of integration used to compute the prediction operator. No
+     * prediction is made if empty.
+     */
+    std::optional<IntegrationType> prediction_type;
+    //! \brief boolean stating if the fused assembly is used
+    const bool use_fused_assembly = false;
+    /*!
+     * \brief estimate of the unknowns used by the last fused assembly of the
+     * residual and of the jacobian matrix
+     */
+    mutable mfem::Vector fused_assembly_unknowns;
+    /*!
+     * \brief boolean stating if the jacobian matrix assembled by the last
+     * fused assembly is available.
+     */
+    mutable bool fused_jacobian_available = false;
+    /*!
+     * \brief type of the last integration of the behaviours. The fused
+     * assembly only assembles the jacobian matrix if this integration
+     * computed the tangent operators.
+     */
+    IntegrationType last_integration_type =
+        IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    //! \brief strategies used by the multi-threaded assembly
+    enum struct MultiThreadedAssemblyStrategy {
+      NONE,
+      ELEMENT_COLOURING,
+      PRIVATE_BUFFERS
+    };
+    //! \brief boolean stating if the scatter maps are used
+    const bool use_scatter_maps = false;
+    //! \brief strategy used by the multi-threaded assembly
+    MultiThreadedAssemblyStrategy multi_threaded_assembly =
+        MultiThreadedAssemblyStrategy::ELEMENT_COLOURING;
+    /*!
+     * \brief offsets of the positions associated with each element in the
+     * `scatter_positions` member. This member is empty until the scatter maps
+     * are built.
+     */
+    mutable std::vector<std::size_t> scatter_offsets;
+    /*!
+     * \brief positions of the entries of the elementary matrices in the
+     * values of the jacobian matrix.
+     */
+    mutable std::vector<size_type> scatter_positions;
+    //! \brief boolean stating if the matrix-free jacobian is used
+    const bool use_matrix_free_jacobian = false;
+    //! \brief number of levels of the local substepping
+    const size_type number_of_local_substepping_levels = 0;
+    /*!
+     * \brief boolean stating if the symmetric kernels computing the element
+     * stiffness matrices may be used
+     */
+    const bool use_symmetric_stiffness_matrix_kernel = true;
+    /*!
+     * \brief boolean stating if the kernels vectorised over the nodes of an
+     * element may be used
+     */
+    const bool use_vectorised_kernels = true;
+    /*!
+     * \brief operator returned as the jacobian if the matrix-free jacobian is
+     * used. This member is null until the jacobian is first requested.
+     */
+    mutable std::unique_ptr<MatrixFreeJacobianOperator> matrix_free_jacobian;
+    /*!
+     * \brief minimum, over all the integration points, of the ratios between
+     * the time step proposed by the behaviours and the current time step
+     * computed during the last integration of the behaviours.
+     */
+    real time_step_scaling_factor = real{1};
+    /*!
+     * \brief histogram, over all the integration points, of the ratios
+     * between the time step proposed by the behaviours and the current time
+     * step computed during the last integration of the behaviours.
+     */
+    TimeStepScalingFactorHistogram time_step_scaling_factors_histogram;
 
   };  // end of struct NonLinearEvolutionProblemImplementationBase
 
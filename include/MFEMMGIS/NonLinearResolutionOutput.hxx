@@ -10,6 +10,7 @@
 
 #include <limits>
 #include "MFEMMGIS/Config.hxx"
+#include "MFEMMGIS/TimeStepScalingFactorHistogram.hxx"
 
 namespace mfem_mgis {
 
@@ -33,6 +34,34 @@ namespace mfem_mgis {
     real final_residual_norm = std::numeric_limits<real>::quiet_NaN();
     //! \brief number of iterations
     size_type iterations = size_type{};
+    /*!
+     * \brief number of iterations of the iterative linear solver
+     * \note: this is only defined by the Newton solver of `MFEM/MGIS`, and
+     * only if the linear solver is iterative.
+     */
+    size_type linear_solver_iterations = size_type{};
+    /*!
+     * \brief estimate of the number of iterations of the iterative linear
+     * solver saved by the adaptive choice of its relative tolerance
+     * \see `NewtonSolver::getEstimatedNumberOfSavedLinearSolverIterations`
+     */
+    size_type estimated_saved_linear_solver_iterations = size_type{};
+    /*!
+     * \brief minimum, over all the integration points, of the ratios between
+     * the time step proposed by the behaviours and the current time step,
+     * computed during the last integration of the behaviours.
+     */
+    real time_step_scaling_factor = real{1};
+    /*!
+     * \brief histogram, over all the integration points, of the ratios
+     * between the time step proposed by the behaviours and the current time
+     * step, computed during the last integration of the behaviours.
+     *
+     * \note if the batched integration of the behaviours is used, `MGIS`
+     * only reports the minimum of those ratios over each material: the
+     * histogram then holds one value, or one failure, per material.
+     */
+    TimeStepScalingFactorHistogram time_step_scaling_factors_histogram;
     //! \brief convertion operator to a boolean
     inline operator bool() { return this->status; }
   };  // end of struct NonLinearResolutionOutput
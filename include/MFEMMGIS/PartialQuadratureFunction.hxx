@@ -64,6 +64,23 @@ namespace mfem_mgis {
         mgis::span<const real>,
         const size_type = 0,
         const size_type = std::numeric_limits<size_type>::max());
+    /*!
+     * \brief constructor
+     * \param[in] s: quadrature space.
+     * \param[in] v: pointer to the values
+     * \param[in] db: offset of data
+     * \param[in] ds: size of the data per integration points
+     *
+     * \note the view refers to the values currently designated by `v`, i.e.
+     * it follows the changes of `v`. This is used to build views on the state
+     * of a material which stay valid when the buffers holding the states at
+     * the beginning and at the end of the time step are rotated.
+     */
+    ImmutablePartialQuadratureFunctionView(
+        std::shared_ptr<const PartialQuadratureSpace>,
+        const mgis::span<real>*,
+        const size_type = 0,
+        const size_type = std::numeric_limits<size_type>::max());
     //! \return the underlying quadrature space
     const PartialQuadratureSpace& getPartialQuadratureSpace() const;
     /*!
@@ -136,6 +153,12 @@ namespace mfem_mgis {
     size_type getDataOffset(const size_type) const;
     //! \brief underlying values
     mgis::span<const real> immutable_values;
+    /*!
+     * \brief pointer to the underlying values, if the view follows an external
+     * span. If not null, this pointer takes precedence over
+     * `immutable_values`.
+     */
+    const mgis::span<real>* bound_values = nullptr;
     //! \brief data stride
     size_type data_stride;
     /*!
@@ -198,6 +221,21 @@ namespace mfem_mgis {
         mgis::span<real>,
         const size_type = 0,
         const size_type = std::numeric_limits<size_type>::max());
+    /*!
+     * \brief constructor
+     * \param[in] s: quadrature space.
+     * \param[in] v: pointer to the values
+     * \param[in] db: start of the view inside the given data
+     * \param[in] ds: size of the view
+     *
+     * \note the function refers to the values currently designated by `v`,
+     * i.e. it follows the changes of `v`.
+     */
+    PartialQuadratureFunction(
+        std::shared_ptr<const PartialQuadratureSpace>,
+        const mgis::span<real>*,
+        const size_type = 0,
+        const size_type = std::numeric_limits<size_type>::max());
     //
     using ImmutablePartialQuadratureFunctionView::getIntegrationPointValue;
     using ImmutablePartialQuadratureFunctionView::getIntegrationPointValues;
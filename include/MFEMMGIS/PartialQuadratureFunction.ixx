@@ -17,6 +17,9 @@ namespace mfem_mgis {
 
   inline mgis::span<const real>
   ImmutablePartialQuadratureFunctionView::getValues() const {
+    if (this->bound_values != nullptr) {
+      return *(this->bound_values);
+    }
     return this->immutable_values;
   }
 
@@ -43,14 +46,14 @@ namespace mfem_mgis {
   inline const real&
   ImmutablePartialQuadratureFunctionView::getIntegrationPointValue(
       const size_type o) const {
-    return *(this->immutable_values.data() + this->getDataOffset(o));
+    return *(this->getValues().data() + this->getDataOffset(o));
   }  // end of getIntegrationPointValues
 
   inline mgis::span<const real>
   ImmutablePartialQuadratureFunctionView::getIntegrationPointValues(
       const size_type o) const {
     return mgis::span<const real>(
-        this->immutable_values.data() + this->getDataOffset(o),
+        this->getValues().data() + this->getDataOffset(o),
         this->data_size);
   }  // end of getIntegrationPointValues
 
@@ -59,29 +62,32 @@ namespace mfem_mgis {
   ImmutablePartialQuadratureFunctionView::getIntegrationPointValues(
       const size_type o) const {
     return mgis::span<const real, N>(
-        this->immutable_values.data() + this->getDataOffset(o),
+        this->getValues().data() + this->getDataOffset(o),
         this->data_size);
   }  // end of getIntegrationPointValues
 
   inline real& PartialQuadratureFunction::getIntegrationPointValue(
       const size_type o) {
-    return *(this->values.data() + this->getDataOffset(o));
+    return *(this->getValues().data() + this->getDataOffset(o));
   }  // end of getIntegrationPointValues
 
   inline mgis::span<real> PartialQuadratureFunction::getIntegrationPointValues(
       const size_type o) {
-    return mgis::span<real>(this->values.data() + this->getDataOffset(o),
+    return mgis::span<real>(this->getValues().data() + this->getDataOffset(o),
                             this->data_size);
   }  // end of getIntegrationPointValues
 
   template <size_type N>
   inline mgis::span<real, N>
   PartialQuadratureFunction::getIntegrationPointValues(const size_type o) {
-    return mgis::span<real, N>(this->values.data() + this->getDataOffset(o),
-                               this->data_size);
+    return mgis::span<real, N>(
+        this->getValues().data() + this->getDataOffset(o), this->data_size);
   }  // end of getIntegrationPointValues
 
   inline mgis::span<real> PartialQuadratureFunction::getValues() {
+    if (this->bound_values != nullptr) {
+      return *(this->bound_values);
+    }
     return this->values;
   }
 
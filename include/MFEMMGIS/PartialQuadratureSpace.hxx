@@ -9,20 +9,53 @@
 #define LIB_MFEM_MGIS_PARTIALQUADRATURESPACE_HXX
 
 #include <memory>
+#include <vector>
+#include <cstddef>
 #include <variant>
 #include <functional>
-#include <unordered_map>
 #include "MFEMMGIS/Config.hxx"
+#include "MFEMMGIS/FiniteElementDiscretization.hxx"
 
 namespace mfem_mgis {
 
-  // forward declaration
-  struct FiniteElementDiscretization;
-
   /*!
    * \brief a space on quadrature points defined on a material
+   *
+   * The integration points of the elements of the material are numbered
+   * contiguously, element by element, following the increasing order of the
+   * element numbers. Only the offsets of the elements of the material are
+   * stored: the offset of an element is retrieved in constant time through
+   * its position in the partition of the elements of the mesh by material
+   * (see the `FiniteElementDiscretization::getElementsPartition` method).
    */
   struct MFEM_MGIS_EXPORT PartialQuadratureSpace {
+    /*!
+     * \brief geometric data precomputed at each integration point.
+     *
+     * Those data are stored in a structure of arrays fashion and are indexed
+     * by the offsets of the integration points.
+     */
+    struct GeometricCache {
+      /*!
+       * \brief offsets of the derivatives of the shape functions of each
+       * integration point in the `dshapes` array
+       */
+      std::vector<size_type> dshapes_offsets;
+      /*!
+       * \brief derivatives of the shape functions in the physical frame. For
+       * each integration point, the derivatives are stored column-wise, as in
+       * `mfem::DenseMatrix`.
+       */
+      std::vector<real> dshapes;
+      /*!
+       * \brief weights of the integration points, including the determinant
+       * of the jacobian of the element transformation
+       */
+      std::vector<real> weights;
+    };
+    //! \brief a function returning the weight of an integration point
+    using IntegrationPointWeightFunction = std::function<real(
+        mfem::ElementTransformation &, const mfem::IntegrationPoint &)>;
     /*!
      * \brief throw an exception in case of invalid offset
      * \param[in] id: material identifier
@@ -36,6 +69,19 @@ namespace mfem_mgis {
      * \param[in] m: material attribute.
      * \param[in] irs: function returning the order of quadrature for the
      * considered finite element.
+     *
+     * The elements of the material are given by the partition of the
+     * elements of the mesh by material (see the
+     * `FiniteElementDiscretization::getElementsPartition` method), so that
+     * the cost of the construction of the quadrature spaces of all the
+     * materials is proportional to the number of elements of the mesh.
+     *
+     * \note the integration rule is assumed to only depend on the finite
+     * element and on the order of the element transformation, i.e. on the
+     * finite element describing the nodes of the mesh, if any. The function
+     * `irs` is thus only called once for each distinct pair of such finite
+     * elements, which avoids building the element transformations of all
+     * the elements.
      */
     PartialQuadratureSpace(const FiniteElementDiscretization &,
                            const size_type,
@@ -60,23 +106,47 @@ namespace mfem_mgis {
     //! \brief return the number of integration points
     size_type getNumberOfIntegrationPoints() const;
     /*!
-     * \brief return the hash table associating global element numbers and local
-     * offsets.
+     * \return the list of elements (global numbering) belonging to the
+     * material, sorted in increasing order.
      */
-    const std::unordered_map<size_type, size_type> &getOffsets() const;
+    const std::vector<size_type> &getElements() const;
     /*!
      * \brief return the offset associated with an element
      * \param[in] i: element number (global numbering)
+     *
+     * \note an exception is thrown if the element does not belong to the
+     * material.
      */
     size_type getOffset(const size_type) const;
     //! \return the material id
     size_type getId() const;
+    /*!
+     * \brief precompute the derivatives of the shape functions and the
+     * weights of all integration points.
+     *
+     * \param[in] w: function returning the weight of an integration point
+     *
+     * \note this method does nothing if the geometric cache has already been
+     * built.
+     * \note the cached data are only valid as long as the mesh is not
+     * modified.
+     */
+    void buildGeometricCache(const IntegrationPointWeightFunction &) const;
+    /*!
+     * \return the geometric cache, or a null pointer if the geometric cache
+     * has not been built.
+     */
+    const GeometricCache *getGeometricCache() const;
+    //! \return the memory used by the geometric cache, in bytes
+    std::size_t getGeometricCacheMemoryUsage() const;
     //! \brief destructor
     ~PartialQuadratureSpace();
 
    private:
     //! \brief underlying finite element discretization
     const FiniteElementDiscretization &fe_discretization;
+    //! \brief partition of the elements of the mesh by material
+    const FiniteElementDiscretization::ElementsPartition &elements_partition;
     /*!
      * \brief function returning the order of quadrature for the
      * considered finite element.
@@ -84,14 +154,23 @@ namespace mfem_mgis {
     std::function<const mfem::IntegrationRule &(
         const mfem::FiniteElement &, const mfem::ElementTransformation &)>
         integration_rule_selector;
-    //! \brief offsets associated with elements
-    std::unordered_map<size_type,  // element number (global numbering)
-                       size_type>  // offset
-        offsets;
+    //! \brief elements belonging to the material (global numbering)
+    std::vector<size_type> elements;
+    /*!
+     * \brief offsets associated with the elements belonging to the
+     * material, indexed by the positions of the elements in the `elements`
+     * member.
+     */
+    std::vector<size_type> elements_offsets;
     //! \brief material identifier
     size_type id;
     //! \brief number of integration points
     size_type ng;
+    /*!
+     * \brief precomputed geometric data. This member is mutable since it
+     * is a pure cache which does not affect the definition of the space.
+     */
+    mutable std::unique_ptr<GeometricCache> geometric_cache;
   };  // end of struct QuadratureSpace
 
 }  // namespace mfem_mgis
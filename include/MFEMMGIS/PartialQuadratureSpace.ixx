@@ -11,7 +11,7 @@
 namespace mfem_mgis {
 
   inline size_type PartialQuadratureSpace::getNumberOfElements() const {
-    return this->offsets.size();
+    return static_cast<size_type>(this->elements.size());
   }  // end of getNumberOfElements
 
   inline size_type PartialQuadratureSpace::getNumberOfIntegrationPoints()
@@ -23,19 +23,25 @@ namespace mfem_mgis {
     return this->id;
   }  // end of getId
 
-  inline const std::unordered_map<size_type, size_type>&
-  PartialQuadratureSpace::getOffsets() const {
-    return this->offsets;
-  } // end of getOffsets
+  inline const std::vector<size_type>& PartialQuadratureSpace::getElements()
+      const {
+    return this->elements;
+  }  // end of getElements
 
   inline size_type PartialQuadratureSpace::getOffset(const size_type i) const {
-    const auto p = this->offsets.find(i);
-    if (p == this->offsets.end()) {
+    const auto& attributes = this->elements_partition.attributes;
+    if ((i < 0) || (i >= static_cast<size_type>(attributes.size())) ||
+        (attributes[i] != this->id)) {
       PartialQuadratureSpace::treatInvalidOffset(this->id, i);
     }
-    return p->second;
+    return this->elements_offsets[this->elements_partition.positions[i]];
   }  // end of getOffset
 
+  inline const PartialQuadratureSpace::GeometricCache*
+  PartialQuadratureSpace::getGeometricCache() const {
+    return this->geometric_cache.get();
+  }  // end of getGeometricCache
+
 }  // namespace mfem_mgis
 
 #endif /* LIB_MFEM_MGIS_PARTIALQUADRATURESPACE_IXX */
@@ -10,6 +10,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <atomic>
 #include <string>
 #include <iosfwd>
@@ -85,6 +86,23 @@ namespace mfem_mgis {
      * \note the measurement
      */
     Timer getTimer(std::string_view);
+    /*!
+     * \brief increment a counter, which is created if needed
+     * \param[in] n: name of the counter
+     * \param[in] v: increment
+     *
+     * \note this method is thread-safe
+     * \note in parallel computations, the counters are summed over all the
+     * processes when printed. A counter defined on some processes only is
+     * considered null on the other ones.
+     */
+    void incrementCounter(std::string_view, const uint64_t = 1);
+    /*!
+     * \return the value of a counter on the current process, or zero if the
+     * counter is not defined.
+     * \param[in] n: name of the counter
+     */
+    uint64_t getCounter(std::string_view) const;
 
    private:
     //! \brief default constructor
@@ -98,6 +116,10 @@ namespace mfem_mgis {
     TimeSection main;
     //! \brief current section
     TimeSection* current;
+    //! \brief counters
+    std::map<std::string, uint64_t, std::less<>> counters;
+    //! \brief mutex protecting the counters
+    mutable std::mutex counters_mutex;
   };  // end of struct Profiler
 
   /*!
@@ -8,6 +8,8 @@
 #ifndef LIB_MFEM_MGIS_ISOTROPICSTANDARDBEHAVIOURINTEGRATORCRTPBASE_HXX
 #define LIB_MFEM_MGIS_ISOTROPICSTANDARDBEHAVIOURINTEGRATORCRTPBASE_HXX
 
+#include <mutex>
+#include <vector>
 #include <mfem/linalg/densemat.hpp>
 #include "MFEMMGIS/BehaviourIntegratorBase.hxx"
 
@@ -17,7 +19,11 @@ namespace mfem_mgis {
    * \brief a base class of the `StandardBehaviourIntegratorCRTPBase`
    * class to factorize code by static using the CRTP idiom.
    *
-   * This class provides a way to optimise dynamic memory allocations.
+   * This class provides a way to optimise dynamic memory allocations: the
+   * values of the shape functions and their derivatives are stored in the
+   * workspace associated with the calling thread (see the `getThreadWorkspace`
+   * method), so that the methods of this class can be called concurrently on
+   * distinct elements.
    *
    * The `Child` class must provide:
    *
@@ -25,6 +31,19 @@ namespace mfem_mgis {
    * - a method called `updateGradients`
    * - a method called `updateInnerForces`
    * - a method called `updateStiffnessMatrix`
+   * - a method called `updateSymmetricStiffnessMatrix` if the
+   *   `hasSymmetricStiffnessMatrixKernel` member of the
+   *   `BehaviourIntegratorTraits` class is true
+   * - methods called `updateGradientsVectorised`,
+   *   `updateInnerForcesVectorised`, `updateStiffnessMatrixVectorised` and
+   *   `updateSymmetricStiffnessMatrixVectorised` if the
+   *   `hasVectorisedKernels` member of the `BehaviourIntegratorTraits` class
+   *   is true. Those methods treat all the nodes of an element at once and
+   *   are used instead of the per-node methods, unless their use is
+   *   forbidden (see the `setVectorisedKernelsUsage` method). They are
+   *   templated by the number of nodes of the element, which is 0 if this
+   *   number is only known at runtime (see the `dispatchOnNumberOfNodes`
+   *   method).
    * - a method called `getRotationMatrix`
    * - a method called `rotateGradients`
    * - a method called `rotateThermodynamicForces`
@@ -49,6 +68,30 @@ namespace mfem_mgis {
                             mfem::ElementTransformation &,
                             const mfem::Vector &,
                             const IntegrationType);
+    /*!
+     * \brief compute the gradients at the integration points of the given
+     * element. This is the first step of the batched integration of the
+     * behaviour.
+     *
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] u: current estimate of the unknowns
+     * \param[in] it: integration type
+     */
+    void implementComputeGradients(const mfem::FiniteElement &,
+                                   mfem::ElementTransformation &,
+                                   const mfem::Vector &,
+                                   const IntegrationType);
+    /*!
+     * \brief integrate the behaviour at all the integration points of the
+     * material and rotate the tangent operator blocks. This is the second step
+     * of the batched integration of the behaviour.
+     *
+     * \param[in] it: integration type
+     * \param[in] nthreads: number of threads
+     */
+    bool implementPerformsBehaviourIntegration(const IntegrationType,
+                                               const size_type);
     /*!
      * \brief compute the contribution of the element to the residual
      * \param[out] Fe: element stiffness matrix
@@ -83,6 +126,45 @@ namespace mfem_mgis {
     void implementUpdateJacobian(mfem::DenseMatrix &,
                                  const mfem::FiniteElement &,
                                  mfem::ElementTransformation &);
+    /*!
+     * \brief compute the contributions of the element to the residual and to
+     * the jacobian.
+     * \param[out] Fe: element contribution to the residual
+     * \param[out] Ke: element stiffness matrix
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     *
+     * \note The implementation of the `updateResidualAndJacobian` in the
+     * `Child` class trivially calls this method.
+     */
+    void implementUpdateResidualAndJacobian(mfem::Vector &,
+                                            mfem::DenseMatrix &,
+                                            const mfem::FiniteElement &,
+                                            mfem::ElementTransformation &);
+    /*!
+     * \brief compute the product of the element stiffness matrix by the
+     * given vector without building the element stiffness matrix.
+     * \param[out] Ye: product of the element stiffness matrix by `Xe`
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] Xe: values of the vector on the element
+     *
+     * At each integration point, the linearised gradients associated with
+     * `Xe` are multiplied by the tangent operator blocks, which are stored in
+     * the global frame, and the result is assembled as inner forces.
+     *
+     * \note If the external state variables depend on the unknowns, the
+     * element stiffness matrix is built and multiplied by `Xe`.
+     * \note On high-order quadrilaterals and hexahedra, the linearised
+     * gradients and the inner forces are computed by sum factorisation (see
+     * `updateJacobianActionBySumFactorisation`).
+     * \note The implementation of the `updateJacobianAction` in the `Child`
+     * class trivially calls this method.
+     */
+    void implementUpdateJacobianAction(mfem::Vector &,
+                                       const mfem::FiniteElement &,
+                                       mfem::ElementTransformation &,
+                                       const mfem::Vector &);
     /*!
      * \brief compute the contribution of the element to the inner forces
      * \param[out] Fe: element stiffness matrix
@@ -95,14 +177,169 @@ namespace mfem_mgis {
     //! \brief destructor
     ~StandardBehaviourIntegratorCRTPBase() override;
 
-#ifndef MFEM_THREAD_SAFE
    private:
-    //! \brief vector used to store the value of the shape functions
-    mfem::Vector shape;
-    //! \brief matrix used to store the derivatives of the shape functions
-    mfem::DenseMatrix dshape;
-#endif
-
+    /*!
+     * \brief compute the gradients at the given integration point and rotate
+     * them in the material frame.
+     * \return the rotation matrix associated with the integration point
+     * \param[in] lw: workspace of the calling thread
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] ip: integration point
+     * \param[in] u: current estimate of the unknowns
+     * \param[in] o: offset of the integration point
+     * \tparam N: number of nodes of the element if known at compile-time, 0
+     * otherwise
+     */
+    template <size_type N = 0>
+    auto computeGradientsAtIntegrationPoint(ThreadWorkspace &,
+                                            const mfem::FiniteElement &,
+                                            mfem::ElementTransformation &,
+                                            const mfem::IntegrationPoint &,
+                                            const mfem::Vector &,
+                                            const size_type);
+    /*!
+     * \brief add the contributions of the values of the unknowns on an
+     * element to the gradients at an integration point using the
+     * appropriate kernel of the `Child` class.
+     * \param[out] g: gradients
+     * \param[in] u: values of the unknowns on the element
+     * \param[in] shape: values of the shape functions, only used if the
+     * computation of the gradients requires them
+     * \param[in] dshape: derivatives of the shape functions
+     * \tparam N: number of nodes of the element if known at compile-time, 0
+     * otherwise
+     */
+    template <size_type N>
+    void updateElementGradients(mgis::span<real> &,
+                                const mfem::Vector &,
+                                const mfem::Vector &,
+                                const mfem::DenseMatrix &);
+    /*!
+     * \brief compute the product of the element stiffness matrix by the
+     * given vector on a tensor-product element by sum factorisation.
+     *
+     * The derivatives of each component of `Xe` with respect to the reference
+     * coordinates are evaluated at all the integration points using the
+     * one-dimensional shape functions. The linearised gradients and the
+     * inner forces are then related to those derivatives through linear
+     * operators built once per integrator from the kernels of the `Child`
+     * class (see `getSumFactorisationOperators`), which avoids evaluating
+     * the derivatives of the shape functions of all the nodes at each
+     * integration point.
+     *
+     * \param[out] Ye: product of the element stiffness matrix by `Xe`
+     * \param[in] e: finite element
+     * \param[in] tr: finite element transformation
+     * \param[in] Xe: values of the vector on the element
+     * \param[in] ir: integration rule
+     * \param[in] maps: one-dimensional shape functions and their
+     * derivatives at the one-dimensional integration points
+     *
+     * \note this method can only be used if the computation of the gradients
+     * does not require the values of the shape functions.
+     */
+    void updateJacobianActionBySumFactorisation(mfem::Vector &,
+                                                const mfem::FiniteElement &,
+                                                mfem::ElementTransformation &,
+                                                const mfem::Vector &,
+                                                const mfem::IntegrationRule &,
+                                                const mfem::DofToQuad &);
+    /*!
+     * \brief linear operators used by the sum factorisation
+     */
+    struct SumFactorisationOperators {
+      //! \brief flag used to build the operators only once
+      std::once_flag initialisation_flag;
+      /*!
+       * \brief linear operator relating the gradients of the unknowns in the
+       * physical frame to the gradients of the behaviour
+       */
+      std::vector<real> gradients_operator;
+      /*!
+       * \brief linear operator relating the thermodynamic forces to the inner
+       * forces, per derivative of the shape functions
+       */
+      std::vector<real> inner_forces_operator;
+    };
+    /*!
+     * \return the linear operators used by the sum factorisation.
+     *
+     * Those operators only depend on the kernels of the `Child` class. They
+     * are extracted from those kernels applied to an element made of a single
+     * node whose derivatives of the shape function are the unit vectors. This
+     * is done by the first call of this method, which is thread-safe.
+     *
+     * \param[in] d: space dimension
+     */
+    const SumFactorisationOperators &getSumFactorisationOperators(
+        const size_type);
+    /*!
+     * \return if the symmetric kernel of the `Child` class can be used to
+     * compute the stiffness matrix of an element, i.e. if this kernel exists
+     * and if the tangent operators are symmetric at each integration point of
+     * the element. The use of this kernel may also be forbidden (see the
+     * `setSymmetricStiffnessMatrixKernelUsage` method).
+     * \param[in] o: offset of the first integration point of the element
+     * \param[in] n: number of integration points of the element
+     */
+    bool useSymmetricStiffnessMatrixKernel(const size_type,
+                                           const size_type) const;
+    /*!
+     * \brief call the given functor with the number of nodes of an element,
+     * given as an `std::integral_constant`.
+     *
+     * If the `Child` class provides vectorised kernels, elements with 4, 8,
+     * 10 or 20 nodes, i.e. linear and quadratic tetrahedra and hexahedra, are
+     * treated by specialisations of those kernels in which the number of
+     * nodes is a compile-time constant. The functor is called with 0 in all
+     * other cases, meaning that the number of nodes is only known at runtime.
+     *
+     * \param[in] n: number of nodes of the element
+     * \param[in] f: functor
+     */
+    template <typename Functor>
+    static void dispatchOnNumberOfNodes(const size_type, const Functor &);
+    /*!
+     * \brief update the inner forces of an element with the contribution of
+     * an integration point using the appropriate kernel of the `Child` class.
+     * \param[out] Fe: element inner forces
+     * \param[in] s: thermodynamic forces at the integration point
+     * \param[in] dshape: derivatives of the shape functions
+     * \param[in] w: weight of the integration point
+     * \tparam N: number of nodes of the element if known at compile-time, 0
+     * otherwise
+     */
+    template <size_type N>
+    void updateElementInnerForces(mfem::Vector &,
+                                  const mgis::span<const real> &,
+                                  const mfem::DenseMatrix &,
+                                  const real) const;
+    /*!
+     * \brief update the stiffness matrix of an element with the contribution
+     * of an integration point using the appropriate kernel of the `Child`
+     * class.
+     * \param[out] Ke: element stiffness matrix
+     * \param[in] Kip: tangent operator at the integration point
+     * \param[in] shape: values of the shape functions, only used if the
+     * external state variables depend on the unknowns
+     * \param[in] dshape: derivatives of the shape functions
+     * \param[in] w: weight of the integration point
+     * \param[in] symmetric: if true, the symmetric kernel is used. In this
+     * case, the element stiffness matrix must be completed by symmetry
+     * once all the contributions have been added.
+     * \tparam N: number of nodes of the element if known at compile-time, 0
+     * otherwise
+     */
+    template <size_type N>
+    void updateElementStiffnessMatrix(mfem::DenseMatrix &,
+                                      const mgis::span<const real> &,
+                                      const mfem::Vector &,
+                                      const mfem::DenseMatrix &,
+                                      const real,
+                                      const bool) const;
+    //! \brief linear operators used by the sum factorisation
+    SumFactorisationOperators sum_factorisation_operators;
   };  // end of StandardBehaviourIntegratorCRTPBase
 
 }  // end of namespace mfem_mgis
@@ -8,15 +8,54 @@
 #ifndef LIB_MFEM_MGIS_STANDARDBEHAVIOURINTEGRATORCRTPBASE_IXX
 #define LIB_MFEM_MGIS_STANDARDBEHAVIOURINTEGRATORCRTPBASE_IXX
 
+#include <algorithm>
+#include <mutex>
+#include <type_traits>
 #include "mfem/fem/fe.hpp"
 #include "mfem/fem/eltrans.hpp"
 #include "MGIS/Raise.hxx"
 #include "MFEMMGIS/IntegrationType.hxx"
 #include "MFEMMGIS/PartialQuadratureSpace.hxx"
 #include "MFEMMGIS/BehaviourIntegratorTraits.hxx"
+#include "MFEMMGIS/SumFactorisation.hxx"
 
 namespace mfem_mgis {
 
+  template <typename Child>
+  template <size_type N>
+  auto StandardBehaviourIntegratorCRTPBase<Child>::
+      computeGradientsAtIntegrationPoint(ThreadWorkspace &lw,
+                                         const mfem::FiniteElement &e,
+                                         mfem::ElementTransformation &tr,
+                                         const mfem::IntegrationPoint &ip,
+                                         const mfem::Vector &u,
+                                         const size_type o) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    constexpr const auto evaluateShapeFunctions =
+        Traits::updateExternalStateVariablesFromUnknownsValues ||
+        Traits::gradientsComputationRequiresShapeFunctions;
+    auto &child = static_cast<Child &>(*this);
+    const auto gsize = this->s1.gradients_stride;
+    auto &shape = lw.shape;
+    tr.SetIntPoint(&ip);
+    if constexpr (evaluateShapeFunctions) {
+      // get the values of the shape functions
+      e.CalcPhysShape(tr, shape);
+    }
+    if constexpr (Traits::updateExternalStateVariablesFromUnknownsValues) {
+      child.updateExternalStateVariablesFromUnknownsValues(u, shape, o);
+    }
+    // get the gradients of the shape functions
+    const auto &dshape = this->getShapeFunctionsDerivatives(lw, e, tr, o);
+    auto g = this->s1.gradients.subspan(o * gsize, gsize);
+    std::copy(this->macroscopic_gradients.begin(),
+              this->macroscopic_gradients.end(), g.begin());
+    this->template updateElementGradients<N>(g, u, shape, dshape);
+    const auto r = child.getRotationMatrix(o);
+    child.rotateGradients(g, r);
+    return r;
+  }  // end of computeGradientsAtIntegrationPoint
+
   template <typename Child>
   bool StandardBehaviourIntegratorCRTPBase<Child>::implementIntegrate(
       const mfem::FiniteElement &e,
@@ -48,63 +87,88 @@ namespace mfem_mgis {
         child.rotateTangentOperatorBlocks(Kip, r);
       }
     } else {
-#ifdef MFEM_THREAD_SAFE
-      mfem::Vector shape;
-      mfem::DenseMatrix dshape(e.GetDof(), e.GetDim());
-      if constexpr (evaluateShapeFunctions) {
-        shape.SetSize(e.GetDof());
-      }
-#else
+      auto &lw = this->getThreadWorkspace();
       if constexpr (evaluateShapeFunctions) {
-        this->shape.SetSize(e.GetDof());
+        lw.shape.SetSize(e.GetDof());
       }
-      this->dshape.SetSize(e.GetDof(), e.GetDim());
-#endif
-      const auto nnodes = e.GetDof();
-      const auto gsize = this->s1.gradients_stride;
-      const auto thsize = this->s1.thermodynamic_forces_stride;
-      for (size_type i = 0; i != ir.GetNPoints(); ++i) {
-        const auto &ip = ir.IntPoint(i);
-        tr.SetIntPoint(&ip);
-        // offset of the integration point
-        const auto o = eoffset + i;
-        if constexpr (evaluateShapeFunctions) {
-          // get the gradients of the shape functions
-          e.CalcPhysShape(tr, shape);
-        }
-        if constexpr (Traits::updateExternalStateVariablesFromUnknownsValues) {
-          child.updateExternalStateVariablesFromUnknownsValues(u, shape, o);
-        }
-        // get the gradients of the shape functions
-        e.CalcPhysDShape(tr, dshape);
-        auto g = this->s1.gradients.subspan(o * gsize, gsize);
-        std::copy(this->macroscopic_gradients.begin(),
-                  this->macroscopic_gradients.end(), g.begin());
-        for (size_type ni = 0; ni != nnodes; ++ni) {
-          if constexpr (Traits::gradientsComputationRequiresShapeFunctions) {
-            child.updateGradients(g, u, shape, dshape, ni);
-          } else {
-            child.updateGradients(g, u, dshape, ni);
+      auto success = true;
+      this->dispatchOnNumberOfNodes(e.GetDof(), [&](auto number_of_nodes) {
+        constexpr auto N = decltype(number_of_nodes)::value;
+        for (size_type i = 0; i != ir.GetNPoints(); ++i) {
+          // offset of the integration point
+          const auto o = eoffset + i;
+          const auto r = this->template computeGradientsAtIntegrationPoint<N>(
+              lw, e, tr, ir.IntPoint(i), u, o);
+          if (!this->performsLocalBehaviourIntegration(o, it)) {
+            success = false;
+            return;
+          }
+          // Here we rotate the tangent operator blocks but not the
+          // thermodynamic forces.
+          if (it != IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) {
+            auto Kip = this->K.subspan(o * (this->K_stride), this->K_stride);
+            child.rotateTangentOperatorBlocks(Kip, r);
           }
         }
-        const auto r = child.getRotationMatrix(o);
-        child.rotateGradients(g, r);
-        if (!this->performsLocalBehaviourIntegration(o, it)) {
-          return false;
-        }
-        const auto s =
-            this->s1.thermodynamic_forces.subspan(o * thsize, thsize);
-        // Here we rotate the tangent operator blocks but not the thermodynamic
-        // forces.
-        if (it != IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) {
-          auto Kip = this->K.subspan(o * (this->K_stride), this->K_stride);
-          child.rotateTangentOperatorBlocks(Kip, r);
-        }
-      }
+      });
+      return success;
     }
     return true;
   }  // end of implementIntegrate
 
+  template <typename Child>
+  void StandardBehaviourIntegratorCRTPBase<Child>::implementComputeGradients(
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u,
+      const IntegrationType it) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    constexpr const auto evaluateShapeFunctions =
+        Traits::updateExternalStateVariablesFromUnknownsValues ||
+        Traits::gradientsComputationRequiresShapeFunctions;
+    if ((it == IntegrationType::PREDICTION_TANGENT_OPERATOR) ||
+        (it == IntegrationType::PREDICTION_SECANT_OPERATOR) ||
+        (it == IntegrationType::PREDICTION_ELASTIC_OPERATOR)) {
+      // the gradients are not updated by the prediction
+      return;
+    }
+    auto &child = static_cast<Child &>(*this);
+    // element offset
+    const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
+    const auto &ir = child.getIntegrationRule(e, tr);
+    auto &lw = this->getThreadWorkspace();
+    if constexpr (evaluateShapeFunctions) {
+      lw.shape.SetSize(e.GetDof());
+    }
+    this->dispatchOnNumberOfNodes(e.GetDof(), [&](auto number_of_nodes) {
+      constexpr auto N = decltype(number_of_nodes)::value;
+      for (size_type i = 0; i != ir.GetNPoints(); ++i) {
+        this->template computeGradientsAtIntegrationPoint<N>(
+            lw, e, tr, ir.IntPoint(i), u, eoffset + i);
+      }
+    });
+  }  // end of implementComputeGradients
+
+  template <typename Child>
+  bool StandardBehaviourIntegratorCRTPBase<
+      Child>::implementPerformsBehaviourIntegration(const IntegrationType it,
+                                                    const size_type nthreads) {
+    if (!BehaviourIntegratorBase::performsBehaviourIntegration(it, nthreads)) {
+      return false;
+    }
+    if (it == IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) {
+      return true;
+    }
+    // rotate the tangent operator blocks
+    auto &child = static_cast<Child &>(*this);
+    for (size_type o = 0; o != this->n; ++o) {
+      const auto r = child.getRotationMatrix(o);
+      auto Kip = this->K.subspan(o * (this->K_stride), this->K_stride);
+      child.rotateTangentOperatorBlocks(Kip, r);
+    }
+    return true;
+  }  // end of implementPerformsBehaviourIntegration
+
   template <typename Child>
   void StandardBehaviourIntegratorCRTPBase<Child>::implementUpdateResidual(
       mfem::Vector &Fe,
@@ -121,34 +185,34 @@ namespace mfem_mgis {
       mfem::ElementTransformation &tr) {
     using Traits = BehaviourIntegratorTraits<Child>;
     auto &child = static_cast<Child &>(*this);
-#ifdef MFEM_THREAD_SAFE
-    mfem::DenseMatrix dshape(e.GetDof(), e.GetDim());
-#else
-    this->dshape.SetSize(e.GetDof(), e.GetDim());
-#endif
-    const auto nnodes = e.GetDof();
+    auto &lw = this->getThreadWorkspace();
+    const auto *const gc = this->quadrature_space->getGeometricCache();
     const auto thsize = this->s1.thermodynamic_forces_stride;
     // element offset
     const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
     Fe.SetSize(e.GetDof() * Traits::unknownsSize);
     Fe = 0.;
     const auto &ir = child.getIntegrationRule(e, tr);
-    for (size_type i = 0; i != ir.GetNPoints(); ++i) {
-      const auto &ip = ir.IntPoint(i);
-      tr.SetIntPoint(&ip);
-      // get the gradients of the shape functions
-      e.CalcPhysDShape(tr, dshape);
-      // get the weights associated to point ip
-      const auto w = child.getIntegrationPointWeight(tr, ip);
-      // offset of the integration point
-      const auto o = eoffset + i;
-      const auto r = child.getRotationMatrix(o);
-      const auto s = this->s1.thermodynamic_forces.subspan(o * thsize, thsize);
-      const auto &rs = child.rotateThermodynamicForces(s, r);
-      for (size_type ni = 0; ni != nnodes; ++ni) {
-        child.updateInnerForces(Fe, rs, dshape, w, ni);
+    this->dispatchOnNumberOfNodes(e.GetDof(), [&](auto number_of_nodes) {
+      constexpr auto N = decltype(number_of_nodes)::value;
+      for (size_type i = 0; i != ir.GetNPoints(); ++i) {
+        const auto &ip = ir.IntPoint(i);
+        // offset of the integration point
+        const auto o = eoffset + i;
+        tr.SetIntPoint(&ip);
+        // get the gradients of the shape functions
+        const auto &dshape = this->getShapeFunctionsDerivatives(lw, e, tr, o);
+        // get the weights associated to point ip
+        const auto w = (gc != nullptr)
+                           ? gc->weights[o]
+                           : child.getIntegrationPointWeight(tr, ip);
+        const auto r = child.getRotationMatrix(o);
+        const auto s =
+            this->s1.thermodynamic_forces.subspan(o * thsize, thsize);
+        const auto &rs = child.rotateThermodynamicForces(s, r);
+        this->template updateElementInnerForces<N>(Fe, rs, dshape, w);
       }
-    }
+    });
   }  // end of implementComputeInnerForces
 
   template <typename Child>
@@ -159,18 +223,12 @@ namespace mfem_mgis {
     using Traits = BehaviourIntegratorTraits<Child>;
     auto &child = static_cast<Child &>(*this);
     constexpr const bool updateExt = Traits::updateExternalStateVariablesFromUnknownsValues;
-#ifdef MFEM_THREAD_SAFE
-    mfem::Vector shape;
-    mfem::DenseMatrix dshape(e.GetDof(), e.GetDim());
-    if (updateExt)
-      shape.SetSize(e.GetDof());
-    } 
-#else
+    auto &lw = this->getThreadWorkspace();
+    auto &shape = lw.shape;
     if constexpr (updateExt) {
-      this->shape.SetSize(e.GetDof());
-    } 
-    this->dshape.SetSize(e.GetDof(), e.GetDim());
-#endif
+      shape.SetSize(e.GetDof());
+    }
+    const auto *const gc = this->quadrature_space->getGeometricCache();
     // element offset
     const auto nnodes = e.GetDof();
     const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
@@ -178,30 +236,499 @@ namespace mfem_mgis {
                e.GetDof() * Traits::unknownsSize);
     Ke = 0.;
     const auto &ir = child.getIntegrationRule(e, tr);
-    for (size_type i = 0; i != ir.GetNPoints(); ++i) {
-      // get the gradients of the shape functions
-      const auto &ip = ir.IntPoint(i);
-      tr.SetIntPoint(&ip);
-      if constexpr (updateExt) {
+    const auto symmetric = this->useSymmetricStiffnessMatrixKernel(
+        eoffset, ir.GetNPoints());
+    this->dispatchOnNumberOfNodes(nnodes, [&](auto number_of_nodes) {
+      constexpr auto N = decltype(number_of_nodes)::value;
+      for (size_type i = 0; i != ir.GetNPoints(); ++i) {
+        const auto &ip = ir.IntPoint(i);
+        // offset of the integration point
+        const auto o = eoffset + i;
+        tr.SetIntPoint(&ip);
+        if constexpr (updateExt) {
+          // get the values of the shape functions
+          e.CalcPhysShape(tr, shape);
+        }
         // get the gradients of the shape functions
-        e.CalcPhysShape(tr, shape);
+        const auto &dshape = this->getShapeFunctionsDerivatives(lw, e, tr, o);
+        // get the weights associated to point ip
+        const auto w = (gc != nullptr)
+                           ? gc->weights[o]
+                           : child.getIntegrationPointWeight(tr, ip);
+        const auto Kip =
+            this->K.subspan(o * (this->K_stride), this->K_stride);
+        // assembly of the stiffness matrix
+        this->template updateElementStiffnessMatrix<N>(Ke, Kip, shape, dshape,
+                                                       w, symmetric);
       }
-      e.CalcPhysDShape(tr, dshape);
-      // get the weights associated to point ip
-      const auto w = child.getIntegrationPointWeight(tr, ip);
+    });
+    if (symmetric) {
+      BehaviourIntegratorBase::completeStiffnessMatrixBySymmetry(Ke, nnodes);
+    }
+  }  // end of implementUpdateJacobian
+
+  template <typename Child>
+  void StandardBehaviourIntegratorCRTPBase<Child>::
+      implementUpdateResidualAndJacobian(mfem::Vector &Fe,
+                                         mfem::DenseMatrix &Ke,
+                                         const mfem::FiniteElement &e,
+                                         mfem::ElementTransformation &tr) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    auto &child = static_cast<Child &>(*this);
+    constexpr const bool updateExt =
+        Traits::updateExternalStateVariablesFromUnknownsValues;
+    auto &lw = this->getThreadWorkspace();
+    auto &shape = lw.shape;
+    if constexpr (updateExt) {
+      shape.SetSize(e.GetDof());
+    }
+    const auto *const gc = this->quadrature_space->getGeometricCache();
+    const auto nnodes = e.GetDof();
+    const auto thsize = this->s1.thermodynamic_forces_stride;
+    // element offset
+    const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
+    Fe.SetSize(e.GetDof() * Traits::unknownsSize);
+    Fe = 0.;
+    Ke.SetSize(e.GetDof() * Traits::unknownsSize,
+               e.GetDof() * Traits::unknownsSize);
+    Ke = 0.;
+    const auto &ir = child.getIntegrationRule(e, tr);
+    const auto symmetric = this->useSymmetricStiffnessMatrixKernel(
+        eoffset, ir.GetNPoints());
+    this->dispatchOnNumberOfNodes(nnodes, [&](auto number_of_nodes) {
+      constexpr auto N = decltype(number_of_nodes)::value;
+      for (size_type i = 0; i != ir.GetNPoints(); ++i) {
+        const auto &ip = ir.IntPoint(i);
+        // offset of the integration point
+        const auto o = eoffset + i;
+        tr.SetIntPoint(&ip);
+        if constexpr (updateExt) {
+          // get the values of the shape functions
+          e.CalcPhysShape(tr, shape);
+        }
+        // get the gradients of the shape functions
+        const auto &dshape = this->getShapeFunctionsDerivatives(lw, e, tr, o);
+        // get the weights associated to point ip
+        const auto w = (gc != nullptr)
+                           ? gc->weights[o]
+                           : child.getIntegrationPointWeight(tr, ip);
+        const auto r = child.getRotationMatrix(o);
+        const auto s =
+            this->s1.thermodynamic_forces.subspan(o * thsize, thsize);
+        const auto &rs = child.rotateThermodynamicForces(s, r);
+        const auto Kip =
+            this->K.subspan(o * (this->K_stride), this->K_stride);
+        this->template updateElementInnerForces<N>(Fe, rs, dshape, w);
+        this->template updateElementStiffnessMatrix<N>(Ke, Kip, shape, dshape,
+                                                       w, symmetric);
+      }
+    });
+    if (symmetric) {
+      BehaviourIntegratorBase::completeStiffnessMatrixBySymmetry(Ke, nnodes);
+    }
+  }  // end of implementUpdateResidualAndJacobian
+
+  template <typename Child>
+  void
+  StandardBehaviourIntegratorCRTPBase<Child>::implementUpdateJacobianAction(
+      mfem::Vector &Ye,
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &Xe) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    auto &lw = this->getThreadWorkspace();
+    if constexpr (Traits::updateExternalStateVariablesFromUnknownsValues) {
+      // the derivatives with respect to the external state variables are not
+      // described by the tangent operator blocks alone
+      this->implementUpdateJacobian(lw.Ke, e, tr);
+      Ye.SetSize(lw.Ke.Height());
+      lw.Ke.Mult(Xe, Ye);
+    } else {
+      auto &child = static_cast<Child &>(*this);
+      const auto &ir = child.getIntegrationRule(e, tr);
+      if constexpr (!Traits::gradientsComputationRequiresShapeFunctions) {
+        // sum factorisation does not pay off for linear elements
+        if (e.GetOrder() > 1) {
+          const auto *const maps = getTensorProductBasisMaps(e, ir);
+          if (maps != nullptr) {
+            this->updateJacobianActionBySumFactorisation(Ye, e, tr, Xe, ir,
+                                                         *maps);
+            return;
+          }
+        }
+      }
+      auto &shape = lw.shape;
+      if constexpr (Traits::gradientsComputationRequiresShapeFunctions) {
+        shape.SetSize(e.GetDof());
+      }
+      const auto *const gc = this->quadrature_space->getGeometricCache();
+      const auto nnodes = e.GetDof();
+      const auto gsize = this->s1.gradients_stride;
+      const auto thsize = this->s1.thermodynamic_forces_stride;
+      lw.gradients_increment.resize(gsize);
+      lw.thermodynamic_forces_increment.resize(thsize);
+      auto dg = mgis::span<real>(lw.gradients_increment.data(), gsize);
+      auto *const ds = lw.thermodynamic_forces_increment.data();
+      const auto rds = mgis::span<const real>(ds, thsize);
+      // element offset
+      const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
+      Ye.SetSize(nnodes * Traits::unknownsSize);
+      Ye = 0.;
+      this->dispatchOnNumberOfNodes(nnodes, [&](auto number_of_nodes) {
+        constexpr auto N = decltype(number_of_nodes)::value;
+        for (size_type i = 0; i != ir.GetNPoints(); ++i) {
+          const auto &ip = ir.IntPoint(i);
+          // offset of the integration point
+          const auto o = eoffset + i;
+          tr.SetIntPoint(&ip);
+          if constexpr (Traits::gradientsComputationRequiresShapeFunctions) {
+            // get the values of the shape functions
+            e.CalcPhysShape(tr, shape);
+          }
+          // get the gradients of the shape functions
+          const auto &dshape =
+              this->getShapeFunctionsDerivatives(lw, e, tr, o);
+          // get the weights associated to point ip
+          const auto w = (gc != nullptr)
+                             ? gc->weights[o]
+                             : child.getIntegrationPointWeight(tr, ip);
+          // linearised gradients, in the global frame
+          std::fill(dg.begin(), dg.end(), real{0});
+          this->template updateElementGradients<N>(dg, Xe, shape, dshape);
+          // linearised thermodynamic forces. The tangent operator blocks
+          // have been rotated in the global frame after the integration.
+          const auto *const Kip = this->K.data() + o * (this->K_stride);
+          for (size_type r = 0; r != thsize; ++r) {
+            auto v = real{0};
+            for (size_type c = 0; c != gsize; ++c) {
+              v += Kip[r * gsize + c] * dg[c];
+            }
+            ds[r] = v;
+          }
+          this->template updateElementInnerForces<N>(Ye, rds, dshape, w);
+        }
+      });
+    }
+  }  // end of implementUpdateJacobianAction
+
+  template <typename Child>
+  const typename StandardBehaviourIntegratorCRTPBase<
+      Child>::SumFactorisationOperators &
+  StandardBehaviourIntegratorCRTPBase<Child>::getSumFactorisationOperators(
+      const size_type d) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    constexpr size_type ncomps = Traits::unknownsSize;
+    auto &ops = this->sum_factorisation_operators;
+    std::call_once(ops.initialisation_flag, [this, &ops, d] {
+      auto &lw = this->getThreadWorkspace();
+      // number of derivatives of the unknowns
+      const auto nd = ncomps * d;
+      const auto gsize = this->s1.gradients_stride;
+      const auto thsize = this->s1.thermodynamic_forces_stride;
+      lw.gradients_increment.resize(gsize);
+      lw.thermodynamic_forces_increment.resize(thsize);
+      auto dg = mgis::span<real>(lw.gradients_increment.data(), gsize);
+      auto *const ds = lw.thermodynamic_forces_increment.data();
+      const auto rds = mgis::span<const real>(ds, thsize);
+      // The operators are extracted from the kernels of the child class
+      // applied to an element made of a single node whose derivatives of the
+      // shape function are the unit vectors.
+      auto &A = ops.gradients_operator;
+      auto &C = ops.inner_forces_operator;
+      A.resize(gsize * nd);
+      C.resize(nd * thsize);
+      mfem::DenseMatrix dN(1, d);
+      mfem::Vector u1(ncomps);
+      mfem::Vector f1(ncomps);
+      for (size_type j = 0; j != d; ++j) {
+        dN = real{0};
+        dN(0, j) = real{1};
+        for (size_type c = 0; c != ncomps; ++c) {
+          u1 = real{0};
+          u1(c) = real{1};
+          std::fill(dg.begin(), dg.end(), real{0});
+          this->template updateElementGradients<0>(dg, u1, lw.shape, dN);
+          for (size_type r = 0; r != gsize; ++r) {
+            A[r * nd + c * d + j] = dg[r];
+          }
+        }
+        for (size_type r = 0; r != thsize; ++r) {
+          std::fill(ds, ds + thsize, real{0});
+          ds[r] = real{1};
+          f1 = real{0};
+          this->template updateElementInnerForces<0>(f1, rds, dN, real{1});
+          for (size_type c = 0; c != ncomps; ++c) {
+            C[(c * d + j) * thsize + r] = f1(c);
+          }
+        }
+      }
+    });
+    return ops;
+  }  // end of getSumFactorisationOperators
+
+  template <typename Child>
+  void StandardBehaviourIntegratorCRTPBase<Child>::
+      updateJacobianActionBySumFactorisation(mfem::Vector &Ye,
+                                             const mfem::FiniteElement &e,
+                                             mfem::ElementTransformation &tr,
+                                             const mfem::Vector &Xe,
+                                             const mfem::IntegrationRule &ir,
+                                             const mfem::DofToQuad &maps) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    constexpr size_type ncomps = Traits::unknownsSize;
+    auto &child = static_cast<Child &>(*this);
+    auto &lw = this->getThreadWorkspace();
+    const auto *const gc = this->quadrature_space->getGeometricCache();
+    const auto d = static_cast<size_type>(e.GetDim());
+    const auto nnodes = e.GetDof();
+    const auto nq = ir.GetNPoints();
+    // number of derivatives of the unknowns
+    const auto nd = ncomps * d;
+    const auto gsize = this->s1.gradients_stride;
+    const auto thsize = this->s1.thermodynamic_forces_stride;
+    lw.gradients_increment.resize(gsize);
+    lw.thermodynamic_forces_increment.resize(thsize);
+    auto dg = mgis::span<real>(lw.gradients_increment.data(), gsize);
+    auto *const ds = lw.thermodynamic_forces_increment.data();
+    const auto &ops = this->getSumFactorisationOperators(d);
+    const auto &A = ops.gradients_operator;
+    const auto &C = ops.inner_forces_operator;
+    // nodal values in lexicographic order
+    const auto &dof_map = getLexicographicOrdering(e);
+    const auto node = [&dof_map](const size_type n) {
+      return (dof_map.Size() == 0) ? n : dof_map[n];
+    };
+    auto &X = lw.lexicographic_nodal_values;
+    X.resize(ncomps * nnodes);
+    for (size_type c = 0; c != ncomps; ++c) {
+      for (size_type n = 0; n != nnodes; ++n) {
+        X[c * nnodes + n] = Xe[c * nnodes + node(n)];
+      }
+    }
+    // derivatives of each component with respect to the reference
+    // coordinates at the integration points
+    auto &D = lw.reference_gradients;
+    D.resize(ncomps * nq * d);
+    for (size_type c = 0; c != ncomps; ++c) {
+      interpolateReferenceGradients(D.data() + c * nq * d,
+                                    lw.sum_factorisation_workspace, maps, d,
+                                    X.data() + c * nnodes);
+    }
+    auto &pg = lw.physical_gradients;
+    pg.resize(2 * nd);
+    auto *const gu = pg.data();
+    auto *const fu = pg.data() + nd;
+    // element offset
+    const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
+    for (size_type q = 0; q != nq; ++q) {
+      const auto &ip = ir.IntPoint(q);
       // offset of the integration point
-      const auto o = eoffset + i;
-      const auto Kip = this->K.subspan(o * (this->K_stride), this->K_stride);
-      // assembly of the stiffness matrix
+      const auto o = eoffset + q;
+      tr.SetIntPoint(&ip);
+      const auto &Jinv = tr.InverseJacobian();
+      // get the weights associated to point ip
+      const auto w = (gc != nullptr) ? gc->weights[o]
+                                     : child.getIntegrationPointWeight(tr, ip);
+      // derivatives of the unknowns in the physical frame
+      for (size_type c = 0; c != ncomps; ++c) {
+        const auto *const Dq = D.data() + (c * nq + q) * d;
+        for (size_type j = 0; j != d; ++j) {
+          auto v = real{0};
+          for (size_type k = 0; k != d; ++k) {
+            v += Dq[k] * Jinv(k, j);
+          }
+          gu[c * d + j] = v;
+        }
+      }
+      // linearised gradients
+      for (size_type r = 0; r != gsize; ++r) {
+        auto v = real{0};
+        for (size_type i = 0; i != nd; ++i) {
+          v += A[r * nd + i] * gu[i];
+        }
+        dg[r] = v;
+      }
+      // linearised thermodynamic forces. The tangent operator blocks have
+      // been rotated in the global frame after the integration.
+      const auto *const Kip = this->K.data() + o * (this->K_stride);
+      for (size_type r = 0; r != thsize; ++r) {
+        auto v = real{0};
+        for (size_type c = 0; c != gsize; ++c) {
+          v += Kip[r * gsize + c] * dg[c];
+        }
+        ds[r] = v;
+      }
+      // contributions to the inner forces, per derivative of the shape
+      // functions in the physical frame
+      for (size_type i = 0; i != nd; ++i) {
+        auto v = real{0};
+        for (size_type r = 0; r != thsize; ++r) {
+          v += C[i * thsize + r] * ds[r];
+        }
+        fu[i] = v;
+      }
+      // the derivatives with respect to the reference coordinates are
+      // replaced by the contributions to be integrated
+      for (size_type c = 0; c != ncomps; ++c) {
+        auto *const Dq = D.data() + (c * nq + q) * d;
+        for (size_type k = 0; k != d; ++k) {
+          auto v = real{0};
+          for (size_type j = 0; j != d; ++j) {
+            v += fu[c * d + j] * Jinv(k, j);
+          }
+          Dq[k] = w * v;
+        }
+      }
+    }
+    std::fill(X.begin(), X.end(), real{0});
+    for (size_type c = 0; c != ncomps; ++c) {
+      integrateReferenceGradients(X.data() + c * nnodes,
+                                  lw.sum_factorisation_workspace, maps, d,
+                                  D.data() + c * nq * d);
+    }
+    Ye.SetSize(nnodes * ncomps);
+    for (size_type c = 0; c != ncomps; ++c) {
+      for (size_type n = 0; n != nnodes; ++n) {
+        Ye[c * nnodes + node(n)] = X[c * nnodes + n];
+      }
+    }
+  }  // end of updateJacobianActionBySumFactorisation
+
+  template <typename Child>
+  bool StandardBehaviourIntegratorCRTPBase<
+      Child>::useSymmetricStiffnessMatrixKernel(const size_type o,
+                                                const size_type n) const {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    if constexpr (Traits::hasSymmetricStiffnessMatrixKernel) {
+      return (this->use_symmetric_stiffness_matrix_kernel) &&
+             (this->areTangentOperatorsSymmetric(o, n));
+    } else {
+      static_cast<void>(o);
+      static_cast<void>(n);
+      return false;
+    }
+  }  // end of useSymmetricStiffnessMatrixKernel
+
+  template <typename Child>
+  template <typename Functor>
+  void StandardBehaviourIntegratorCRTPBase<Child>::dispatchOnNumberOfNodes(
+      const size_type n, const Functor &f) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    if constexpr (Traits::hasVectorisedKernels) {
+      switch (n) {
+        case 4:
+          f(std::integral_constant<size_type, 4>{});
+          return;
+        case 8:
+          f(std::integral_constant<size_type, 8>{});
+          return;
+        case 10:
+          f(std::integral_constant<size_type, 10>{});
+          return;
+        case 20:
+          f(std::integral_constant<size_type, 20>{});
+          return;
+        default:
+          break;
+      }
+    } else {
+      static_cast<void>(n);
+    }
+    f(std::integral_constant<size_type, 0>{});
+  }  // end of dispatchOnNumberOfNodes
+
+  template <typename Child>
+  template <size_type N>
+  void StandardBehaviourIntegratorCRTPBase<Child>::updateElementGradients(
+      mgis::span<real> &g,
+      const mfem::Vector &u,
+      const mfem::Vector &shape,
+      const mfem::DenseMatrix &dshape) {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    auto &child = static_cast<Child &>(*this);
+    // the shape functions are not used by all the kernels
+    static_cast<void>(shape);
+    if constexpr (Traits::hasVectorisedKernels) {
+      if (this->use_vectorised_kernels) {
+        child.template updateGradientsVectorised<N>(g, u, dshape);
+        return;
+      }
+    }
+    const auto nnodes = dshape.NumRows();
+    for (size_type ni = 0; ni != nnodes; ++ni) {
+      if constexpr (Traits::gradientsComputationRequiresShapeFunctions) {
+        child.updateGradients(g, u, shape, dshape, ni);
+      } else {
+        child.updateGradients(g, u, dshape, ni);
+      }
+    }
+  }  // end of updateElementGradients
+
+  template <typename Child>
+  template <size_type N>
+  void StandardBehaviourIntegratorCRTPBase<Child>::updateElementInnerForces(
+      mfem::Vector &Fe,
+      const mgis::span<const real> &s,
+      const mfem::DenseMatrix &dshape,
+      const real w) const {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    const auto &child = static_cast<const Child &>(*this);
+    if constexpr (Traits::hasVectorisedKernels) {
+      if (this->use_vectorised_kernels) {
+        child.template updateInnerForcesVectorised<N>(Fe, s, dshape, w);
+        return;
+      }
+    }
+    const auto nnodes = dshape.NumRows();
+    for (size_type ni = 0; ni != nnodes; ++ni) {
+      child.updateInnerForces(Fe, s, dshape, w, ni);
+    }
+  }  // end of updateElementInnerForces
+
+  template <typename Child>
+  template <size_type N>
+  void
+  StandardBehaviourIntegratorCRTPBase<Child>::updateElementStiffnessMatrix(
+      mfem::DenseMatrix &Ke,
+      const mgis::span<const real> &Kip,
+      const mfem::Vector &shape,
+      const mfem::DenseMatrix &dshape,
+      const real w,
+      const bool symmetric) const {
+    using Traits = BehaviourIntegratorTraits<Child>;
+    const auto &child = static_cast<const Child &>(*this);
+    const auto nnodes = dshape.NumRows();
+    if constexpr (Traits::updateExternalStateVariablesFromUnknownsValues) {
       for (size_type ni = 0; ni != nnodes; ++ni) {
-        if constexpr (updateExt) {
-          child.updateStiffnessMatrix(Ke, Kip, shape, dshape, w, ni);
-        } else {
-          child.updateStiffnessMatrix(Ke, Kip, dshape, w, ni);
+        child.updateStiffnessMatrix(Ke, Kip, shape, dshape, w, ni);
+      }
+    } else {
+      static_cast<void>(shape);
+      if constexpr (Traits::hasVectorisedKernels) {
+        if (this->use_vectorised_kernels) {
+          if (symmetric) {
+            child.template updateSymmetricStiffnessMatrixVectorised<N>(
+                Ke, Kip, dshape, w);
+          } else {
+            child.template updateStiffnessMatrixVectorised<N>(Ke, Kip, dshape,
+                                                              w);
+          }
+          return;
+        }
+      }
+      if constexpr (Traits::hasSymmetricStiffnessMatrixKernel) {
+        if (symmetric) {
+          for (size_type ni = 0; ni != nnodes; ++ni) {
+            child.updateSymmetricStiffnessMatrix(Ke, Kip, dshape, w, ni);
+          }
+          return;
         }
       }
+      for (size_type ni = 0; ni != nnodes; ++ni) {
+        child.updateStiffnessMatrix(Ke, Kip, dshape, w, ni);
+      }
     }
-  }  // end of implementUpdateJacobian
+  }  // end of updateElementStiffnessMatrix
 
   template <typename Child>
   StandardBehaviourIntegratorCRTPBase<
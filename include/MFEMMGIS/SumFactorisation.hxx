@@ -0,0 +1,77 @@
+/*!
+ * \file   include/MFEMMGIS/SumFactorisation.hxx
+ * \brief  This file declares functions used to evaluate the derivatives of
+ * the shape functions of tensor-product elements by sum factorisation.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#ifndef LIB_MFEMMGIS_SUMFACTORISATION_HXX
+#define LIB_MFEMMGIS_SUMFACTORISATION_HXX
+
+#include <vector>
+#include "MFEMMGIS/Config.hxx"
+
+namespace mfem_mgis {
+
+  /*!
+   * \return the one-dimensional shape functions and their derivatives
+   * evaluated at the one-dimensional integration points if the given element
+   * is a quadrilateral or hexahedral tensor-product element and if the given
+   * integration rule is the tensor product of a one-dimensional rule, or a
+   * null pointer otherwise.
+   * \param[in] e: finite element
+   * \param[in] ir: integration rule
+   *
+   * \note the integration points of the rule are assumed to be ordered
+   * lexicographically, as the rules returned by `mfem::IntRules`. This is
+   * checked.
+   */
+  MFEM_MGIS_EXPORT const mfem::DofToQuad *getTensorProductBasisMaps(
+      const mfem::FiniteElement &, const mfem::IntegrationRule &);
+  /*!
+   * \return the mapping between the lexicographic numbering of the nodes of
+   * a tensor-product element and their numbering in the element. An empty
+   * array means that both numberings are the same.
+   * \param[in] e: finite element
+   */
+  MFEM_MGIS_EXPORT const mfem::Array<int> &getLexicographicOrdering(
+      const mfem::FiniteElement &);
+  /*!
+   * \brief compute, by sum factorisation, the derivatives of a scalar field
+   * with respect to the reference coordinates at all the integration points
+   * of a tensor-product element.
+   * \param[out] D: derivatives. The derivative with respect to the `k`-th
+   * reference coordinate at the `q`-th integration point is stored at the
+   * position `q * d + k` where `d` is the dimension.
+   * \param[out] wk: workspace
+   * \param[in] m: one-dimensional shape functions and their derivatives
+   * \param[in] d: dimension
+   * \param[in] X: nodal values of the scalar field in lexicographic order
+   */
+  MFEM_MGIS_EXPORT void interpolateReferenceGradients(real *const,
+                                                      std::vector<real> &,
+                                                      const mfem::DofToQuad &,
+                                                      const size_type,
+                                                      const real *const);
+  /*!
+   * \brief apply the transpose of the `interpolateReferenceGradients`
+   * operator: the contributions of the vectors given at each integration
+   * point, multiplied by the derivatives of the shape functions with respect
+   * to the reference coordinates, are added to the nodal values.
+   * \param[in,out] Y: nodal values in lexicographic order
+   * \param[out] wk: workspace
+   * \param[in] m: one-dimensional shape functions and their derivatives
+   * \param[in] d: dimension
+   * \param[in] T: vectors at the integration points, stored as the
+   * derivatives computed by the `interpolateReferenceGradients` function.
+   */
+  MFEM_MGIS_EXPORT void integrateReferenceGradients(real *const,
+                                                    std::vector<real> &,
+                                                    const mfem::DofToQuad &,
+                                                    const size_type,
+                                                    const real *const);
+
+}  // end of namespace mfem_mgis
+
+#endif /* LIB_MFEMMGIS_SUMFACTORISATION_HXX */
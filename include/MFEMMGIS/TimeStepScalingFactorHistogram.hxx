@@ -0,0 +1,93 @@
+/*!
+ * \file   include/MFEMMGIS/TimeStepScalingFactorHistogram.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#ifndef LIB_MFEMMGIS_TIMESTEPSCALINGFACTORHISTOGRAM_HXX
+#define LIB_MFEMMGIS_TIMESTEPSCALINGFACTORHISTOGRAM_HXX
+
+#include <array>
+#include <cmath>
+#include "MFEMMGIS/Config.hxx"
+
+namespace mfem_mgis {
+
+  /*!
+   * \brief histogram of the ratios between the time step proposed by the
+   * behaviours and the current time step.
+   *
+   * The bins are defined by powers of two:
+   *
+   * - the first bin counts the values lower than \f$2^{-6}\f$ (and invalid
+   *   values).
+   * - the bin \f$i\f$, for \f$i\f$ in \f$[1:6]\f$, counts the values in
+   *   \f$[2^{i-7}:2^{i-6}[\f$.
+   * - the last bin counts the values greater than or equal to one, i.e. the
+   *   integration points for which the behaviour does not require any
+   *   reduction of the time step.
+   *
+   * The integration points where the integration of the behaviour failed
+   * are not counted in those bins, since the ratio proposed by a behaviour
+   * in this case is not meaningful, but in a separate counter.
+   */
+  struct TimeStepScalingFactorHistogram {
+    //! \brief number of bins
+    static constexpr size_type number_of_bins = 8;
+    /*!
+     * \return the index of the bin associated with the given value
+     * \param[in] r: ratio between the time step proposed by a behaviour and
+     * the current time step
+     */
+    static inline size_type getBinIndex(const real r) {
+      if (r >= real{1}) {
+        return number_of_bins - 1;
+      }
+      if (!(r >= std::ldexp(real{1}, 2 - number_of_bins))) {
+        return 0;
+      }
+      auto e = int{};
+      std::frexp(r, &e);
+      return number_of_bins - 2 + e;
+    }  // end of getBinIndex
+    //! \brief reset the histogram
+    inline void reset() {
+      this->counts.fill(size_type{});
+      this->number_of_failures = size_type{};
+    }  // end of reset
+    /*!
+     * \brief add a new value
+     * \param[in] r: ratio between the time step proposed by a behaviour and
+     * the current time step
+     */
+    inline void add(const real r) { ++(this->counts[getBinIndex(r)]); }
+    //! \brief count a failed integration of a behaviour
+    inline void addFailure() { ++(this->number_of_failures); }
+    /*!
+     * \brief add the values of another histogram
+     * \param[in] h: histogram
+     */
+    inline void merge(const TimeStepScalingFactorHistogram& h) {
+      for (size_type i = 0; i != number_of_bins; ++i) {
+        this->counts[i] += h.counts[i];
+      }
+      this->number_of_failures += h.number_of_failures;
+    }  // end of merge
+    //! \return the number of values, failures excluded
+    inline size_type getNumberOfValues() const {
+      auto n = size_type{};
+      for (const auto c : this->counts) {
+        n += c;
+      }
+      return n;
+    }  // end of getNumberOfValues
+    //! \brief number of values in each bin
+    std::array<size_type, number_of_bins> counts = {};
+    //! \brief number of failed integrations
+    size_type number_of_failures = size_type{};
+  };  // end of struct TimeStepScalingFactorHistogram
+
+}  // end of namespace mfem_mgis
+
+#endif /* LIB_MFEMMGIS_TIMESTEPSCALINGFACTORHISTOGRAM_HXX */
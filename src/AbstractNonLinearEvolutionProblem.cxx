@@ -20,6 +20,8 @@ namespace mfem_mgis {
   const char *const
       AbstractNonLinearEvolutionProblem::SolverMaximumNumberOfIterations =
           "MaximumNumberOfIterations";
+  const char *const AbstractNonLinearEvolutionProblem::SolverPredictionPolicy =
+      "PredictionPolicy";
 
   size_type getMaterialIdentifier(const AbstractNonLinearEvolutionProblem &p,
                                   const Parameters &params) {
@@ -0,0 +1,203 @@
+/*!
+ * \file   src/AdaptiveTimeStepping.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cmath>
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MFEMMGIS/Parameters.hxx"
+#include "MFEMMGIS/AbstractNonLinearEvolutionProblem.hxx"
+#include "MFEMMGIS/AdaptiveTimeStepping.hxx"
+
+namespace mfem_mgis {
+
+  const char *const AdaptiveTimeStepping::InitialTimeIncrement =
+      "InitialTimeIncrement";
+
+  const char *const AdaptiveTimeStepping::MinimalTimeIncrement =
+      "MinimalTimeIncrement";
+
+  const char *const AdaptiveTimeStepping::MaximalTimeIncrement =
+      "MaximalTimeIncrement";
+
+  const char *const AdaptiveTimeStepping::TargetNumberOfIterations =
+      "TargetNumberOfIterations";
+
+  const char *const AdaptiveTimeStepping::MinimalTimeStepScalingFactor =
+      "MinimalTimeStepScalingFactor";
+
+  const char *const AdaptiveTimeStepping::MaximalTimeStepScalingFactor =
+      "MaximalTimeStepScalingFactor";
+
+  const char *const AdaptiveTimeStepping::MaximumNumberOfSuccessiveFailures =
+      "MaximumNumberOfSuccessiveFailures";
+
+  std::vector<std::string> AdaptiveTimeStepping::getParametersList() {
+    return {AdaptiveTimeStepping::InitialTimeIncrement,
+            AdaptiveTimeStepping::MinimalTimeIncrement,
+            AdaptiveTimeStepping::MaximalTimeIncrement,
+            AdaptiveTimeStepping::TargetNumberOfIterations,
+            AdaptiveTimeStepping::MinimalTimeStepScalingFactor,
+            AdaptiveTimeStepping::MaximalTimeStepScalingFactor,
+            AdaptiveTimeStepping::MaximumNumberOfSuccessiveFailures};
+  }  // end of getParametersList
+
+  /*!
+   * \return the value of a strictly positive parameter
+   * \param[in] params: parameters
+   * \param[in] n: name of the parameter
+   * \param[in] v: default value
+   */
+  static real getPositiveValue(const Parameters &params,
+                               const char *const n,
+                               const real v) {
+    if (!contains(params, n)) {
+      return v;
+    }
+    const auto value = get<double>(params, n);
+    if (!(value > 0)) {
+      raise("AdaptiveTimeStepping::AdaptiveTimeStepping: invalid value for '" +
+            std::string(n) + "'");
+    }
+    return value;
+  }  // end of getPositiveValue
+
+  /*!
+   * \return the value of a strictly positive integer parameter
+   * \param[in] params: parameters
+   * \param[in] n: name of the parameter
+   * \param[in] v: default value
+   */
+  static size_type getPositiveInteger(const Parameters &params,
+                                      const char *const n,
+                                      const size_type v) {
+    if (!contains(params, n)) {
+      return v;
+    }
+    const auto value = get<int>(params, n);
+    if (value < 1) {
+      raise("AdaptiveTimeStepping::AdaptiveTimeStepping: invalid value for '" +
+            std::string(n) + "'");
+    }
+    return static_cast<size_type>(value);
+  }  // end of getPositiveInteger
+
+  AdaptiveTimeStepping::AdaptiveTimeStepping(
+      AbstractNonLinearEvolutionProblem &p, const Parameters &params)
+      : problem(p) {
+    checkParameters(params, AdaptiveTimeStepping::getParametersList());
+    this->dt = getPositiveValue(
+        params, AdaptiveTimeStepping::InitialTimeIncrement, real{0});
+    this->dt_min = getPositiveValue(
+        params, AdaptiveTimeStepping::MinimalTimeIncrement, real{0});
+    this->dt_max =
+        getPositiveValue(params, AdaptiveTimeStepping::MaximalTimeIncrement,
+                         std::numeric_limits<real>::max());
+    this->target_number_of_iterations = getPositiveInteger(
+        params, AdaptiveTimeStepping::TargetNumberOfIterations,
+        this->target_number_of_iterations);
+    this->minimal_scaling_factor = getPositiveValue(
+        params, AdaptiveTimeStepping::MinimalTimeStepScalingFactor,
+        this->minimal_scaling_factor);
+    this->maximal_scaling_factor = getPositiveValue(
+        params, AdaptiveTimeStepping::MaximalTimeStepScalingFactor,
+        this->maximal_scaling_factor);
+    this->maximum_number_of_successive_failures = getPositiveInteger(
+        params, AdaptiveTimeStepping::MaximumNumberOfSuccessiveFailures,
+        this->maximum_number_of_successive_failures);
+    if (this->dt_min > this->dt_max) {
+      raise(
+          "AdaptiveTimeStepping::AdaptiveTimeStepping: "
+          "the minimal time increment is greater than the maximal one");
+    }
+    this->dt = std::min(this->dt, this->dt_max);
+    if ((this->minimal_scaling_factor >= 1) ||
+        (this->maximal_scaling_factor <= 1)) {
+      raise(
+          "AdaptiveTimeStepping::AdaptiveTimeStepping: "
+          "invalid bounds for the time step scaling factor");
+    }
+  }  // end of AdaptiveTimeStepping
+
+  real AdaptiveTimeStepping::getTimeStepScalingFactor(
+      const NonLinearResolutionOutput &r) const {
+    // ratio suggested by the number of iterations of the non linear solver
+    auto f = this->maximal_scaling_factor;
+    if (r.iterations != 0) {
+      f = static_cast<real>(this->target_number_of_iterations) /
+          static_cast<real>(r.iterations);
+    }
+    if (!r.status) {
+      // the time step is at least halved after a failure
+      f = std::min(f, real(0.5));
+    }
+    // ratio proposed by the behaviours
+    if (std::isfinite(r.time_step_scaling_factor)) {
+      f = std::min(f, r.time_step_scaling_factor);
+    }
+    return std::clamp(f, this->minimal_scaling_factor,
+                      this->maximal_scaling_factor);
+  }  // end of getTimeStepScalingFactor
+
+  NonLinearResolutionOutput AdaptiveTimeStepping::solve(const real t0,
+                                                        const real t1) {
+    if (t1 <= t0) {
+      raise("AdaptiveTimeStepping::solve: invalid time interval");
+    }
+    // time increments smaller than this value are considered null
+    const auto eps = 10 * std::numeric_limits<real>::epsilon() * (t1 - t0);
+    if (!(this->dt > 0)) {
+      this->dt = std::min(t1 - t0, this->dt_max);
+    }
+    auto output = NonLinearResolutionOutput{};
+    auto t = t0;
+    auto nfailures = size_type{};
+    while (t1 - t > eps) {
+      // the last time step is shortened to reach the final time. It is
+      // also extended to avoid a very small time step afterwards.
+      const auto is_last_step = t1 - t < this->dt + this->dt_min + eps;
+      const auto ldt = is_last_step ? t1 - t : this->dt;
+      output = this->problem.solve(t, ldt);
+      if (!output.status) {
+        this->problem.revert();
+        ++(this->statistics.number_of_rejected_steps);
+        this->statistics.number_of_rejected_iterations += output.iterations;
+        ++nfailures;
+        this->dt = ldt * this->getTimeStepScalingFactor(output);
+        if ((nfailures == this->maximum_number_of_successive_failures) ||
+            (this->dt < this->dt_min)) {
+          return output;
+        }
+        continue;
+      }
+      this->problem.update();
+      nfailures = size_type{};
+      auto &s = this->statistics;
+      ++(s.number_of_accepted_steps);
+      s.number_of_iterations += output.iterations;
+      s.minimal_time_increment = std::min(s.minimal_time_increment, ldt);
+      s.maximal_time_increment = std::max(s.maximal_time_increment, ldt);
+      t = is_last_step ? t1 : t + ldt;
+      // a shortened last time step shall not reduce the next time increment
+      const auto rdt = std::max(ldt, this->dt);
+      this->dt = std::clamp(rdt * this->getTimeStepScalingFactor(output),
+                            this->dt_min, this->dt_max);
+    }
+    return output;
+  }  // end of solve
+
+  real AdaptiveTimeStepping::getTimeIncrement() const {
+    return this->dt;
+  }  // end of getTimeIncrement
+
+  const AdaptiveTimeSteppingStatistics &AdaptiveTimeStepping::getStatistics()
+      const {
+    return this->statistics;
+  }  // end of getStatistics
+
+  AdaptiveTimeStepping::~AdaptiveTimeStepping() = default;
+
+}  // end of namespace mfem_mgis
@@ -27,7 +27,8 @@ namespace mfem_mgis {
     const auto& qspace = bi.getPartialQuadratureSpace();
     const auto& fespace = qspace.getFiniteElementDiscretization()
                               .getFiniteElementSpace<parallel>();
-    for (const auto [e, eo] : qspace.getOffsets()) {
+    for (const auto e : qspace.getElements()) {
+      const auto eo = qspace.getOffset(e);
       const auto& fe = *(fespace.GetFE(e));
       auto& tr = *(fespace.GetElementTransformation(e));
       const auto& ir = bi.getIntegrationRule(fe, tr);
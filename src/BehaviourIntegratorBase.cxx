@@ -5,25 +5,131 @@
  * \date   13/10/2020
  */
 
+#include <cmath>
+#include <limits>
 #include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "mfem/fem/fe.hpp"
 #include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
 #include "MGIS/Behaviour/Integrate.hxx"
 #include "MGIS/Behaviour/BehaviourDataView.hxx"
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/IntegrationType.hxx"
+#include "MFEMMGIS/PartialQuadratureSpace.hxx"
 #include "MFEMMGIS/BehaviourIntegratorBase.hxx"
 
 namespace mfem_mgis {
 
+  /*!
+   * \return the exit status of a call to one of the `integrate` functions
+   * provided by `MGIS`.
+   *
+   * Depending on the version of `MGIS`, those functions return either
+   * an integer or a structure with an `exit_status` member.
+   *
+   * \param[in] r: result of the integration
+   */
+  template <typename ResultType>
+  static int getExitStatus(const ResultType& r) {
+    if constexpr (std::is_integral_v<ResultType>) {
+      return static_cast<int>(r);
+    } else {
+      return r.exit_status;
+    }
+  }  // end of getExitStatus
+
+  /*!
+   * \return the time step scaling factor of a call to one of the `integrate`
+   * functions provided by `MGIS`, or one if this information is not
+   * available in the version of `MGIS` used.
+   *
+   * \param[in] r: result of the integration
+   */
+  template <typename ResultType>
+  static real getTimeStepIncreaseFactor(const ResultType& r) {
+    if constexpr (std::is_integral_v<ResultType>) {
+      return real{1};
+    } else {
+      return r.time_step_increase_factor;
+    }
+  }  // end of getTimeStepIncreaseFactor
+
   BehaviourIntegratorBase::BehaviourIntegratorBase(
       std::shared_ptr<const PartialQuadratureSpace> s,
       std::unique_ptr<const Behaviour> b_ptr)
       : Material(s, std::move(b_ptr)) {
     // The following arrays are storing material properties and external
-    // state variables. They can be allocated a single time
-    this->wks.mps.resize(getArraySize(this->b.mps, this->b.hypothesis));
-    this->wks.esvs0.resize(getArraySize(this->b.esvs, this->b.hypothesis));
-    this->wks.esvs1.resize(getArraySize(this->b.esvs, this->b.hypothesis));
+    // state variables. They can be allocated a single time. The workspaces
+    // of the other threads are allocated by the `setup` method.
+    auto& w = this->wks.threads.emplace_back();
+    w.mps.resize(getArraySize(this->b.mps, this->b.hypothesis));
+    w.esvs0.resize(getArraySize(this->b.esvs, this->b.hypothesis));
+    w.esvs1.resize(getArraySize(this->b.esvs, this->b.hypothesis));
   }  // end of BehaviourIntegratorBase
 
+  bool BehaviourIntegratorBase::areTangentOperatorsSymmetric(
+      const size_type o, const size_type n) const {
+    const auto gsize = this->s1.gradients_stride;
+    if ((gsize != this->s1.thermodynamic_forces_stride) ||
+        (this->K_stride != gsize * gsize)) {
+      return false;
+    }
+    // relative tolerance on the symmetry of the tangent operator
+    constexpr auto eps = 100 * std::numeric_limits<real>::epsilon();
+    for (size_type i = 0; i != n; ++i) {
+      const auto* const Kip = this->K.data() + (o + i) * (this->K_stride);
+      auto m = real{0};
+      for (size_type k = 0; k != this->K_stride; ++k) {
+        m = std::max(m, std::abs(Kip[k]));
+      }
+      for (size_type r = 0; r != gsize; ++r) {
+        for (size_type c = r + 1; c != gsize; ++c) {
+          if (std::abs(Kip[r * gsize + c] - Kip[c * gsize + r]) > eps * m) {
+            return false;
+          }
+        }
+      }
+    }
+    return true;
+  }  // end of areTangentOperatorsSymmetric
+
+  void BehaviourIntegratorBase::completeStiffnessMatrixBySymmetry(
+      mfem::DenseMatrix& Ke, const size_type nnodes) {
+    const auto n = Ke.Height();
+    for (size_type r = 0; r != n; ++r) {
+      for (size_type c = 0; c != n; ++c) {
+        if (c % nnodes < r % nnodes) {
+          Ke(r, c) = Ke(c, r);
+        }
+      }
+    }
+  }  // end of completeStiffnessMatrixBySymmetry
+
+  BehaviourIntegratorBase::ThreadWorkspace&
+  BehaviourIntegratorBase::getThreadWorkspace() {
+    return this->wks.threads[getThreadIdentifier()];
+  }  // end of getThreadWorkspace
+
+  const mfem::DenseMatrix&
+  BehaviourIntegratorBase::getShapeFunctionsDerivatives(
+      ThreadWorkspace& lw,
+      const mfem::FiniteElement& e,
+      mfem::ElementTransformation& tr,
+      const size_type o) const {
+    const auto* const c = this->quadrature_space->getGeometricCache();
+    if (c != nullptr) {
+      auto* const p =
+          const_cast<real*>(c->dshapes.data()) + c->dshapes_offsets[o];
+      lw.cached_dshape.UseExternalData(p, e.GetDof(), e.GetDim());
+      return lw.cached_dshape;
+    }
+    lw.dshape.SetSize(e.GetDof(), e.GetDim());
+    e.CalcPhysDShape(tr, lw.dshape);
+    return lw.dshape;
+  }  // end of getShapeFunctionsDerivatives
+
   void BehaviourIntegratorBase::throwInvalidBehaviourType(
       const char* const mn, const char* const m) const {
     auto msg = std::string(mn) + ": invalid behaviour type";
@@ -60,6 +166,9 @@ namespace mfem_mgis {
   }  // end of getMaterial
 
   void BehaviourIntegratorBase::setup(const real, const real) {
+    // the state at the end of the time step may share its buffers with the
+    // state at the beginning of the time step after an update or a revert.
+    this->detachEndOfTimeStepState();
     /*
      * \brief uniform values are treated immediatly. For spatially variable
      * fields, we return the information needed to evaluate them
@@ -116,13 +225,23 @@ namespace mfem_mgis {
 
     // The `b` field refers to MGIS MaterialDataManager class, which
     // is an ancestor class of the current BehaviourIntegratorBase class.
+    auto& w = this->wks.threads.front();
     this->wks.mps_evaluators =
-        dispatch(this->wks.mps, this->s1.material_properties, this->b.mps);
-    this->wks.esvs0_evaluators = dispatch(
-        this->wks.esvs0, this->s0.external_state_variables, this->b.esvs);
-    this->wks.esvs1_evaluators = dispatch(
-        this->wks.esvs1, this->s1.external_state_variables, this->b.esvs);
-  }  // end of revert
+        dispatch(w.mps, this->s1.material_properties, this->b.mps);
+    this->wks.esvs0_evaluators =
+        dispatch(w.esvs0, this->s0.external_state_variables, this->b.esvs);
+    this->wks.esvs1_evaluators =
+        dispatch(w.esvs1, this->s1.external_state_variables, this->b.esvs);
+    // the uniform values are copied in the workspaces of the other threads
+    this->wks.threads.resize(getMaximumNumberOfThreads());
+    const auto& w0 = this->wks.threads.front();
+    for (auto pw = this->wks.threads.begin() + 1;
+         pw != this->wks.threads.end(); ++pw) {
+      pw->mps = w0.mps;
+      pw->esvs0 = w0.esvs0;
+      pw->esvs1 = w0.esvs1;
+    }
+  }  // end of setup
 
   void BehaviourIntegratorBase::checkHypotheses(const Hypothesis h) const {
     using namespace mgis::behaviour;
@@ -136,6 +255,109 @@ namespace mfem_mgis {
     }
   }  // end of BehaviourIntegratorBase::checkHypotheses
 
+  /*!
+   * \brief integrate the behaviour over the time step by dividing it in
+   * \f$2^{l}\f$ substeps, for \f$l\f$ in \f$[1:n]\f$, until success.
+   *
+   * The gradients and the external state variables are linearly interpolated
+   * over the time step. The consistent tangent operator, if requested, is
+   * only computed on the last substep.
+   *
+   * \return the exit status of the last integration
+   * \param[in] v: behaviour data view, as used for the failed integration
+   * \param[in] wk: workspace
+   * \param[in] b: behaviour
+   * \param[in] n: number of levels
+   * \param[in] it: integration type
+   */
+  static int integrateWithSubsteps(mgis::behaviour::BehaviourDataView& v,
+                                   std::vector<real>& wk,
+                                   const mgis::behaviour::Behaviour& b,
+                                   const size_type n,
+                                   const IntegrationType it) {
+    const auto gs = getArraySize(b.gradients, b.hypothesis);
+    const auto ts = getArraySize(b.thermodynamic_forces, b.hypothesis);
+    const auto is = getArraySize(b.isvs, b.hypothesis);
+    const auto es = getArraySize(b.esvs, b.hypothesis);
+    // layout of the workspace:
+    // - gradients at the end of the time step
+    // - state at the beginning of the current substep
+    // - external state variables at the beginning and end of the substep
+    wk.resize(2 * gs + ts + is + 2 + 2 * es);
+    auto* const g1 = wk.data();
+    auto* const sg = g1 + gs;
+    auto* const st = sg + gs;
+    auto* const si = st + ts;
+    auto* const sse = si + is;
+    auto* const sde = sse + 1;
+    auto* const se0 = sde + 1;
+    auto* const se1 = se0 + es;
+    std::copy(v.s1.gradients, v.s1.gradients + gs, g1);
+    const auto e0 = v.s0.external_state_variables;
+    const auto e1 = v.s1.external_state_variables;
+    const auto s0 = v.s0;
+    const auto dt = v.dt;
+    auto* const rdt = v.rdt;
+    auto r = -1;
+    for (size_type l = 1; (l <= n) && (r < 0); ++l) {
+      const auto ns = size_type{1} << l;
+      auto min_rdt = real{1};
+      v.s0 = s0;
+      v.dt = dt / ns;
+      r = 0;
+      for (size_type k = 0; (k != ns) && (r >= 0); ++k) {
+        const auto a0 = static_cast<real>(k) / ns;
+        const auto a1 = static_cast<real>(k + 1) / ns;
+        for (size_type i = 0; i != gs; ++i) {
+          v.s1.gradients[i] = s0.gradients[i] + a1 * (g1[i] - s0.gradients[i]);
+        }
+        for (size_type i = 0; i != es; ++i) {
+          se0[i] = e0[i] + a0 * (e1[i] - e0[i]);
+          se1[i] = e0[i] + a1 * (e1[i] - e0[i]);
+        }
+        v.s0.external_state_variables = se0;
+        v.s1.external_state_variables = se1;
+        const auto kit = (k + 1 == ns)
+                             ? it
+                             : IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+        v.K[0] = static_cast<int>(kit);
+        *rdt = real{1};
+        r = mgis::behaviour::integrate(v, b);
+        if (r < 0) {
+          break;
+        }
+        min_rdt = std::min(min_rdt, *rdt);
+        // the state at the end of the substep is the state at the beginning
+        // of the next one
+        std::copy(v.s1.gradients, v.s1.gradients + gs, sg);
+        std::copy(v.s1.thermodynamic_forces, v.s1.thermodynamic_forces + ts,
+                  st);
+        std::copy(v.s1.internal_state_variables,
+                  v.s1.internal_state_variables + is, si);
+        v.s0.gradients = sg;
+        v.s0.thermodynamic_forces = st;
+        v.s0.internal_state_variables = si;
+        if (v.s1.stored_energy != nullptr) {
+          *sse = *(v.s1.stored_energy);
+          v.s0.stored_energy = sse;
+        }
+        if (v.s1.dissipated_energy != nullptr) {
+          *sde = *(v.s1.dissipated_energy);
+          v.s0.dissipated_energy = sde;
+        }
+      }
+      if (r >= 0) {
+        *rdt = min_rdt / ns;
+      }
+    }
+    // restore the initial state of the behaviour data view
+    std::copy(g1, g1 + gs, v.s1.gradients);
+    v.s0 = s0;
+    v.s1.external_state_variables = e1;
+    v.dt = dt;
+    return r;
+  }  // end of integrateWithSubsteps
+
   bool BehaviourIntegratorBase::performsLocalBehaviourIntegration(
       const size_type ip, const IntegrationType it) {
     const auto g_offset = this->s0.gradients_stride * ip;
@@ -151,13 +373,14 @@ namespace mfem_mgis {
         v[std::get<0>(ev)] = std::get<1>(ev)[i];
       }
     };  // end of eval
-    eval(this->wks.mps, this->wks.mps_evaluators, ip);
-    eval(this->wks.esvs0, this->wks.esvs0_evaluators, ip);
-    eval(this->wks.esvs1, this->wks.esvs1_evaluators, ip);
+    auto& lw = this->getThreadWorkspace();
+    eval(lw.mps, this->wks.mps_evaluators, ip);
+    eval(lw.esvs0, this->wks.esvs0_evaluators, ip);
+    eval(lw.esvs1, this->wks.esvs1_evaluators, ip);
     //
-    rdt = real{1};
+    lw.rdt = real{1};
     mgis::behaviour::BehaviourDataView v;
-    v.rdt = &rdt;
+    v.rdt = &(lw.rdt);
     v.dt = this->time_increment;
     v.K = this->K.data() + this->K_stride * ip;
     v.speed_of_sound = nullptr;
@@ -165,8 +388,8 @@ namespace mfem_mgis {
     v.s1.gradients = this->s1.gradients.data() + g_offset;
     v.s0.thermodynamic_forces = this->s0.thermodynamic_forces.data() + t_offset;
     v.s1.thermodynamic_forces = this->s1.thermodynamic_forces.data() + t_offset;
-    v.s0.material_properties = this->wks.mps.data();
-    v.s1.material_properties = this->wks.mps.data();
+    v.s0.material_properties = lw.mps.data();
+    v.s1.material_properties = lw.mps.data();
     v.s0.internal_state_variables =
         this->s0.internal_state_variables.data() + isvs_offset;
     v.s1.internal_state_variables =
@@ -187,26 +410,135 @@ namespace mfem_mgis {
     }
     v.s0.mass_density = nullptr;
     v.s1.mass_density = nullptr;
-    v.s0.external_state_variables = this->wks.esvs0.data();
-    v.s1.external_state_variables = this->wks.esvs1.data();
+    v.s0.external_state_variables = lw.esvs0.data();
+    v.s1.external_state_variables = lw.esvs1.data();
     v.K[0] = static_cast<int>(it);
-    const auto r = mgis::behaviour::integrate(v, this->b);
+    auto r = mgis::behaviour::integrate(v, this->b);
+    if ((r < 0) && (this->number_of_local_substepping_levels > 0) &&
+        (it >= IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR)) {
+      r = integrateWithSubsteps(v, lw.substepping_workspace, this->b,
+                                this->number_of_local_substepping_levels, it);
+      if (r >= 0) {
+        Profiler::getProfiler().incrementCounter(
+            "LocalSubsteppingRecoveries");
+      }
+    }
+    // the ratio proposed by a behaviour whose integration failed is not
+    // meaningful
+    if (r >= 0) {
+      lw.minimal_rdt = std::min(lw.minimal_rdt, lw.rdt);
+      lw.rdt_histogram.add(lw.rdt);
+    } else {
+      lw.rdt_histogram.addFailure();
+    }
     return (r == 0) || (r == 1);
   }  // end of BehaviourIntegratorBase::integrate
 
+  bool BehaviourIntegratorBase::performsBehaviourIntegration(
+      const IntegrationType it, const size_type nthreads) {
+    const auto mit = static_cast<mgis::behaviour::IntegrationType>(it);
+    auto treat = [this, it](const auto& r) {
+      if ((getExitStatus(r) < 0) &&
+          (this->number_of_local_substepping_levels > 0) &&
+          (it >= IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR)) {
+        // the batched integration does not handle the local substepping:
+        // all the integration points are integrated again one by one. This
+        // is harmless for the points where the integration succeeded, since
+        // each integration starts from the state at the beginning of the
+        // time step.
+        for (size_type ip = 0; ip != this->n; ++ip) {
+          if (!this->performsLocalBehaviourIntegration(ip, it)) {
+            return false;
+          }
+        }
+        return true;
+      }
+      // `MGIS` only reports the minimum of the ratios proposed by the
+      // behaviour, which is not meaningful if the integration failed
+      auto& w = this->wks.threads.front();
+      if (getExitStatus(r) >= 0) {
+        const auto rdt = getTimeStepIncreaseFactor(r);
+        w.minimal_rdt = std::min(w.minimal_rdt, rdt);
+        w.rdt_histogram.add(rdt);
+      } else {
+        w.rdt_histogram.addFailure();
+      }
+      return (getExitStatus(r) == 0) || (getExitStatus(r) == 1);
+    };
+    if (nthreads > 1) {
+      if ((this->thread_pool == nullptr) ||
+          (static_cast<size_type>(this->thread_pool->getNumberOfThreads()) !=
+           nthreads)) {
+        this->thread_pool = std::make_unique<mgis::ThreadPool>(nthreads);
+      }
+      return treat(mgis::behaviour::integrate(*(this->thread_pool), *this,
+                                              mit, this->time_increment));
+    }
+    return treat(mgis::behaviour::integrate(*this, mit, this->time_increment,
+                                            0, this->n));
+  }  // end of performsBehaviourIntegration
+
   void BehaviourIntegratorBase::revert() {
-    mgis::behaviour::revert(*this);
+    this->revertStates();
   }  // end of revert
 
   void BehaviourIntegratorBase::update() {
-    mgis::behaviour::update(*this);
+    this->updateStates();
   }  // end of update
 
+  void BehaviourIntegratorBase::resetTimeStepScalingFactor() {
+    for (auto& w : this->wks.threads) {
+      w.minimal_rdt = real{1};
+      w.rdt_histogram.reset();
+    }
+  }  // end of resetTimeStepScalingFactor
+
+  real BehaviourIntegratorBase::getTimeStepScalingFactor() const {
+    auto rdt = real{1};
+    for (const auto& w : this->wks.threads) {
+      rdt = std::min(rdt, w.minimal_rdt);
+    }
+    return rdt;
+  }  // end of getTimeStepScalingFactor
+
+  TimeStepScalingFactorHistogram
+  BehaviourIntegratorBase::getTimeStepScalingFactorHistogram() const {
+    auto h = TimeStepScalingFactorHistogram{};
+    for (const auto& w : this->wks.threads) {
+      h.merge(w.rdt_histogram);
+    }
+    return h;
+  }  // end of getTimeStepScalingFactorHistogram
+
   void BehaviourIntegratorBase::setMacroscopicGradients(
       mgis::span<const real> g) {
     Material::setMacroscopicGradients(g);
   }  // end of setMacroscopicGradients
 
+  void BehaviourIntegratorBase::setNumberOfLocalSubsteppingLevels(
+      const size_type n) {
+    if (n < 0) {
+      raise(
+          "BehaviourIntegratorBase::setNumberOfLocalSubsteppingLevels: "
+          "invalid number of levels");
+    }
+    this->number_of_local_substepping_levels = n;
+    if (n > 0) {
+      // make sure that the counter is printed, even if no recovery occurs
+      Profiler::getProfiler().incrementCounter("LocalSubsteppingRecoveries",
+                                               0);
+    }
+  }  // end of setNumberOfLocalSubsteppingLevels
+
+  void BehaviourIntegratorBase::setSymmetricStiffnessMatrixKernelUsage(
+      const bool b) {
+    this->use_symmetric_stiffness_matrix_kernel = b;
+  }  // end of setSymmetricStiffnessMatrixKernelUsage
+
+  void BehaviourIntegratorBase::setVectorisedKernelsUsage(const bool b) {
+    this->use_vectorised_kernels = b;
+  }  // end of setVectorisedKernelsUsage
+
   BehaviourIntegratorBase::~BehaviourIntegratorBase() = default;
 
 }  // end of namespace mfem_mgis
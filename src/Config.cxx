@@ -10,6 +10,9 @@
 #ifdef MFEM_USE_MPI
 #include "mpi.h"
 #endif /* MFEM_USE_MPI */
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
 #include "mfem/general/optparser.hpp"
 #include "mfem/general/communication.hpp"
 #ifdef MFEM_USE_PETSC
@@ -136,6 +139,24 @@ namespace mfem_mgis {
 
   Finalizer::~Finalizer() { this->finalize(); }
 
+#ifdef _OPENMP
+
+  size_type getMaximumNumberOfThreads() {
+    return static_cast<size_type>(omp_get_max_threads());
+  }  // end of getMaximumNumberOfThreads
+
+  size_type getThreadIdentifier() {
+    return static_cast<size_type>(omp_get_thread_num());
+  }  // end of getThreadIdentifier
+
+#else /* _OPENMP */
+
+  size_type getMaximumNumberOfThreads() { return 1; }
+
+  size_type getThreadIdentifier() { return 0; }
+
+#endif /* _OPENMP */
+
   [[noreturn]] void reportUnsupportedParallelComputations() {
     raise(
         "reportUnsupportedParallelComputations: "
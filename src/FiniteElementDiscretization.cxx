@@ -316,6 +316,50 @@ namespace mfem_mgis {
 #endif /* MFEM_USE_MPI */
   }    // end of describesAParallelComputation
 
+  template <bool parallel>
+  static void buildElementsPartition(
+      FiniteElementDiscretization::ElementsPartition& p,
+      const FiniteElementSpace<parallel>& fespace) {
+    const auto ne = fespace.GetNE();
+    p.attributes.resize(ne);
+    p.positions.resize(ne);
+    // elements of the material of the previous element. Consecutive
+    // elements generally belong to the same material, which saves most
+    // lookups in the map.
+    auto* elements = static_cast<std::vector<size_type>*>(nullptr);
+    for (size_type i = 0; i != ne; ++i) {
+      const auto a = fespace.GetAttribute(i);
+      if ((i == 0) || (p.attributes[i - 1] != a)) {
+        elements = &(p.elements[a]);
+      }
+      p.attributes[i] = a;
+      p.positions[i] = static_cast<size_type>(elements->size());
+      elements->push_back(i);
+    }
+    for (auto& e : p.elements) {
+      e.second.shrink_to_fit();
+    }
+  }  // end of buildElementsPartition
+
+  const FiniteElementDiscretization::ElementsPartition&
+  FiniteElementDiscretization::getElementsPartition() const {
+    if (this->elements_partition != nullptr) {
+      return *(this->elements_partition);
+    }
+    auto p = std::make_unique<ElementsPartition>();
+    if (this->describesAParallelComputation()) {
+#ifdef MFEM_USE_MPI
+      buildElementsPartition<true>(*p, this->getFiniteElementSpace<true>());
+#else  /* MFEM_USE_MPI */
+      reportUnsupportedParallelComputations();
+#endif /* MFEM_USE_MPI */
+    } else {
+      buildElementsPartition<false>(*p, this->getFiniteElementSpace<false>());
+    }
+    this->elements_partition = std::move(p);
+    return *(this->elements_partition);
+  }  // end of getElementsPartition
+
   const FiniteElementCollection&
   FiniteElementDiscretization::getFiniteElementCollection() const {
     return *(this->fec);
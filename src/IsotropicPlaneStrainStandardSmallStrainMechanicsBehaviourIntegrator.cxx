@@ -145,6 +145,180 @@ namespace mfem_mgis {
     }  // end of for (size_type nj = 0; nj != nnodes; ++nj)
   }    // end of updateStiffnessMatrix
 
+  inline void
+  IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateSymmetricStiffnessMatrix(mfem::DenseMatrix &Ke,
+                                     const mgis::span<const real> &Kip,
+                                     const mfem::DenseMatrix &dN,
+                                     const real w,
+                                     const size_type ni) const noexcept {
+    const auto nnodes = dN.NumRows();
+    const auto Bi_0_0 = dN(ni, 0);
+    const auto Bi_1_1 = dN(ni, 1);
+    const auto Bi_3_0 = dN(ni, 1) * icste;
+    const auto Bi_3_1 = dN(ni, 0) * icste;
+    const auto ni_0 = ni;
+    const auto ni_1 = ni + nnodes;
+    for (size_type nj = ni; nj != nnodes; ++nj) {
+      const auto Bj_0_0 = dN(nj, 0);
+      const auto Bj_1_1 = dN(nj, 1);
+      const auto Bj_3_0 = dN(nj, 1) * icste;
+      const auto Bj_3_1 = dN(nj, 0) * icste;
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      Ke(ni_0, nj_0) +=
+          w * (Kip[12] * Bj_0_0 * Bi_3_0 + Bj_3_0 * Kip[15] * Bi_3_0 +
+               Bi_0_0 * Kip[0] * Bj_0_0 + Bi_0_0 * Bj_3_0 * Kip[3]);
+      Ke(ni_0, nj_1) +=
+          w * (Bj_1_1 * Bi_0_0 * Kip[1] + Bj_1_1 * Kip[13] * Bi_3_0 +
+               Kip[15] * Bj_3_1 * Bi_3_0 + Bi_0_0 * Kip[3] * Bj_3_1);
+      Ke(ni_1, nj_0) +=
+          w * (Kip[4] * Bi_1_1 * Bj_0_0 + Bj_3_0 * Bi_1_1 * Kip[7] +
+               Bi_3_1 * Bj_3_0 * Kip[15] + Bi_3_1 * Kip[12] * Bj_0_0);
+      Ke(ni_1, nj_1) +=
+          w * (Bj_1_1 * Bi_3_1 * Kip[13] + Bi_3_1 * Kip[15] * Bj_3_1 +
+               Bi_1_1 * Bj_3_1 * Kip[7] + Bj_1_1 * Kip[5] * Bi_1_1);
+    }  // end of for (size_type nj = ni; nj != nnodes; ++nj)
+  }    // end of updateSymmetricStiffnessMatrix
+
+  template <size_type N>
+  inline void
+  IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateGradientsVectorised(mgis::span<real> &g,
+                                const mfem::Vector &u,
+                                const mfem::DenseMatrix &dN) noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    auto g_0 = real{0};
+    auto g_1 = real{0};
+    auto g_2 = real{0};
+    auto g_3 = real{0};
+    MFEM_MGIS_SIMD_REDUCTION_LOOP(g_0, g_1, g_2, g_3)
+    for (size_type ni = 0; ni < nnodes; ++ni) {
+      const auto Bi_0_0 = dN(ni, 0);
+      const auto Bi_1_1 = dN(ni, 1);
+      const auto Bi_3_0 = dN(ni, 1) * icste;
+      const auto Bi_3_1 = dN(ni, 0) * icste;
+      const auto u_0 = u[ni];
+      const auto u_1 = u[ni + nnodes];
+      g_0 += u_0 * Bi_0_0;
+      g_1 += Bi_1_1 * u_1;
+      g_2 += 0;
+      g_3 += u_0 * Bi_3_0 + u_1 * Bi_3_1;
+    }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+    g[0] += g_0;
+    g[1] += g_1;
+    g[2] += g_2;
+    g[3] += g_3;
+  }  // end of updateGradientsVectorised
+
+  template <size_type N>
+  inline void
+  IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateInnerForcesVectorised(mfem::Vector &Fe,
+                                  const mgis::span<const real> &s,
+                                  const mfem::DenseMatrix &dN,
+                                  const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    MFEM_MGIS_SIMD_LOOP
+    for (size_type ni = 0; ni < nnodes; ++ni) {
+      const auto Bi_0_0 = dN(ni, 0);
+      const auto Bi_1_1 = dN(ni, 1);
+      const auto Bi_3_0 = dN(ni, 1) * icste;
+      const auto Bi_3_1 = dN(ni, 0) * icste;
+      const auto ni_0 = ni;
+      const auto ni_1 = ni + nnodes;
+      Fe[ni_0] += w * (s[0] * Bi_0_0 + s[3] * Bi_3_0);
+      Fe[ni_1] += w * (Bi_1_1 * s[1] + s[3] * Bi_3_1);
+    }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+  }    // end of updateInnerForcesVectorised
+
+  template <size_type N>
+  inline void
+  IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateStiffnessMatrixVectorised(mfem::DenseMatrix &Ke,
+                                      const mgis::span<const real> &Kip,
+                                      const mfem::DenseMatrix &dN,
+                                      const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    for (size_type nj = 0; nj != nnodes; ++nj) {
+      const auto Bj_0_0 = dN(nj, 0);
+      const auto Bj_1_1 = dN(nj, 1);
+      const auto Bj_3_0 = dN(nj, 1) * icste;
+      const auto Bj_3_1 = dN(nj, 0) * icste;
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      MFEM_MGIS_SIMD_LOOP
+      for (size_type ni = 0; ni < nnodes; ++ni) {
+        const auto Bi_0_0 = dN(ni, 0);
+        const auto Bi_1_1 = dN(ni, 1);
+        const auto Bi_3_0 = dN(ni, 1) * icste;
+        const auto Bi_3_1 = dN(ni, 0) * icste;
+        const auto ni_0 = ni;
+        const auto ni_1 = ni + nnodes;
+        Ke(ni_0, nj_0) += w * (Kip[12] * Bj_0_0 * Bi_3_0 +
+                               Bj_3_0 * Kip[15] * Bi_3_0 +
+                               Bi_0_0 * Kip[0] * Bj_0_0 +
+                               Bi_0_0 * Bj_3_0 * Kip[3]);
+        Ke(ni_0, nj_1) += w * (Bj_1_1 * Bi_0_0 * Kip[1] +
+                               Bj_1_1 * Kip[13] * Bi_3_0 +
+                               Kip[15] * Bj_3_1 * Bi_3_0 +
+                               Bi_0_0 * Kip[3] * Bj_3_1);
+        Ke(ni_1, nj_0) += w * (Kip[4] * Bi_1_1 * Bj_0_0 +
+                               Bj_3_0 * Bi_1_1 * Kip[7] +
+                               Bi_3_1 * Bj_3_0 * Kip[15] +
+                               Bi_3_1 * Kip[12] * Bj_0_0);
+        Ke(ni_1, nj_1) += w * (Bj_1_1 * Bi_3_1 * Kip[13] +
+                               Bi_3_1 * Kip[15] * Bj_3_1 +
+                               Bi_1_1 * Bj_3_1 * Kip[7] +
+                               Bj_1_1 * Kip[5] * Bi_1_1);
+      }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+    }    // end of for (size_type nj = 0; nj != nnodes; ++nj)
+  }      // end of updateStiffnessMatrixVectorised
+
+  template <size_type N>
+  inline void
+  IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateSymmetricStiffnessMatrixVectorised(
+          mfem::DenseMatrix &Ke,
+          const mgis::span<const real> &Kip,
+          const mfem::DenseMatrix &dN,
+          const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    for (size_type nj = 0; nj != nnodes; ++nj) {
+      const auto Bj_0_0 = dN(nj, 0);
+      const auto Bj_1_1 = dN(nj, 1);
+      const auto Bj_3_0 = dN(nj, 1) * icste;
+      const auto Bj_3_1 = dN(nj, 0) * icste;
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      MFEM_MGIS_SIMD_LOOP
+      for (size_type ni = 0; ni < nj + 1; ++ni) {
+        const auto Bi_0_0 = dN(ni, 0);
+        const auto Bi_1_1 = dN(ni, 1);
+        const auto Bi_3_0 = dN(ni, 1) * icste;
+        const auto Bi_3_1 = dN(ni, 0) * icste;
+        const auto ni_0 = ni;
+        const auto ni_1 = ni + nnodes;
+        Ke(ni_0, nj_0) += w * (Kip[12] * Bj_0_0 * Bi_3_0 +
+                               Bj_3_0 * Kip[15] * Bi_3_0 +
+                               Bi_0_0 * Kip[0] * Bj_0_0 +
+                               Bi_0_0 * Bj_3_0 * Kip[3]);
+        Ke(ni_0, nj_1) += w * (Bj_1_1 * Bi_0_0 * Kip[1] +
+                               Bj_1_1 * Kip[13] * Bi_3_0 +
+                               Kip[15] * Bj_3_1 * Bi_3_0 +
+                               Bi_0_0 * Kip[3] * Bj_3_1);
+        Ke(ni_1, nj_0) += w * (Kip[4] * Bi_1_1 * Bj_0_0 +
+                               Bj_3_0 * Bi_1_1 * Kip[7] +
+                               Bi_3_1 * Bj_3_0 * Kip[15] +
+                               Bi_3_1 * Kip[12] * Bj_0_0);
+        Ke(ni_1, nj_1) += w * (Bj_1_1 * Bi_3_1 * Kip[13] +
+                               Bi_3_1 * Kip[15] * Bj_3_1 +
+                               Bi_1_1 * Bj_3_1 * Kip[7] +
+                               Bj_1_1 * Kip[5] * Bi_1_1);
+      }  // end of for (size_type ni = 0; ni < nj + 1; ++ni)
+    }    // end of for (size_type nj = 0; nj != nnodes; ++nj)
+  }      // end of updateSymmetricStiffnessMatrixVectorised
+
   bool IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
       integrate(const mfem::FiniteElement &e,
                 mfem::ElementTransformation &tr,
@@ -153,6 +327,19 @@ namespace mfem_mgis {
     return this->implementIntegrate(e, tr, u, it);
   }  // end of integrate
 
+  void IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::computeGradients(
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u,
+      const IntegrationType it) {
+    this->implementComputeGradients(e, tr, u, it);
+  }  // end of computeGradients
+
+  bool IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::performsBehaviourIntegration(
+      const IntegrationType it, const size_type nthreads) {
+    return this->implementPerformsBehaviourIntegration(it, nthreads);
+  }  // end of performsBehaviourIntegration
+
   void IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
       updateResidual(mfem::Vector &Fe,
                      const mfem::FiniteElement &e,
@@ -169,6 +356,24 @@ namespace mfem_mgis {
     this->implementUpdateJacobian(Ke, e, tr);
   }  // end of updateJacobian
 
+  void IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateResidualAndJacobian(mfem::Vector &Fe,
+                                mfem::DenseMatrix &Ke,
+                                const mfem::FiniteElement &e,
+                                mfem::ElementTransformation &tr,
+                                const mfem::Vector &) {
+    this->implementUpdateResidualAndJacobian(Fe, Ke, e, tr);
+  }  // end of updateResidualAndJacobian
+
+  void IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateJacobianAction(mfem::Vector &Ye,
+                           const mfem::FiniteElement &e,
+                           mfem::ElementTransformation &tr,
+                           const mfem::Vector &,
+                           const mfem::Vector &Xe) {
+    this->implementUpdateJacobianAction(Ye, e, tr, Xe);
+  }  // end of updateJacobianAction
+
   void IsotropicPlaneStrainStandardSmallStrainMechanicsBehaviourIntegrator::
       computeInnerForces(mfem::Vector &Fe,
                          const mfem::FiniteElement &e,
@@ -159,6 +159,19 @@ namespace mfem_mgis {
     return this->implementIntegrate(e, tr, u, it);
   }  // end of integrate
 
+  void IsotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::computeGradients(
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u,
+      const IntegrationType it) {
+    this->implementComputeGradients(e, tr, u, it);
+  }  // end of computeGradients
+
+  bool IsotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::performsBehaviourIntegration(
+      const IntegrationType it, const size_type nthreads) {
+    return this->implementPerformsBehaviourIntegration(it, nthreads);
+  }  // end of performsBehaviourIntegration
+
   void IsotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
       updateResidual(mfem::Vector &Fe,
                      const mfem::FiniteElement &e,
@@ -175,6 +188,24 @@ namespace mfem_mgis {
     this->implementUpdateJacobian(Ke, e, tr);
   }  // end of updateJacobian
 
+  void IsotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
+      updateResidualAndJacobian(mfem::Vector &Fe,
+                                mfem::DenseMatrix &Ke,
+                                const mfem::FiniteElement &e,
+                                mfem::ElementTransformation &tr,
+                                const mfem::Vector &) {
+    this->implementUpdateResidualAndJacobian(Fe, Ke, e, tr);
+  }  // end of updateResidualAndJacobian
+
+  void IsotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
+      updateJacobianAction(mfem::Vector &Ye,
+                           const mfem::FiniteElement &e,
+                           mfem::ElementTransformation &tr,
+                           const mfem::Vector &,
+                           const mfem::Vector &Xe) {
+    this->implementUpdateJacobianAction(Ye, e, tr, Xe);
+  }  // end of updateJacobianAction
+
   void IsotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
       computeInnerForces(mfem::Vector &Fe,
                          const mfem::FiniteElement &e,
@@ -214,6 +214,407 @@ namespace mfem_mgis {
     }  // end of for (size_type nj = 0; nj != nnodes; ++nj)
   }    // end of updateStiffnessMatrix
 
+  inline void
+  IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateSymmetricStiffnessMatrix(mfem::DenseMatrix &Ke,
+                                     const mgis::span<const real> &Kip,
+                                     const mfem::DenseMatrix &dN,
+                                     const real w,
+                                     const size_type ni) const noexcept {
+    const auto nnodes = dN.NumRows();
+    const auto Bi_0_0 = dN(ni, 0);
+    const auto Bi_1_1 = dN(ni, 1);
+    const auto Bi_2_2 = dN(ni, 2);
+    const auto Bi_3_0 = dN(ni, 1) * icste;
+    const auto Bi_3_1 = dN(ni, 0) * icste;
+    const auto Bi_4_0 = dN(ni, 2) * icste;
+    const auto Bi_4_2 = dN(ni, 0) * icste;
+    const auto Bi_5_1 = dN(ni, 2) * icste;
+    const auto Bi_5_2 = dN(ni, 1) * icste;
+    const auto ni_0 = ni;
+    const auto ni_1 = ni + nnodes;
+    const auto ni_2 = ni + 2 * nnodes;
+    for (size_type nj = ni; nj != nnodes; ++nj) {
+      const auto Bj_0_0 = dN(nj, 0);
+      const auto Bj_1_1 = dN(nj, 1);
+      const auto Bj_2_2 = dN(nj, 2);
+      const auto Bj_3_0 = dN(nj, 1) * icste;
+      const auto Bj_3_1 = dN(nj, 0) * icste;
+      const auto Bj_4_0 = dN(nj, 2) * icste;
+      const auto Bj_4_2 = dN(nj, 0) * icste;
+      const auto Bj_5_1 = dN(nj, 2) * icste;
+      const auto Bj_5_2 = dN(nj, 1) * icste;
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      const auto nj_2 = nj + 2 * nnodes;
+      Ke(ni_0, nj_0) +=
+          w * (Kip[0] * Bi_0_0 * Bj_0_0 + Kip[22] * Bj_4_0 * Bi_3_0 +
+               Bi_3_0 * Bj_3_0 * Kip[21] + Bj_0_0 * Kip[24] * Bi_4_0 +
+               Bj_4_0 * Bi_4_0 * Kip[28] + Bj_4_0 * Bi_0_0 * Kip[4] +
+               Bi_0_0 * Bj_3_0 * Kip[3] + Bj_3_0 * Kip[27] * Bi_4_0 +
+               Bi_3_0 * Bj_0_0 * Kip[18]);
+      Ke(ni_0, nj_1) +=
+          w * (Bi_0_0 * Kip[1] * Bj_1_1 + Kip[25] * Bj_1_1 * Bi_4_0 +
+               Kip[29] * Bj_5_1 * Bi_4_0 + Bi_3_0 * Kip[21] * Bj_3_1 +
+               Bi_0_0 * Bj_3_1 * Kip[3] + Kip[19] * Bi_3_0 * Bj_1_1 +
+               Kip[27] * Bi_4_0 * Bj_3_1 + Bi_3_0 * Kip[23] * Bj_5_1 +
+               Bi_0_0 * Kip[5] * Bj_5_1);
+      Ke(ni_0, nj_2) +=
+          w * (Bj_2_2 * Bi_0_0 * Kip[2] + Bj_4_2 * Bi_4_0 * Kip[28] +
+               Bj_2_2 * Bi_3_0 * Kip[20] + Bj_5_2 * Bi_3_0 * Kip[23] +
+               Bj_5_2 * Bi_0_0 * Kip[5] + Bj_2_2 * Kip[26] * Bi_4_0 +
+               Bj_5_2 * Kip[29] * Bi_4_0 + Kip[22] * Bi_3_0 * Bj_4_2 +
+               Bi_0_0 * Kip[4] * Bj_4_2);
+      Ke(ni_1, nj_0) +=
+          w * (Kip[22] * Bj_4_0 * Bi_3_1 + Bj_3_0 * Bi_3_1 * Kip[21] +
+               Bj_4_0 * Bi_5_1 * Kip[34] + Bj_4_0 * Kip[10] * Bi_1_1 +
+               Bj_0_0 * Bi_1_1 * Kip[6] + Bj_0_0 * Bi_3_1 * Kip[18] +
+               Kip[9] * Bj_3_0 * Bi_1_1 + Bj_3_0 * Bi_5_1 * Kip[33] +
+               Bj_0_0 * Bi_5_1 * Kip[30]);
+      Ke(ni_1, nj_1) +=
+          w * (Kip[9] * Bi_1_1 * Bj_3_1 + Kip[19] * Bi_3_1 * Bj_1_1 +
+               Bi_5_1 * Bj_1_1 * Kip[31] + Bi_5_1 * Kip[33] * Bj_3_1 +
+               Kip[7] * Bi_1_1 * Bj_1_1 + Bi_3_1 * Kip[21] * Bj_3_1 +
+               Bi_1_1 * Kip[11] * Bj_5_1 + Kip[35] * Bi_5_1 * Bj_5_1 +
+               Kip[23] * Bi_3_1 * Bj_5_1);
+      Ke(ni_1, nj_2) +=
+          w * (Bj_5_2 * Kip[23] * Bi_3_1 + Kip[35] * Bj_5_2 * Bi_5_1 +
+               Kip[22] * Bj_4_2 * Bi_3_1 + Bj_2_2 * Kip[32] * Bi_5_1 +
+               Kip[10] * Bj_4_2 * Bi_1_1 + Bj_5_2 * Bi_1_1 * Kip[11] +
+               Bj_2_2 * Bi_1_1 * Kip[8] + Bj_2_2 * Kip[20] * Bi_3_1 +
+               Bi_5_1 * Bj_4_2 * Kip[34]);
+      Ke(ni_2, nj_0) +=
+          w * (Bi_4_2 * Bj_4_0 * Kip[28] + Bj_4_0 * Kip[16] * Bi_2_2 +
+               Bi_4_2 * Bj_3_0 * Kip[27] + Bj_0_0 * Bi_2_2 * Kip[12] +
+               Bi_4_2 * Bj_0_0 * Kip[24] + Bj_3_0 * Kip[33] * Bi_5_2 +
+               Bj_0_0 * Kip[30] * Bi_5_2 + Bj_3_0 * Bi_2_2 * Kip[15] +
+               Bj_4_0 * Bi_5_2 * Kip[34]);
+      Ke(ni_2, nj_1) +=
+          w * (Kip[13] * Bj_1_1 * Bi_2_2 + Kip[35] * Bi_5_2 * Bj_5_1 +
+               Kip[33] * Bi_5_2 * Bj_3_1 + Bj_1_1 * Bi_5_2 * Kip[31] +
+               Bi_4_2 * Kip[29] * Bj_5_1 + Bi_4_2 * Kip[27] * Bj_3_1 +
+               Kip[25] * Bi_4_2 * Bj_1_1 + Kip[17] * Bj_5_1 * Bi_2_2 +
+               Bj_3_1 * Bi_2_2 * Kip[15]);
+      Ke(ni_2, nj_2) +=
+          w * (Bj_4_2 * Bi_5_2 * Kip[34] + Bi_4_2 * Bj_4_2 * Kip[28] +
+               Bj_2_2 * Kip[32] * Bi_5_2 + Bj_2_2 * Bi_4_2 * Kip[26] +
+               Kip[35] * Bj_5_2 * Bi_5_2 + Bj_5_2 * Bi_4_2 * Kip[29] +
+               Bj_5_2 * Kip[17] * Bi_2_2 + Kip[16] * Bj_4_2 * Bi_2_2 +
+               Bj_2_2 * Kip[14] * Bi_2_2);
+    }  // end of for (size_type nj = ni; nj != nnodes; ++nj)
+  }    // end of updateSymmetricStiffnessMatrix
+
+  template <size_type N>
+  inline void
+  IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateGradientsVectorised(mgis::span<real> &g,
+                                const mfem::Vector &u,
+                                const mfem::DenseMatrix &dN) noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    auto g_0 = real{0};
+    auto g_1 = real{0};
+    auto g_2 = real{0};
+    auto g_3 = real{0};
+    auto g_4 = real{0};
+    auto g_5 = real{0};
+    MFEM_MGIS_SIMD_REDUCTION_LOOP(g_0, g_1, g_2, g_3, g_4, g_5)
+    for (size_type ni = 0; ni < nnodes; ++ni) {
+      const auto Bi_0_0 = dN(ni, 0);
+      const auto Bi_1_1 = dN(ni, 1);
+      const auto Bi_2_2 = dN(ni, 2);
+      const auto Bi_3_0 = dN(ni, 1)* icste;
+      const auto Bi_3_1 = dN(ni, 0)* icste;
+      const auto Bi_4_0 = dN(ni, 2)* icste;
+      const auto Bi_4_2 = dN(ni, 0)* icste;
+      const auto Bi_5_1 = dN(ni, 2)* icste;
+      const auto Bi_5_2 = dN(ni, 1)* icste;
+      const auto u_0 = u[ni];
+      const auto u_1 = u[ni + nnodes];
+      const auto u_2 = u[ni + 2 * nnodes];
+      g_0 += u_0 * Bi_0_0;
+      g_1 += Bi_1_1 * u_1;
+      g_2 += u_2 * Bi_2_2;
+      g_3 += u_0 * Bi_3_0 + u_1 * Bi_3_1;
+      g_4 += Bi_4_0 * u_0 + u_2 * Bi_4_2;
+      g_5 += u_1 * Bi_5_1 + u_2 * Bi_5_2;
+    }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+    g[0] += g_0;
+    g[1] += g_1;
+    g[2] += g_2;
+    g[3] += g_3;
+    g[4] += g_4;
+    g[5] += g_5;
+  }  // end of updateGradientsVectorised
+
+  template <size_type N>
+  inline void
+  IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateInnerForcesVectorised(mfem::Vector &Fe,
+                                  const mgis::span<const real> &s,
+                                  const mfem::DenseMatrix &dN,
+                                  const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    MFEM_MGIS_SIMD_LOOP
+    for (size_type ni = 0; ni < nnodes; ++ni) {
+      const auto Bi_0_0 = dN(ni, 0);
+      const auto Bi_1_1 = dN(ni, 1);
+      const auto Bi_2_2 = dN(ni, 2);
+      const auto Bi_3_0 = dN(ni, 1)* icste;
+      const auto Bi_3_1 = dN(ni, 0)* icste;
+      const auto Bi_4_0 = dN(ni, 2)* icste;
+      const auto Bi_4_2 = dN(ni, 0)* icste;
+      const auto Bi_5_1 = dN(ni, 2)* icste;
+      const auto Bi_5_2 = dN(ni, 1)* icste;
+      const auto ni_0 = ni;
+      const auto ni_1 = ni + nnodes;
+      const auto ni_2 = ni + 2 * nnodes;
+      Fe[ni_0] += w * (Bi_4_0 * s[4] + s[0] * Bi_0_0 + s[3] * Bi_3_0);
+      Fe[ni_1] += w * (s[3] * Bi_3_1 + Bi_5_1 * s[5] + s[1] * Bi_1_1);
+      Fe[ni_2] += w * (s[2] * Bi_2_2 + Bi_5_2 * s[5] + Bi_4_2 * s[4]);
+    }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+  }    // end of updateInnerForcesVectorised
+
+  template <size_type N>
+  inline void
+  IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateStiffnessMatrixVectorised(mfem::DenseMatrix &Ke,
+                                      const mgis::span<const real> &Kip,
+                                      const mfem::DenseMatrix &dN,
+                                      const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    for (size_type nj = 0; nj != nnodes; ++nj) {
+      const auto Bj_0_0 = dN(nj, 0);
+      const auto Bj_1_1 = dN(nj, 1);
+      const auto Bj_2_2 = dN(nj, 2);
+      const auto Bj_3_0 = dN(nj, 1)* icste;
+      const auto Bj_3_1 = dN(nj, 0)* icste;
+      const auto Bj_4_0 = dN(nj, 2)* icste;
+      const auto Bj_4_2 = dN(nj, 0)* icste;
+      const auto Bj_5_1 = dN(nj, 2)* icste;
+      const auto Bj_5_2 = dN(nj, 1)* icste;
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      const auto nj_2 = nj + 2 * nnodes;
+      MFEM_MGIS_SIMD_LOOP
+      for (size_type ni = 0; ni < nnodes; ++ni) {
+        const auto Bi_0_0 = dN(ni, 0);
+        const auto Bi_1_1 = dN(ni, 1);
+        const auto Bi_2_2 = dN(ni, 2);
+        const auto Bi_3_0 = dN(ni, 1)* icste;
+        const auto Bi_3_1 = dN(ni, 0)* icste;
+        const auto Bi_4_0 = dN(ni, 2)* icste;
+        const auto Bi_4_2 = dN(ni, 0)* icste;
+        const auto Bi_5_1 = dN(ni, 2)* icste;
+        const auto Bi_5_2 = dN(ni, 1)* icste;
+        const auto ni_0 = ni;
+        const auto ni_1 = ni + nnodes;
+        const auto ni_2 = ni + 2 * nnodes;
+        Ke(ni_0, nj_0) += w * (Kip[0] * Bi_0_0 * Bj_0_0 +
+                               Kip[22] * Bj_4_0 * Bi_3_0 +
+                               Bi_3_0 * Bj_3_0 * Kip[21] +
+                               Bj_0_0 * Kip[24] * Bi_4_0 +
+                               Bj_4_0 * Bi_4_0 * Kip[28] +
+                               Bj_4_0 * Bi_0_0 * Kip[4] +
+                               Bi_0_0 * Bj_3_0 * Kip[3] +
+                               Bj_3_0 * Kip[27] * Bi_4_0 +
+                               Bi_3_0 * Bj_0_0 * Kip[18]);
+        Ke(ni_0, nj_1) += w * (Bi_0_0 * Kip[1] * Bj_1_1 +
+                               Kip[25] * Bj_1_1 * Bi_4_0 +
+                               Kip[29] * Bj_5_1 * Bi_4_0 +
+                               Bi_3_0 * Kip[21] * Bj_3_1 +
+                               Bi_0_0 * Bj_3_1 * Kip[3] +
+                               Kip[19] * Bi_3_0 * Bj_1_1 +
+                               Kip[27] * Bi_4_0 * Bj_3_1 +
+                               Bi_3_0 * Kip[23] * Bj_5_1 +
+                               Bi_0_0 * Kip[5] * Bj_5_1);
+        Ke(ni_0, nj_2) += w * (Bj_2_2 * Bi_0_0 * Kip[2] +
+                               Bj_4_2 * Bi_4_0 * Kip[28] +
+                               Bj_2_2 * Bi_3_0 * Kip[20] +
+                               Bj_5_2 * Bi_3_0 * Kip[23] +
+                               Bj_5_2 * Bi_0_0 * Kip[5] +
+                               Bj_2_2 * Kip[26] * Bi_4_0 +
+                               Bj_5_2 * Kip[29] * Bi_4_0 +
+                               Kip[22] * Bi_3_0 * Bj_4_2 +
+                               Bi_0_0 * Kip[4] * Bj_4_2);
+        Ke(ni_1, nj_0) += w * (Kip[22] * Bj_4_0 * Bi_3_1 +
+                               Bj_3_0 * Bi_3_1 * Kip[21] +
+                               Bj_4_0 * Bi_5_1 * Kip[34] +
+                               Bj_4_0 * Kip[10] * Bi_1_1 +
+                               Bj_0_0 * Bi_1_1 * Kip[6] +
+                               Bj_0_0 * Bi_3_1 * Kip[18] +
+                               Kip[9] * Bj_3_0 * Bi_1_1 +
+                               Bj_3_0 * Bi_5_1 * Kip[33] +
+                               Bj_0_0 * Bi_5_1 * Kip[30]);
+        Ke(ni_1, nj_1) += w * (Kip[9] * Bi_1_1 * Bj_3_1 +
+                               Kip[19] * Bi_3_1 * Bj_1_1 +
+                               Bi_5_1 * Bj_1_1 * Kip[31] +
+                               Bi_5_1 * Kip[33] * Bj_3_1 +
+                               Kip[7] * Bi_1_1 * Bj_1_1 +
+                               Bi_3_1 * Kip[21] * Bj_3_1 +
+                               Bi_1_1 * Kip[11] * Bj_5_1 +
+                               Kip[35] * Bi_5_1 * Bj_5_1 +
+                               Kip[23] * Bi_3_1 * Bj_5_1);
+        Ke(ni_1, nj_2) += w * (Bj_5_2 * Kip[23] * Bi_3_1 +
+                               Kip[35] * Bj_5_2 * Bi_5_1 +
+                               Kip[22] * Bj_4_2 * Bi_3_1 +
+                               Bj_2_2 * Kip[32] * Bi_5_1 +
+                               Kip[10] * Bj_4_2 * Bi_1_1 +
+                               Bj_5_2 * Bi_1_1 * Kip[11] +
+                               Bj_2_2 * Bi_1_1 * Kip[8] +
+                               Bj_2_2 * Kip[20] * Bi_3_1 +
+                               Bi_5_1 * Bj_4_2 * Kip[34]);
+        Ke(ni_2, nj_0) += w * (Bi_4_2 * Bj_4_0 * Kip[28] +
+                               Bj_4_0 * Kip[16] * Bi_2_2 +
+                               Bi_4_2 * Bj_3_0 * Kip[27] +
+                               Bj_0_0 * Bi_2_2 * Kip[12] +
+                               Bi_4_2 * Bj_0_0 * Kip[24] +
+                               Bj_3_0 * Kip[33] * Bi_5_2 +
+                               Bj_0_0 * Kip[30] * Bi_5_2 +
+                               Bj_3_0 * Bi_2_2 * Kip[15] +
+                               Bj_4_0 * Bi_5_2 * Kip[34]);
+        Ke(ni_2, nj_1) += w * (Kip[13] * Bj_1_1 * Bi_2_2 +
+                               Kip[35] * Bi_5_2 * Bj_5_1 +
+                               Kip[33] * Bi_5_2 * Bj_3_1 +
+                               Bj_1_1 * Bi_5_2 * Kip[31] +
+                               Bi_4_2 * Kip[29] * Bj_5_1 +
+                               Bi_4_2 * Kip[27] * Bj_3_1 +
+                               Kip[25] * Bi_4_2 * Bj_1_1 +
+                               Kip[17] * Bj_5_1 * Bi_2_2 +
+                               Bj_3_1 * Bi_2_2 * Kip[15]);
+        Ke(ni_2, nj_2) += w * (Bj_4_2 * Bi_5_2 * Kip[34] +
+                               Bi_4_2 * Bj_4_2 * Kip[28] +
+                               Bj_2_2 * Kip[32] * Bi_5_2 +
+                               Bj_2_2 * Bi_4_2 * Kip[26] +
+                               Kip[35] * Bj_5_2 * Bi_5_2 +
+                               Bj_5_2 * Bi_4_2 * Kip[29] +
+                               Bj_5_2 * Kip[17] * Bi_2_2 +
+                               Kip[16] * Bj_4_2 * Bi_2_2 +
+                               Bj_2_2 * Kip[14] * Bi_2_2);
+      }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+    }    // end of for (size_type nj = 0; nj != nnodes; ++nj)
+  }      // end of updateStiffnessMatrixVectorised
+
+  template <size_type N>
+  inline void
+  IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateSymmetricStiffnessMatrixVectorised(
+          mfem::DenseMatrix &Ke,
+          const mgis::span<const real> &Kip,
+          const mfem::DenseMatrix &dN,
+          const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    for (size_type nj = 0; nj != nnodes; ++nj) {
+      const auto Bj_0_0 = dN(nj, 0);
+      const auto Bj_1_1 = dN(nj, 1);
+      const auto Bj_2_2 = dN(nj, 2);
+      const auto Bj_3_0 = dN(nj, 1)* icste;
+      const auto Bj_3_1 = dN(nj, 0)* icste;
+      const auto Bj_4_0 = dN(nj, 2)* icste;
+      const auto Bj_4_2 = dN(nj, 0)* icste;
+      const auto Bj_5_1 = dN(nj, 2)* icste;
+      const auto Bj_5_2 = dN(nj, 1)* icste;
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      const auto nj_2 = nj + 2 * nnodes;
+      MFEM_MGIS_SIMD_LOOP
+      for (size_type ni = 0; ni < nj + 1; ++ni) {
+        const auto Bi_0_0 = dN(ni, 0);
+        const auto Bi_1_1 = dN(ni, 1);
+        const auto Bi_2_2 = dN(ni, 2);
+        const auto Bi_3_0 = dN(ni, 1)* icste;
+        const auto Bi_3_1 = dN(ni, 0)* icste;
+        const auto Bi_4_0 = dN(ni, 2)* icste;
+        const auto Bi_4_2 = dN(ni, 0)* icste;
+        const auto Bi_5_1 = dN(ni, 2)* icste;
+        const auto Bi_5_2 = dN(ni, 1)* icste;
+        const auto ni_0 = ni;
+        const auto ni_1 = ni + nnodes;
+        const auto ni_2 = ni + 2 * nnodes;
+        Ke(ni_0, nj_0) += w * (Kip[0] * Bi_0_0 * Bj_0_0 +
+                               Kip[22] * Bj_4_0 * Bi_3_0 +
+                               Bi_3_0 * Bj_3_0 * Kip[21] +
+                               Bj_0_0 * Kip[24] * Bi_4_0 +
+                               Bj_4_0 * Bi_4_0 * Kip[28] +
+                               Bj_4_0 * Bi_0_0 * Kip[4] +
+                               Bi_0_0 * Bj_3_0 * Kip[3] +
+                               Bj_3_0 * Kip[27] * Bi_4_0 +
+                               Bi_3_0 * Bj_0_0 * Kip[18]);
+        Ke(ni_0, nj_1) += w * (Bi_0_0 * Kip[1] * Bj_1_1 +
+                               Kip[25] * Bj_1_1 * Bi_4_0 +
+                               Kip[29] * Bj_5_1 * Bi_4_0 +
+                               Bi_3_0 * Kip[21] * Bj_3_1 +
+                               Bi_0_0 * Bj_3_1 * Kip[3] +
+                               Kip[19] * Bi_3_0 * Bj_1_1 +
+                               Kip[27] * Bi_4_0 * Bj_3_1 +
+                               Bi_3_0 * Kip[23] * Bj_5_1 +
+                               Bi_0_0 * Kip[5] * Bj_5_1);
+        Ke(ni_0, nj_2) += w * (Bj_2_2 * Bi_0_0 * Kip[2] +
+                               Bj_4_2 * Bi_4_0 * Kip[28] +
+                               Bj_2_2 * Bi_3_0 * Kip[20] +
+                               Bj_5_2 * Bi_3_0 * Kip[23] +
+                               Bj_5_2 * Bi_0_0 * Kip[5] +
+                               Bj_2_2 * Kip[26] * Bi_4_0 +
+                               Bj_5_2 * Kip[29] * Bi_4_0 +
+                               Kip[22] * Bi_3_0 * Bj_4_2 +
+                               Bi_0_0 * Kip[4] * Bj_4_2);
+        Ke(ni_1, nj_0) += w * (Kip[22] * Bj_4_0 * Bi_3_1 +
+                               Bj_3_0 * Bi_3_1 * Kip[21] +
+                               Bj_4_0 * Bi_5_1 * Kip[34] +
+                               Bj_4_0 * Kip[10] * Bi_1_1 +
+                               Bj_0_0 * Bi_1_1 * Kip[6] +
+                               Bj_0_0 * Bi_3_1 * Kip[18] +
+                               Kip[9] * Bj_3_0 * Bi_1_1 +
+                               Bj_3_0 * Bi_5_1 * Kip[33] +
+                               Bj_0_0 * Bi_5_1 * Kip[30]);
+        Ke(ni_1, nj_1) += w * (Kip[9] * Bi_1_1 * Bj_3_1 +
+                               Kip[19] * Bi_3_1 * Bj_1_1 +
+                               Bi_5_1 * Bj_1_1 * Kip[31] +
+                               Bi_5_1 * Kip[33] * Bj_3_1 +
+                               Kip[7] * Bi_1_1 * Bj_1_1 +
+                               Bi_3_1 * Kip[21] * Bj_3_1 +
+                               Bi_1_1 * Kip[11] * Bj_5_1 +
+                               Kip[35] * Bi_5_1 * Bj_5_1 +
+                               Kip[23] * Bi_3_1 * Bj_5_1);
+        Ke(ni_1, nj_2) += w * (Bj_5_2 * Kip[23] * Bi_3_1 +
+                               Kip[35] * Bj_5_2 * Bi_5_1 +
+                               Kip[22] * Bj_4_2 * Bi_3_1 +
+                               Bj_2_2 * Kip[32] * Bi_5_1 +
+                               Kip[10] * Bj_4_2 * Bi_1_1 +
+                               Bj_5_2 * Bi_1_1 * Kip[11] +
+                               Bj_2_2 * Bi_1_1 * Kip[8] +
+                               Bj_2_2 * Kip[20] * Bi_3_1 +
+                               Bi_5_1 * Bj_4_2 * Kip[34]);
+        Ke(ni_2, nj_0) += w * (Bi_4_2 * Bj_4_0 * Kip[28] +
+                               Bj_4_0 * Kip[16] * Bi_2_2 +
+                               Bi_4_2 * Bj_3_0 * Kip[27] +
+                               Bj_0_0 * Bi_2_2 * Kip[12] +
+                               Bi_4_2 * Bj_0_0 * Kip[24] +
+                               Bj_3_0 * Kip[33] * Bi_5_2 +
+                               Bj_0_0 * Kip[30] * Bi_5_2 +
+                               Bj_3_0 * Bi_2_2 * Kip[15] +
+                               Bj_4_0 * Bi_5_2 * Kip[34]);
+        Ke(ni_2, nj_1) += w * (Kip[13] * Bj_1_1 * Bi_2_2 +
+                               Kip[35] * Bi_5_2 * Bj_5_1 +
+                               Kip[33] * Bi_5_2 * Bj_3_1 +
+                               Bj_1_1 * Bi_5_2 * Kip[31] +
+                               Bi_4_2 * Kip[29] * Bj_5_1 +
+                               Bi_4_2 * Kip[27] * Bj_3_1 +
+                               Kip[25] * Bi_4_2 * Bj_1_1 +
+                               Kip[17] * Bj_5_1 * Bi_2_2 +
+                               Bj_3_1 * Bi_2_2 * Kip[15]);
+        Ke(ni_2, nj_2) += w * (Bj_4_2 * Bi_5_2 * Kip[34] +
+                               Bi_4_2 * Bj_4_2 * Kip[28] +
+                               Bj_2_2 * Kip[32] * Bi_5_2 +
+                               Bj_2_2 * Bi_4_2 * Kip[26] +
+                               Kip[35] * Bj_5_2 * Bi_5_2 +
+                               Bj_5_2 * Bi_4_2 * Kip[29] +
+                               Bj_5_2 * Kip[17] * Bi_2_2 +
+                               Kip[16] * Bj_4_2 * Bi_2_2 +
+                               Bj_2_2 * Kip[14] * Bi_2_2);
+      }  // end of for (size_type ni = 0; ni < nj + 1; ++ni)
+    }    // end of for (size_type nj = 0; nj != nnodes; ++nj)
+  }      // end of updateSymmetricStiffnessMatrixVectorised
+
   bool IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
       integrate(const mfem::FiniteElement &e,
                 mfem::ElementTransformation &tr,
@@ -222,6 +623,19 @@ namespace mfem_mgis {
     return this->implementIntegrate(e, tr, u, it);
   }  // end of integrate
 
+  void IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::computeGradients(
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u,
+      const IntegrationType it) {
+    this->implementComputeGradients(e, tr, u, it);
+  }  // end of computeGradients
+
+  bool IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::performsBehaviourIntegration(
+      const IntegrationType it, const size_type nthreads) {
+    return this->implementPerformsBehaviourIntegration(it, nthreads);
+  }  // end of performsBehaviourIntegration
+
   void IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
       updateResidual(mfem::Vector &Fe,
                      const mfem::FiniteElement &e,
@@ -238,6 +652,24 @@ namespace mfem_mgis {
     this->implementUpdateJacobian(Ke, e, tr);
   }  // end of updateJacobian
 
+  void IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateResidualAndJacobian(mfem::Vector &Fe,
+                                mfem::DenseMatrix &Ke,
+                                const mfem::FiniteElement &e,
+                                mfem::ElementTransformation &tr,
+                                const mfem::Vector &) {
+    this->implementUpdateResidualAndJacobian(Fe, Ke, e, tr);
+  }  // end of updateResidualAndJacobian
+
+  void IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
+      updateJacobianAction(mfem::Vector &Ye,
+                           const mfem::FiniteElement &e,
+                           mfem::ElementTransformation &tr,
+                           const mfem::Vector &,
+                           const mfem::Vector &Xe) {
+    this->implementUpdateJacobianAction(Ye, e, tr, Xe);
+  }  // end of updateJacobianAction
+
   void IsotropicTridimensionalStandardSmallStrainMechanicsBehaviourIntegrator::
       computeInnerForces(mfem::Vector &Fe,
                          const mfem::FiniteElement &e,
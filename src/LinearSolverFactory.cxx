@@ -5,7 +5,9 @@
  * \date   24/03/2021
  */
 
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include "mfem/linalg/solvers.hpp"
 #include "mfem/linalg/petsc.hpp"
 #include "mfem/config/config.hpp"
@@ -14,12 +16,258 @@
 #endif
 #include "MGIS/Raise.hxx"
 #include "MFEMMGIS/Parameters.hxx"
+#include "MFEMMGIS/Profiler.hxx"
 #include "MFEMMGIS/SolverUtilities.hxx"
 #include "MFEMMGIS/NonLinearEvolutionProblemImplementation.hxx"
 #include "MFEMMGIS/LinearSolverFactory.hxx"
 
 namespace mfem_mgis {
 
+  /*!
+   * \brief a preconditioner wrapping another one and only updating it every
+   * `n` calls to `SetOperator` or when the number of iterations of the
+   * iterative solver grows too much.
+   *
+   * The wrapped preconditioner is built using a copy of the operator, since
+   * the operator passed to `SetOperator` may be destroyed before the next
+   * update.
+   *
+   * The number of calls to `SetOperator` which kept the wrapped
+   * preconditioner is reported by the `PreconditionerReuses` counter of the
+   * profiler.
+   */
+  struct ReusablePreconditioner final : LinearSolverPreconditioner {
+    /*!
+     * \param[in] p: wrapped preconditioner
+     * \param[in] s: iterative solver using the preconditioner
+     * \param[in] n: maximum number of calls to `SetOperator` between two
+     * updates of the wrapped preconditioner
+     * \param[in] g: relative growth of the number of iterations of the
+     * iterative solver, compared to the first resolution following an
+     * update, above which the wrapped preconditioner is updated. A negative
+     * value disables this criterion.
+     */
+    ReusablePreconditioner(std::unique_ptr<LinearSolverPreconditioner> p,
+                           const mfem::IterativeSolver& s,
+                           const size_type n,
+                           const real g)
+        : preconditioner(std::move(p)),
+          solver(s),
+          update_period(n),
+          iterations_growth_threshold(g) {
+      // make sure that the counter is printed, even if no reuse occurs
+      Profiler::getProfiler().incrementCounter("PreconditionerReuses", 0);
+    }
+    void SetOperator(const mfem::Operator& op) override {
+      this->height = op.Height();
+      this->width = op.Width();
+      const auto niter = this->solver.GetNumIterations();
+      if (this->first_resolution) {
+        // number of iterations of the first resolution following an update
+        this->reference_number_of_iterations = niter;
+        this->first_resolution = false;
+      }
+      const auto growth =
+          (this->iterations_growth_threshold >= 0) &&
+          (niter > (1 + this->iterations_growth_threshold) *
+                       this->reference_number_of_iterations);
+      if ((this->operator_copy != nullptr) &&
+          (this->number_of_calls < this->update_period) && (!growth)) {
+        ++(this->number_of_calls);
+        Profiler::getProfiler().incrementCounter("PreconditionerReuses");
+        return;
+      }
+      auto c = copyOperator(op);
+      this->preconditioner->SetOperator(c != nullptr ? *c : op);
+      this->operator_copy = std::move(c);
+      this->number_of_calls = 1;
+      this->first_resolution = true;
+    }  // end of SetOperator
+    void Mult(const mfem::Vector& x, mfem::Vector& y) const override {
+      this->preconditioner->Mult(x, y);
+    }  // end of Mult
+
+   private:
+    /*!
+     * \return a copy of the given operator, or a null pointer if the type of
+     * the operator is not supported. In this case, the wrapped preconditioner
+     * is updated at each call to `SetOperator`.
+     * \param[in] op: operator
+     */
+    static std::unique_ptr<mfem::Operator> copyOperator(
+        const mfem::Operator& op) {
+#ifdef MFEM_USE_MPI
+      if (const auto* const A = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+          A != nullptr) {
+        return std::make_unique<mfem::HypreParMatrix>(*A);
+      }
+#endif /* MFEM_USE_MPI */
+      if (const auto* const A = dynamic_cast<const mfem::SparseMatrix*>(&op);
+          A != nullptr) {
+        return std::make_unique<mfem::SparseMatrix>(*A);
+      }
+      return {};
+    }  // end of copyOperator
+    //! \brief wrapped preconditioner
+    std::unique_ptr<LinearSolverPreconditioner> preconditioner;
+    //! \brief copy of the operator used by the wrapped preconditioner
+    std::unique_ptr<mfem::Operator> operator_copy;
+    //! \brief iterative solver
+    const mfem::IterativeSolver& solver;
+    //! \brief maximum number of calls to `SetOperator` between two updates
+    const size_type update_period;
+    //! \brief threshold on the relative growth of the number of iterations
+    const real iterations_growth_threshold;
+    //! \brief number of calls to `SetOperator` since the last update
+    size_type number_of_calls = 0;
+    //! \brief number of iterations of the first resolution after an update
+    int reference_number_of_iterations = 0;
+    //! \brief boolean stating if no resolution happened since the last update
+    bool first_resolution = false;
+  };  // end of struct ReusablePreconditioner
+
+  /*!
+   * \brief a Jacobi preconditioner built from the diagonal of the operator.
+   *
+   * The diagonal is retrieved using the `AssembleDiagonal` method of the
+   * operator, so that this preconditioner can be used with operators which
+   * are not assembled, such as the `MatrixFreeJacobianOperator` class.
+   */
+  struct JacobiPreconditioner final : LinearSolverPreconditioner {
+    void SetOperator(const mfem::Operator& op) override {
+      this->height = op.Height();
+      this->width = op.Width();
+      op.AssembleDiagonal(this->diagonal);
+      for (size_type i = 0; i != this->diagonal.Size(); ++i) {
+        if (this->diagonal(i) == real{0}) {
+          raise("JacobiPreconditioner::SetOperator: null diagonal term");
+        }
+      }
+    }  // end of SetOperator
+    void Mult(const mfem::Vector& x, mfem::Vector& y) const override {
+      y.SetSize(x.Size());
+      for (size_type i = 0; i != x.Size(); ++i) {
+        y(i) = x(i) / this->diagonal(i);
+      }
+    }  // end of Mult
+
+   private:
+    //! \brief diagonal of the operator
+    mfem::Vector diagonal;
+  };  // end of struct JacobiPreconditioner
+
+#ifdef MFEM_USE_SUITESPARSE
+
+  /*!
+   * \brief a direct solver based on `UMFPack` which keeps the symbolic
+   * factorisation as long as the sparsity pattern of the matrix is unchanged
+   *
+   * The number of reuses of the symbolic factorisation is reported by the
+   * `SymbolicFactorisationReuses` counter of the profiler.
+   */
+  struct UMFPackSolverWithSymbolicFactorisationReuse final : LinearSolver {
+    UMFPackSolverWithSymbolicFactorisationReuse() {
+      umfpack_di_defaults(this->control);
+      // make sure that the counter is printed, even if no reuse occurs
+      Profiler::getProfiler().incrementCounter("SymbolicFactorisationReuses",
+                                               0);
+    }
+    void SetOperator(const mfem::Operator& op) override {
+      auto* const m = const_cast<mfem::SparseMatrix*>(
+          dynamic_cast<const mfem::SparseMatrix*>(&op));
+      if (m == nullptr) {
+        raise(
+            "UMFPackSolverWithSymbolicFactorisationReuse::SetOperator: "
+            "a sparse matrix is expected");
+      }
+      // UMFPack requires sorted column indices
+      m->SortColumnIndices();
+      this->matrix = m;
+      this->height = m->Height();
+      this->width = m->Width();
+      const auto n = m->Height();
+      const auto* const I = m->GetI();
+      const auto* const J = m->GetJ();
+      const auto nnz = I[n];
+      const auto same_pattern =
+          (this->symbolic != nullptr) &&
+          (this->I.size() == static_cast<std::size_t>(n + 1)) &&
+          (this->J.size() == static_cast<std::size_t>(nnz)) &&
+          (std::equal(I, I + n + 1, this->I.begin())) &&
+          (std::equal(J, J + nnz, this->J.begin()));
+      if (this->numeric != nullptr) {
+        umfpack_di_free_numeric(&(this->numeric));
+      }
+      if (same_pattern) {
+        Profiler::getProfiler().incrementCounter("SymbolicFactorisationReuses");
+      } else {
+        if (this->symbolic != nullptr) {
+          umfpack_di_free_symbolic(&(this->symbolic));
+        }
+        this->I.assign(I, I + n + 1);
+        this->J.assign(J, J + nnz);
+        // the matrix is stored by rows: UMFPack sees its transpose
+        if (umfpack_di_symbolic(n, n, I, J, m->GetData(), &(this->symbolic),
+                                this->control, this->info) < 0) {
+          this->symbolic = nullptr;
+          raise(
+              "UMFPackSolverWithSymbolicFactorisationReuse::SetOperator: "
+              "symbolic factorisation failed");
+        }
+      }
+      if (umfpack_di_numeric(I, J, m->GetData(), this->symbolic,
+                             &(this->numeric), this->control,
+                             this->info) < 0) {
+        this->numeric = nullptr;
+        raise(
+            "UMFPackSolverWithSymbolicFactorisationReuse::SetOperator: "
+            "numeric factorisation failed");
+      }
+    }  // end of SetOperator
+    void Mult(const mfem::Vector& b, mfem::Vector& x) const override {
+      if (this->numeric == nullptr) {
+        raise(
+            "UMFPackSolverWithSymbolicFactorisationReuse::Mult: "
+            "no factorised matrix");
+      }
+      // the transposed system is solved since the matrix is stored by rows
+      if (umfpack_di_solve(UMFPACK_At, this->matrix->GetI(),
+                           this->matrix->GetJ(), this->matrix->GetData(),
+                           x.GetData(), b.GetData(), this->numeric,
+                           this->control, this->info) < 0) {
+        raise(
+            "UMFPackSolverWithSymbolicFactorisationReuse::Mult: "
+            "resolution failed");
+      }
+    }  // end of Mult
+    ~UMFPackSolverWithSymbolicFactorisationReuse() override {
+      if (this->numeric != nullptr) {
+        umfpack_di_free_numeric(&(this->numeric));
+      }
+      if (this->symbolic != nullptr) {
+        umfpack_di_free_symbolic(&(this->symbolic));
+      }
+    }  // end of ~UMFPackSolverWithSymbolicFactorisationReuse
+
+   private:
+    //! \brief factorised matrix
+    const mfem::SparseMatrix* matrix = nullptr;
+    //! \brief row offsets of the matrix used by the symbolic factorisation
+    std::vector<int> I;
+    //! \brief column indices of the matrix used by the symbolic factorisation
+    std::vector<int> J;
+    //! \brief symbolic factorisation
+    void* symbolic = nullptr;
+    //! \brief numeric factorisation
+    void* numeric = nullptr;
+    //! \brief UMFPack' control parameters
+    real control[UMFPACK_CONTROL];
+    //! \brief UMFPack' informations
+    mutable real info[UMFPACK_INFO];
+  };  // end of struct UMFPackSolverWithSymbolicFactorisationReuse
+
+#endif /* MFEM_USE_SUITESPARSE */
+
 #ifdef MFEM_USE_MPI
 
   std::unique_ptr<LinearSolverPreconditioner> setHypreBoomerAMGPreconditioner(
@@ -135,6 +383,14 @@ namespace mfem_mgis {
             name + "'");
       }
       return {};
+    } else if (name == "Jacobi") {
+      if (contains(pr, "Options")) {
+        raise(
+            "setLinearSolverPreconditioner: "
+            "no options expected for preconditioner '" +
+            name + "'");
+      }
+      return std::make_unique<JacobiPreconditioner>();
     } else if (name == "HypreBoomerAMG") {
       if constexpr (parallel) {
         return setHypreBoomerAMGPreconditioner(
@@ -192,8 +448,29 @@ namespace mfem_mgis {
     checkParameters(params, allowed_parameters);
     setSolverParameters(s, extract(params, getIterativeSolverParametersList()));
     if (contains(params, Preconditioner)) {
+      const char* const UpdatePeriod = "UpdatePeriod";
+      const char* const IterationsGrowthThreshold =
+          "IterationsGrowthThreshold";
       const auto pr = get<Parameters>(params, Preconditioner);
-      auto prec = getLinearSolverPreconditioner(p, pr);
+      checkParameters(
+          pr, {"Name", "Options", UpdatePeriod, IterationsGrowthThreshold});
+      auto prec =
+          getLinearSolverPreconditioner(p, extract(pr, {"Name", "Options"}));
+      if (prec == nullptr) {
+        return prec;
+      }
+      if ((contains(pr, UpdatePeriod)) ||
+          (contains(pr, IterationsGrowthThreshold))) {
+        const auto n = get_if<int>(pr, UpdatePeriod, 1);
+        if (n < 1) {
+          raise(
+              "setLinearSolverParameters: "
+              "invalid update period of the preconditioner");
+        }
+        const auto g = get_if<double>(pr, IterationsGrowthThreshold, -1.);
+        prec = std::make_unique<ReusablePreconditioner>(
+            std::move(prec), s, static_cast<size_type>(n), g);
+      }
       s.SetPreconditioner(*prec);
       return prec;
     }
@@ -390,12 +667,22 @@ namespace mfem_mgis {
   buildMUMPSSolverGenerator() {
     return [](NonLinearEvolutionProblemImplementation<true>&,
               const Parameters& params) {
-      checkParameters(params, {"Symmetric", "PositiveDefinite"});
+      checkParameters(params, {"Symmetric", "PositiveDefinite",
+                               "ReuseSymbolicFactorisation"});
       auto s = std::make_unique<mfem::MUMPSSolver>();
       const auto symmetric = get_if<bool>(params, "Symmetric", false);
       const auto positive_definite =
           get_if<bool>(params, "PositiveDefinite", false);
       s->SetPrintLevel(1);
+      if (get_if<bool>(params, "ReuseSymbolicFactorisation", false)) {
+#if MFEM_VERSION >= 40600
+        s->SetReorderingReuse(true);
+#else  /* MFEM_VERSION >= 40600 */
+        raise(
+            "buildMUMPSSolverGenerator: "
+            "reusing the symbolic factorisation requires MFEM 4.6 or later");
+#endif /* MFEM_VERSION >= 40600 */
+      }
       //      if (getMPIrank() == 0) {
       //	mfem_mgis::getOutputStream() << "Global Nbdof " <<
       //p.getFiniteElementSpace().GlobalTrueVSize() << "\n";
@@ -440,7 +727,13 @@ namespace mfem_mgis {
     if constexpr (!parallel) {
 #ifdef MFEM_USE_SUITESPARSE
       f.add("UMFPackSolver", [](NonLinearEvolutionProblemImplementation<false>&,
-                                const Parameters&) {
+                                const Parameters& params) {
+        checkParameters(params, {"ReuseSymbolicFactorisation"});
+        if (get_if<bool>(params, "ReuseSymbolicFactorisation", false)) {
+          return LinearSolverHandler{
+              std::make_unique<UMFPackSolverWithSymbolicFactorisationReuse>(),
+              std::unique_ptr<LinearSolverPreconditioner>{}};
+        }
         return LinearSolverHandler{
             std::make_unique<mfem::UMFPackSolver>(),
             std::unique_ptr<LinearSolverPreconditioner>{}};
@@ -5,6 +5,7 @@
  * \date   26/08/2020
  */
 
+#include <utility>
 #include <algorithm>
 #include "MGIS/Raise.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
@@ -95,6 +96,7 @@ namespace mfem_mgis {
       raise("Material::setRotationMatrix: unimplemented case yet");
     }
     this->r2D = r;
+    this->updateRotationMatrices();
   }  // end of setRotationMatrix
 
   void Material::setRotationMatrix(const RotationMatrix3D &r) {
@@ -180,8 +182,187 @@ namespace mfem_mgis {
       raise("Material::setRotationMatrix: unimplemented case yet");
     }
     this->r3D = r;
+    this->updateRotationMatrices();
   }  // end of setRotationMatrix
 
+  void Material::updateRotationMatrices() {
+    using Function = std::shared_ptr<PartialQuadratureFunction>;
+    auto use_functions = std::holds_alternative<Function>(this->r2D);
+    if (std::holds_alternative<std::array<MaterialAxis3D, 2u>>(this->r3D)) {
+      const auto &[a1, a2] =
+          std::get<std::array<MaterialAxis3D, 2u>>(this->r3D);
+      use_functions = std::holds_alternative<Function>(a1) ||
+                      std::holds_alternative<Function>(a2);
+    }
+    this->rotation_matrices.clear();
+    if (!use_functions) {
+      // the rotation matrix is uniform
+      return;
+    }
+    auto rotation_matrices = std::vector<real>(9 * this->n);
+    for (size_type i = 0; i != this->n; ++i) {
+      const auto r = this->get_rotation_fct_ptr(this->r2D, this->r3D, i);
+      std::copy(r.begin(), r.end(), rotation_matrices.begin() + 9 * i);
+    }
+    this->rotation_matrices = std::move(rotation_matrices);
+  }  // end of updateRotationMatrices
+
+  Material::StateBuffers Material::getStateBuffers(
+      const mgis::behaviour::MaterialStateManager &s) {
+    auto b = StateBuffers{};
+    b.gradients = s.gradients;
+    b.thermodynamic_forces = s.thermodynamic_forces;
+    b.internal_state_variables = s.internal_state_variables;
+    b.stored_energies = s.stored_energies;
+    b.dissipated_energies = s.dissipated_energies;
+    return b;
+  }  // end of getStateBuffers
+
+  void Material::setStateBuffers(mgis::behaviour::MaterialStateManager &s,
+                                 const StateBuffers &b) {
+    s.gradients = b.gradients;
+    s.thermodynamic_forces = b.thermodynamic_forces;
+    s.internal_state_variables = b.internal_state_variables;
+    s.stored_energies = b.stored_energies;
+    s.dissipated_energies = b.dissipated_energies;
+  }  // end of setStateBuffers
+
+  bool Material::areSameStateBuffers(const StateBuffers &b1,
+                                     const StateBuffers &b2) {
+    return (b1.gradients.data() == b2.gradients.data()) &&
+           (b1.thermodynamic_forces.data() == b2.thermodynamic_forces.data()) &&
+           (b1.internal_state_variables.data() ==
+            b2.internal_state_variables.data()) &&
+           (b1.stored_energies.data() == b2.stored_energies.data()) &&
+           (b1.dissipated_energies.data() == b2.dissipated_energies.data());
+  }  // end of areSameStateBuffers
+
+  /*!
+   * \brief copy the values of a span in another one of the same size
+   * \param[out] dest: destination
+   * \param[in] src: source
+   */
+  static void copyStateValues(mgis::span<real> dest,
+                              mgis::span<const real> src) {
+    std::copy(src.begin(), src.end(), dest.begin());
+  }  // end of copyStateValues
+
+  void Material::preserveStateSnapshots(const StateBuffers &b) {
+    const auto ng = b.gradients.size();
+    const auto nt = b.thermodynamic_forces.size();
+    const auto ni = b.internal_state_variables.size();
+    const auto ns = b.stored_energies.size();
+    const auto nd = b.dissipated_energies.size();
+    for (size_type i = 0; i != this->number_of_state_snapshots; ++i) {
+      auto &snapshot = this->state_snapshots[i];
+      if ((snapshot.copied) || (!areSameStateBuffers(snapshot.buffers, b))) {
+        continue;
+      }
+      snapshot.storage.resize(ng + nt + ni + ns + nd);
+      auto *p = snapshot.storage.data();
+      auto c = StateBuffers{};
+      c.gradients = mgis::span<real>(p, ng);
+      c.thermodynamic_forces = mgis::span<real>(p + ng, nt);
+      c.internal_state_variables = mgis::span<real>(p + ng + nt, ni);
+      c.stored_energies = mgis::span<real>(p + ng + nt + ni, ns);
+      c.dissipated_energies = mgis::span<real>(p + ng + nt + ni + ns, nd);
+      copyStateValues(c.gradients, b.gradients);
+      copyStateValues(c.thermodynamic_forces, b.thermodynamic_forces);
+      copyStateValues(c.internal_state_variables, b.internal_state_variables);
+      copyStateValues(c.stored_energies, b.stored_energies);
+      copyStateValues(c.dissipated_energies, b.dissipated_energies);
+      snapshot.buffers = c;
+      snapshot.copied = true;
+    }
+  }  // end of preserveStateSnapshots
+
+  void Material::updateStates() {
+    if (this->shared_state_buffers) {
+      return;
+    }
+    this->spare_state_buffers = getStateBuffers(this->s0);
+    setStateBuffers(this->s0, getStateBuffers(this->s1));
+    this->shared_state_buffers = true;
+  }  // end of updateStates
+
+  void Material::revertStates() {
+    if (this->shared_state_buffers) {
+      return;
+    }
+    this->spare_state_buffers = getStateBuffers(this->s1);
+    setStateBuffers(this->s1, getStateBuffers(this->s0));
+    this->shared_state_buffers = true;
+  }  // end of revertStates
+
+  void Material::detachEndOfTimeStepState() {
+    if (!this->shared_state_buffers) {
+      return;
+    }
+    // the spare buffers are about to be overwritten
+    this->preserveStateSnapshots(this->spare_state_buffers);
+    setStateBuffers(this->s1, this->spare_state_buffers);
+    copyStateValues(this->s1.thermodynamic_forces,
+                    this->s0.thermodynamic_forces);
+    this->shared_state_buffers = false;
+  }  // end of detachEndOfTimeStepState
+
+  void Material::pushStateSnapshot() {
+    if (this->number_of_state_snapshots ==
+        static_cast<size_type>(this->state_snapshots.size())) {
+      this->state_snapshots.emplace_back();
+    }
+    auto &snapshot = this->state_snapshots[this->number_of_state_snapshots];
+    snapshot.buffers = getStateBuffers(this->s0);
+    snapshot.copied = false;
+    ++(this->number_of_state_snapshots);
+  }  // end of pushStateSnapshot
+
+  void Material::restoreStateSnapshot() {
+    if (this->number_of_state_snapshots == 0) {
+      raise("Material::restoreStateSnapshot: no snapshot defined");
+    }
+    const auto &snapshot =
+        this->state_snapshots[this->number_of_state_snapshots - 1];
+    // after this call, both states share the buffers of the state at the
+    // beginning of the time step and the other buffers are spare
+    this->revertStates();
+    if (!snapshot.copied) {
+      if (areSameStateBuffers(snapshot.buffers, getStateBuffers(this->s0))) {
+        return;
+      }
+      if (!areSameStateBuffers(snapshot.buffers, this->spare_state_buffers)) {
+        raise("Material::restoreStateSnapshot: invalid snapshot");
+      }
+    } else {
+      this->preserveStateSnapshots(this->spare_state_buffers);
+      const auto &b = this->spare_state_buffers;
+      copyStateValues(b.gradients, snapshot.buffers.gradients);
+      copyStateValues(b.thermodynamic_forces,
+                      snapshot.buffers.thermodynamic_forces);
+      copyStateValues(b.internal_state_variables,
+                      snapshot.buffers.internal_state_variables);
+      copyStateValues(b.stored_energies, snapshot.buffers.stored_energies);
+      copyStateValues(b.dissipated_energies,
+                      snapshot.buffers.dissipated_energies);
+    }
+    // the spare buffers now hold the saved state
+    const auto b = getStateBuffers(this->s0);
+    setStateBuffers(this->s0, this->spare_state_buffers);
+    setStateBuffers(this->s1, this->spare_state_buffers);
+    this->spare_state_buffers = b;
+  }  // end of restoreStateSnapshot
+
+  void Material::popStateSnapshot() {
+    if (this->number_of_state_snapshots == 0) {
+      raise("Material::popStateSnapshot: no snapshot defined");
+    }
+    --(this->number_of_state_snapshots);
+  }  // end of popStateSnapshot
+
+  size_type Material::getNumberOfStateSnapshots() const {
+    return this->number_of_state_snapshots;
+  }  // end of getNumberOfStateSnapshots
+
   Material::~Material() = default;
 
   static mgis::behaviour::MaterialStateManager &getStateManager(
@@ -202,27 +383,27 @@ namespace mfem_mgis {
 
   static PartialQuadratureFunction buildPartialQuadratureFunction(
       std::shared_ptr<const PartialQuadratureSpace> qs,
-      mgis::span<mgis::real> values,
+      const mgis::span<mgis::real> &values,
       const std::vector<mgis::behaviour::Variable> &variables,
       const mgis::string_view n,
       const Hypothesis h) {
     const auto o = getVariableOffset(variables, n, h);
     const auto s =
         getVariableSize(mgis::behaviour::getVariable(variables, n), h);
-    return PartialQuadratureFunction(qs, values, o, s);
+    return PartialQuadratureFunction(qs, &values, o, s);
   }  // end of buildPartialQuadratureFunction
 
   static ImmutablePartialQuadratureFunctionView
   buildImmutablePartialQuadratureFunctionView(
       std::shared_ptr<const PartialQuadratureSpace> qs,
-      mgis::span<const mgis::real> values,
+      const mgis::span<mgis::real> &values,
       const std::vector<mgis::behaviour::Variable> &variables,
       const mgis::string_view n,
       const Hypothesis h) {
     const auto o = getVariableOffset(variables, n, h);
     const auto s =
         getVariableSize(mgis::behaviour::getVariable(variables, n), h);
-    return ImmutablePartialQuadratureFunctionView(qs, values, o, s);
+    return ImmutablePartialQuadratureFunctionView(qs, &values, o, s);
   }  // end of buildImmutablePartialQuadratureFunctionView
 
   PartialQuadratureFunction getGradient(Material &m,
@@ -289,7 +470,7 @@ namespace mfem_mgis {
       return {};
     }
     return PartialQuadratureFunction(m.getPartialQuadratureSpacePointer(),
-                                     sm.stored_energies);
+                                     &(sm.stored_energies));
   }  // end of getStoredEnergy
 
   std::optional<ImmutablePartialQuadratureFunctionView> getStoredEnergy(
@@ -299,7 +480,7 @@ namespace mfem_mgis {
       return {};
     }
     return ImmutablePartialQuadratureFunctionView(
-        m.getPartialQuadratureSpacePointer(), sm.stored_energies);
+        m.getPartialQuadratureSpacePointer(), &(sm.stored_energies));
   }  // end of getStoredEnergy
 
   std::optional<PartialQuadratureFunction> getDissipatedEnergy(
@@ -309,7 +490,7 @@ namespace mfem_mgis {
       return {};
     }
     return PartialQuadratureFunction(m.getPartialQuadratureSpacePointer(),
-                                     sm.dissipated_energies);
+                                     &(sm.dissipated_energies));
   }  // end of getDissipatedEnergy
 
   std::optional<ImmutablePartialQuadratureFunctionView> getDissipatedEnergy(
@@ -319,7 +500,7 @@ namespace mfem_mgis {
       return {};
     }
     return ImmutablePartialQuadratureFunctionView(
-        m.getPartialQuadratureSpacePointer(), sm.dissipated_energies);
+        m.getPartialQuadratureSpacePointer(), &(sm.dissipated_energies));
   }  // end of getDissipatedEnergy
 
   real computeStoredEnergy(const BehaviourIntegrator &bi,
@@ -0,0 +1,117 @@
+/*!
+ * \file   src/MatrixFreeJacobianOperator.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include "mfem/fem/fespace.hpp"
+#include "mfem/linalg/densemat.hpp"
+#include "MFEMMGIS/MultiMaterialNonLinearIntegrator.hxx"
+#include "MFEMMGIS/MatrixFreeJacobianOperator.hxx"
+
+namespace mfem_mgis {
+
+  /*!
+   * \return the number of true degrees of freedom
+   * \param[in] fes: finite element space
+   * \param[in] P: prolongation operator
+   */
+  static size_type getNumberOfTrueDegreesOfFreedom(
+      const mfem::FiniteElementSpace &fes, const mfem::Operator *const P) {
+    return (P != nullptr) ? P->Width() : fes.GetVSize();
+  }  // end of getNumberOfTrueDegreesOfFreedom
+
+  MatrixFreeJacobianOperator::MatrixFreeJacobianOperator(
+      MultiMaterialNonLinearIntegrator &mi,
+      const mfem::FiniteElementSpace &fes,
+      const mfem::Operator *const P,
+      const mfem::Array<int> &ess_tdofs)
+      : mfem::Operator(getNumberOfTrueDegreesOfFreedom(fes, P)),
+        integrator(mi),
+        fespace(fes),
+        prolongation(P),
+        essential_true_dofs(ess_tdofs) {
+  }  // end of MatrixFreeJacobianOperator
+
+  void MatrixFreeJacobianOperator::setUnknowns(const mfem::Vector &u) {
+    this->unknowns = u;
+  }  // end of setUnknowns
+
+  void MatrixFreeJacobianOperator::Mult(const mfem::Vector &x,
+                                        mfem::Vector &y) const {
+    // the columns associated with the essential degrees of freedom are
+    // eliminated
+    this->constrained_vector = x;
+    for (size_type i = 0; i != this->essential_true_dofs.Size(); ++i) {
+      this->constrained_vector(this->essential_true_dofs[i]) = real{0};
+    }
+    const auto *px = &(this->constrained_vector);
+    if (this->prolongation != nullptr) {
+      this->prolongated_vector.SetSize(this->prolongation->Height());
+      this->prolongation->Mult(this->constrained_vector,
+                               this->prolongated_vector);
+      px = &(this->prolongated_vector);
+    }
+    auto &py = this->prolongated_result;
+    py.SetSize(this->fespace.GetVSize());
+    py = real{0};
+    mfem::Array<int> vdofs;
+    mfem::Vector ue, xe, ye;
+    for (size_type i = 0; i != this->fespace.GetNE(); ++i) {
+      const auto &e = *(this->fespace.GetFE(i));
+      auto &tr = *(this->fespace.GetElementTransformation(i));
+      this->fespace.GetElementVDofs(i, vdofs);
+      this->unknowns.GetSubVector(vdofs, ue);
+      px->GetSubVector(vdofs, xe);
+      this->integrator.updateJacobianAction(e, tr, ue, xe, ye);
+      py.AddElementVector(vdofs, ye);
+    }
+    if (this->prolongation != nullptr) {
+      y.SetSize(this->Height());
+      this->prolongation->MultTranspose(py, y);
+    } else {
+      y = py;
+    }
+    // the rows associated with the essential degrees of freedom are the ones
+    // of the identity
+    for (size_type i = 0; i != this->essential_true_dofs.Size(); ++i) {
+      const auto k = this->essential_true_dofs[i];
+      y(k) = x(k);
+    }
+  }  // end of Mult
+
+  void MatrixFreeJacobianOperator::AssembleDiagonal(mfem::Vector &d) const {
+    auto &pd = this->prolongated_result;
+    pd.SetSize(this->fespace.GetVSize());
+    pd = real{0};
+    mfem::Array<int> vdofs;
+    mfem::Vector ue;
+    mfem::DenseMatrix Ke;
+    for (size_type i = 0; i != this->fespace.GetNE(); ++i) {
+      const auto &e = *(this->fespace.GetFE(i));
+      auto &tr = *(this->fespace.GetElementTransformation(i));
+      this->fespace.GetElementVDofs(i, vdofs);
+      this->unknowns.GetSubVector(vdofs, ue);
+      this->integrator.AssembleElementGrad(e, tr, ue, Ke);
+      for (size_type j = 0; j != vdofs.Size(); ++j) {
+        // the sign of oriented degrees of freedom does not affect the
+        // diagonal
+        const auto k = (vdofs[j] >= 0) ? vdofs[j] : -1 - vdofs[j];
+        pd(k) += Ke(j, j);
+      }
+    }
+    if (this->prolongation != nullptr) {
+      d.SetSize(this->Height());
+      this->prolongation->MultTranspose(pd, d);
+    } else {
+      d = pd;
+    }
+    for (size_type i = 0; i != this->essential_true_dofs.Size(); ++i) {
+      d(this->essential_true_dofs[i]) = real{1};
+    }
+  }  // end of AssembleDiagonal
+
+  MatrixFreeJacobianOperator::~MatrixFreeJacobianOperator() = default;
+
+}  // end of namespace mfem_mgis
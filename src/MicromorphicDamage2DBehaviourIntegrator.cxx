@@ -56,23 +56,20 @@ namespace mfem_mgis {
     return MicromorphicDamage2DBehaviourIntegrator::selectIntegrationRule(e, t);
   }  // end of getIntegrationRule
 
-  bool MicromorphicDamage2DBehaviourIntegrator::integrate(
+  void MicromorphicDamage2DBehaviourIntegrator::computeGradients(
       const mfem::FiniteElement &e,
       mfem::ElementTransformation &tr,
       const mfem::Vector &d_chi,
-      const IntegrationType it) {
+      const IntegrationType) {
     // element offset
     const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
     // integration rule
     const auto &ir = this->getIntegrationRule(e, tr);
-#ifdef MFEM_THREAD_SAFE
-    mfem::Vector shape;
+    auto &lw = this->getThreadWorkspace();
+    auto &shape = lw.shape;
+    auto &dshape = lw.dshape;
     shape.SetSize(e.GetDof());
-    mfem::DenseMatrix dshape(e.GetDof(), e.GetDim());
-#else
-    this->shape.SetSize(e.GetDof());
-    this->dshape.SetSize(e.GetDof(), e.GetDim());
-#endif
+    dshape.SetSize(e.GetDof(), e.GetDim());
     const auto nnodes = e.GetDof();
     const auto gsize = this->s1.gradients_stride;
     for (size_type i = 0; i != ir.GetNPoints(); ++i) {
@@ -96,7 +93,21 @@ namespace mfem_mgis {
         g[1] += d_chi[ni] * dshape(ni, 0);
         g[2] += d_chi[ni] * dshape(ni, 1);
       }
-      if (!this->performsLocalBehaviourIntegration(o, it)) {
+    }
+  }  // end of computeGradients
+
+  bool MicromorphicDamage2DBehaviourIntegrator::integrate(
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &d_chi,
+      const IntegrationType it) {
+    this->computeGradients(e, tr, d_chi, it);
+    // element offset
+    const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
+    // integration rule
+    const auto &ir = this->getIntegrationRule(e, tr);
+    for (size_type i = 0; i != ir.GetNPoints(); ++i) {
+      if (!this->performsLocalBehaviourIntegration(eoffset + i, it)) {
         return false;
       }
     }
@@ -108,14 +119,11 @@ namespace mfem_mgis {
       const mfem::FiniteElement &e,
       mfem::ElementTransformation &tr,
       const mfem::Vector &) {
-#ifdef MFEM_THREAD_SAFE
-    mfem::Vector shape;
+    auto &lw = this->getThreadWorkspace();
+    auto &shape = lw.shape;
+    auto &dshape = lw.dshape;
     shape.SetSize(e.GetDof());
-    mfem::DenseMatrix dshape(e.GetDof(), e.GetDim());
-#else
-    this->shape.SetSize(e.GetDof());
-    this->dshape.SetSize(e.GetDof(), e.GetDim());
-#endif
+    dshape.SetSize(e.GetDof(), e.GetDim());
     const auto nnodes = e.GetDof();
     const auto thsize = this->s1.thermodynamic_forces_stride;
     // element offset
@@ -152,14 +160,11 @@ namespace mfem_mgis {
       const mfem::FiniteElement & e,
       mfem::ElementTransformation & tr,
       const mfem::Vector &) {
-#ifdef MFEM_THREAD_SAFE
-    mfem::Vector shape;
+    auto &lw = this->getThreadWorkspace();
+    auto &shape = lw.shape;
+    auto &dshape = lw.dshape;
     shape.SetSize(e.GetDof());
-    mfem::DenseMatrix dshape(e.GetDof(), e.GetDim());
-#else
-    this->shape.SetSize(e.GetDof());
-    this->dshape.SetSize(e.GetDof(), e.GetDim());
-#endif
+    dshape.SetSize(e.GetDof(), e.GetDim());
     const auto &ir = this->getIntegrationRule(e, tr);
     const auto nnodes = e.GetDof();
     const auto eoffset = this->quadrature_space->getOffset(tr.ElementNo);
@@ -198,18 +203,37 @@ namespace mfem_mgis {
     }
   }  // end of updateJacobian
 
+  void MicromorphicDamage2DBehaviourIntegrator::updateResidualAndJacobian(
+      mfem::Vector &Fe,
+      mfem::DenseMatrix &Ke,
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u) {
+    this->updateResidual(Fe, e, tr, u);
+    this->updateJacobian(Ke, e, tr, u);
+  }  // end of updateResidualAndJacobian
+
+  void MicromorphicDamage2DBehaviourIntegrator::updateJacobianAction(
+      mfem::Vector &Ye,
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u,
+      const mfem::Vector &Xe) {
+    auto &Ke = this->getThreadWorkspace().Ke;
+    this->updateJacobian(Ke, e, tr, u);
+    Ye.SetSize(Ke.Height());
+    Ke.Mult(Xe, Ye);
+  }  // end of updateJacobianAction
+
   void MicromorphicDamage2DBehaviourIntegrator::computeInnerForces(
       mfem::Vector &Fe,
       const mfem::FiniteElement &e,
       mfem::ElementTransformation &tr) {
-#ifdef MFEM_THREAD_SAFE
-    mfem::Vector shape;
+    auto &lw = this->getThreadWorkspace();
+    auto &shape = lw.shape;
+    auto &dshape = lw.dshape;
     shape.SetSize(e.GetDof());
-    mfem::DenseMatrix dshape(e.GetDof(), e.GetDim());
-#else
-    this->shape.SetSize(e.GetDof());
-    this->dshape.SetSize(e.GetDof(), e.GetDim());
-#endif
+    dshape.SetSize(e.GetDof(), e.GetDim());
     const auto nnodes = e.GetDof();
     const auto thsize = this->s1.thermodynamic_forces_stride;
     // element offset
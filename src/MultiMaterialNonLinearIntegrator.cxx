@@ -6,11 +6,14 @@
  */
 
 #include <utility>
+#include <algorithm>
 #include "MGIS/Raise.hxx"
 #include "MFEMMGIS/IntegrationType.hxx"
+#include "MFEMMGIS/Material.hxx"
 #include "MFEMMGIS/BehaviourIntegrator.hxx"
 #include "MFEMMGIS/BehaviourIntegratorFactory.hxx"
 #include "MFEMMGIS/FiniteElementDiscretization.hxx"
+#include "MFEMMGIS/PartialQuadratureSpace.hxx"
 #include "MFEMMGIS/MultiMaterialNonLinearIntegrator.hxx"
 #include "mfem/mesh/pmesh.hpp"
 
@@ -67,6 +70,29 @@ namespace mfem_mgis {
     return bi->integrate(e, tr, U, it);
   }  // end of integrate
 
+  void MultiMaterialNonLinearIntegrator::computeGradients(
+      const mfem::FiniteElement& e,
+      mfem::ElementTransformation& tr,
+      const mfem::Vector& U,
+      const IntegrationType it) {
+    const auto m = tr.Attribute;
+    const auto& bi = this->behaviour_integrators[m];
+    checkIfBehaviourIntegratorIsDefined(bi.get(), "computeGradients", m);
+    bi->computeGradients(e, tr, U, it);
+  }  // end of computeGradients
+
+  bool MultiMaterialNonLinearIntegrator::performsBehaviourIntegration(
+      const IntegrationType it, const size_type nthreads) {
+    for (auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        if (!bi->performsBehaviourIntegration(it, nthreads)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }  // end of performsBehaviourIntegration
+
   void MultiMaterialNonLinearIntegrator::AssembleElementVector(
       const mfem::FiniteElement& e,
       mfem::ElementTransformation& tr,
@@ -93,6 +119,31 @@ namespace mfem_mgis {
     bi->updateJacobian(K, e, tr, U);
   }  // end of AssembleElementGrad
 
+  void MultiMaterialNonLinearIntegrator::AssembleElementVectorAndGrad(
+      const mfem::FiniteElement& e,
+      mfem::ElementTransformation& tr,
+      const mfem::Vector& U,
+      mfem::Vector& F,
+      mfem::DenseMatrix& K) {
+    const auto m = tr.Attribute;
+    const auto& bi = this->behaviour_integrators[m];
+    checkIfBehaviourIntegratorIsDefined(bi.get(),
+                                        "AssembleElementVectorAndGrad", m);
+    bi->updateResidualAndJacobian(F, K, e, tr, U);
+  }  // end of AssembleElementVectorAndGrad
+
+  void MultiMaterialNonLinearIntegrator::updateJacobianAction(
+      const mfem::FiniteElement& e,
+      mfem::ElementTransformation& tr,
+      const mfem::Vector& U,
+      const mfem::Vector& X,
+      mfem::Vector& Y) {
+    const auto m = tr.Attribute;
+    const auto& bi = this->behaviour_integrators[m];
+    checkIfBehaviourIntegratorIsDefined(bi.get(), "updateJacobianAction", m);
+    bi->updateJacobianAction(Y, e, tr, U, X);
+  }  // end of updateJacobianAction
+
   void MultiMaterialNonLinearIntegrator::addBehaviourIntegrator(
       const std::string& n,
       const size_type m,
@@ -163,6 +214,30 @@ namespace mfem_mgis {
     }
   }  // end of setTimeIncrement
 
+  void MultiMaterialNonLinearIntegrator::buildGeometricCaches() {
+    for (auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        const auto& qspace = bi->getPartialQuadratureSpace();
+        qspace.buildGeometricCache(
+            [&bi](mfem::ElementTransformation& tr,
+                  const mfem::IntegrationPoint& ip) {
+              return bi->getIntegrationPointWeight(tr, ip);
+            });
+      }
+    }
+  }  // end of buildGeometricCaches
+
+  std::size_t MultiMaterialNonLinearIntegrator::getGeometricCachesMemoryUsage()
+      const {
+    auto m = std::size_t{};
+    for (const auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        m += bi->getPartialQuadratureSpace().getGeometricCacheMemoryUsage();
+      }
+    }
+    return m;
+  }  // end of getGeometricCachesMemoryUsage
+
   void MultiMaterialNonLinearIntegrator::revert() {
     for (auto& bi : this->behaviour_integrators) {
       if (bi != nullptr) {
@@ -179,6 +254,59 @@ namespace mfem_mgis {
     }
   }  // end of update
 
+  void MultiMaterialNonLinearIntegrator::pushStateSnapshot() {
+    for (auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        bi->getMaterial().pushStateSnapshot();
+      }
+    }
+  }  // end of pushStateSnapshot
+
+  void MultiMaterialNonLinearIntegrator::restoreStateSnapshot() {
+    for (auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        bi->getMaterial().restoreStateSnapshot();
+      }
+    }
+  }  // end of restoreStateSnapshot
+
+  void MultiMaterialNonLinearIntegrator::popStateSnapshot() {
+    for (auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        bi->getMaterial().popStateSnapshot();
+      }
+    }
+  }  // end of popStateSnapshot
+
+  void MultiMaterialNonLinearIntegrator::resetTimeStepScalingFactor() {
+    for (auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        bi->resetTimeStepScalingFactor();
+      }
+    }
+  }  // end of resetTimeStepScalingFactor
+
+  real MultiMaterialNonLinearIntegrator::getTimeStepScalingFactor() const {
+    auto rdt = real{1};
+    for (const auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        rdt = std::min(rdt, bi->getTimeStepScalingFactor());
+      }
+    }
+    return rdt;
+  }  // end of getTimeStepScalingFactor
+
+  TimeStepScalingFactorHistogram
+  MultiMaterialNonLinearIntegrator::getTimeStepScalingFactorHistogram() const {
+    auto h = TimeStepScalingFactorHistogram{};
+    for (const auto& bi : this->behaviour_integrators) {
+      if (bi != nullptr) {
+        h.merge(bi->getTimeStepScalingFactorHistogram());
+      }
+    }
+    return h;
+  }  // end of getTimeStepScalingFactorHistogram
+
   std::vector<size_type>
   MultiMaterialNonLinearIntegrator::getAssignedMaterialsIdentifiers() const {
     std::vector<size_type> mids;
@@ -5,14 +5,156 @@
  * \date   29/03/2021
  */
 
+#include <cmath>
 #include <iomanip>
+#include <algorithm>
 #include <utility>
 #include "MGIS/Raise.hxx"
+#include "MFEMMGIS/Parameters.hxx"
 #include "MFEMMGIS/IntegrationType.hxx"
 #include "MFEMMGIS/NewtonSolver.hxx"
 
 namespace mfem_mgis {
 
+  const char *const NewtonSolver::JacobianUpdatePolicy =
+      "JacobianUpdatePolicy";
+
+  const char *const NewtonSolver::JacobianUpdatePeriod =
+      "JacobianUpdatePeriod";
+
+  const char *const NewtonSolver::JacobianUpdateConvergenceRateThreshold =
+      "JacobianUpdateConvergenceRateThreshold";
+
+  const char *const NewtonSolver::LineSearch = "LineSearch";
+
+  const char *const NewtonSolver::LineSearchMaximumNumberOfIterations =
+      "LineSearchMaximumNumberOfIterations";
+
+  const char *const NewtonSolver::JacobianFreeNewtonKrylov =
+      "JacobianFreeNewtonKrylov";
+
+  const char *const NewtonSolver::JacobianFreeNewtonKrylovPerturbation =
+      "JacobianFreeNewtonKrylovPerturbation";
+
+  const char *const NewtonSolver::JacobianFreeNewtonKrylovRelativeTolerance =
+      "JacobianFreeNewtonKrylovRelativeTolerance";
+
+  const char *const
+      NewtonSolver::JacobianFreeNewtonKrylovMaximumNumberOfIterations =
+          "JacobianFreeNewtonKrylovMaximumNumberOfIterations";
+
+  const char *const NewtonSolver::ForcingTerm = "ForcingTerm";
+
+  const char *const NewtonSolver::ForcingTermMaximumValue =
+      "ForcingTermMaximumValue";
+
+  const char *const NewtonSolver::ForcingTermMinimumValue =
+      "ForcingTermMinimumValue";
+
+  /*!
+   * \brief an operator approximating the product of the jacobian by a vector
+   * by a finite difference of the residual.
+   *
+   * As for the assembled jacobian matrix, the rows and the columns associated
+   * with the essential degrees of freedom are the ones of the identity.
+   */
+  struct NewtonSolver::FiniteDifferenceJacobian final : mfem::Operator {
+    /*!
+     * \brief constructor
+     * \param[in] s: Newton solver
+     */
+    FiniteDifferenceJacobian(const NewtonSolver &s)
+        : mfem::Operator(s.Height()), solver(s) {}
+    /*!
+     * \brief set the estimate of the unknowns at which the jacobian is
+     * evaluated and the associated residual.
+     * \param[in] u: estimate of the unknowns
+     * \param[in] r: residual
+     *
+     * \note both vectors must outlive the use of the operator.
+     */
+    void setLinearisationPoint(const mfem::Vector &u, const mfem::Vector &r) {
+      this->unknowns = &u;
+      this->residual = &r;
+      this->failed = false;
+    }
+    /*!
+     * \return if the evaluation of the residual at a perturbed estimate of
+     * the unknowns failed since the last call to `setLinearisationPoint`.
+     */
+    bool hasFailed() const { return this->failed; }
+    //
+    void Mult(const mfem::Vector &v, mfem::Vector &y) const override {
+      // maximum number of reductions of the perturbation if the integration
+      // of the behaviours fails
+      constexpr size_type max_trials = 3;
+      const auto &ess = *(this->solver.essential_true_dofs);
+      y.SetSize(v.Size());
+      auto &d = this->direction;
+      d = v;
+      for (size_type i = 0; i != ess.Size(); ++i) {
+        d(ess[i]) = real{0};
+      }
+      const auto nd = this->solver.Norm(d);
+      auto success = (!this->failed) && (nd > 0);
+      if (success) {
+        const auto nu = this->solver.Norm(*(this->unknowns));
+        auto h = this->solver.jacobian_free_newton_krylov_perturbation *
+                 (1 + nu) / nd;
+        success = false;
+        for (size_type i = 0; (i != max_trials) && (!success); ++i) {
+          if (i != 0) {
+            h /= 10;
+          }
+          mfem::add(*(this->unknowns), h, d, this->trial_unknowns);
+          success = this->solver.trial_residual_evaluator(
+              y, this->trial_unknowns);
+        }
+        if (success) {
+          y -= *(this->residual);
+          y /= h;
+        } else {
+          this->failed = true;
+        }
+      }
+      if (!success) {
+        y = real{0};
+      }
+      for (size_type i = 0; i != ess.Size(); ++i) {
+        y(ess[i]) = v(ess[i]);
+      }
+    }  // end of Mult
+
+   private:
+    //! \brief Newton solver
+    const NewtonSolver &solver;
+    //! \brief estimate of the unknowns
+    const mfem::Vector *unknowns = nullptr;
+    //! \brief residual at the estimate of the unknowns
+    const mfem::Vector *residual = nullptr;
+    //! \brief direction with null values on the essential degrees of freedom
+    mutable mfem::Vector direction;
+    //! \brief perturbed estimate of the unknowns
+    mutable mfem::Vector trial_unknowns;
+    //! \brief boolean stating if the evaluation of a residual failed
+    mutable bool failed = false;
+  };  // end of struct NewtonSolver::FiniteDifferenceJacobian
+
+  std::vector<std::string> NewtonSolver::getParametersList() {
+    return {NewtonSolver::JacobianUpdatePolicy,
+            NewtonSolver::JacobianUpdatePeriod,
+            NewtonSolver::JacobianUpdateConvergenceRateThreshold,
+            NewtonSolver::LineSearch,
+            NewtonSolver::LineSearchMaximumNumberOfIterations,
+            NewtonSolver::JacobianFreeNewtonKrylov,
+            NewtonSolver::JacobianFreeNewtonKrylovPerturbation,
+            NewtonSolver::JacobianFreeNewtonKrylovRelativeTolerance,
+            NewtonSolver::JacobianFreeNewtonKrylovMaximumNumberOfIterations,
+            NewtonSolver::ForcingTerm,
+            NewtonSolver::ForcingTermMaximumValue,
+            NewtonSolver::ForcingTermMinimumValue};
+  }  // end of getParametersList
+
   template <bool parallel>
   static void checkSolverOperator(
       const NonLinearEvolutionProblemImplementation<parallel> &p) {
@@ -31,10 +173,17 @@ namespace mfem_mgis {
     this->height = p.Height();
     this->width = p.Width();
     this->iterative_mode = true;
-    this->addNewUnknownsEstimateActions([&p](const mfem::Vector &u) {
-      return p.integrate(
-          u, IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR);
+    this->addNewUnknownsEstimateActions([this, &p](const mfem::Vector &u) {
+      return p.integrate(u, this->getIntegrationType());
     });
+    this->trial_residual_evaluator = [&p](mfem::Vector &r,
+                                          const mfem::Vector &u) {
+      return p.evaluateTrialResidual(r, u);
+    };
+    this->essential_true_dofs = &(p.GetEssentialTrueDofs());
+    this->jfnk_linear_solver = std::make_unique<mfem::FGMRESSolver>(
+        p.getFiniteElementSpace().GetComm());
+    this->initializeJacobianFreeLinearSolver();
   }  // end of NewtonSolver
 
 #endif /* MFEM_USE_MPI */
@@ -45,12 +194,30 @@ namespace mfem_mgis {
     this->height = p.Height();
     this->width = p.Width();
     this->iterative_mode = true;
-    this->addNewUnknownsEstimateActions([&p](const mfem::Vector &u) {
-      return p.integrate(
-          u, IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR);
+    this->addNewUnknownsEstimateActions([this, &p](const mfem::Vector &u) {
+      return p.integrate(u, this->getIntegrationType());
     });
+    this->trial_residual_evaluator = [&p](mfem::Vector &r,
+                                          const mfem::Vector &u) {
+      return p.evaluateTrialResidual(r, u);
+    };
+    this->essential_true_dofs = &(p.GetEssentialTrueDofs());
+    this->jfnk_linear_solver = std::make_unique<mfem::FGMRESSolver>();
+    this->initializeJacobianFreeLinearSolver();
   }  // end of NewtonSolver
 
+  void NewtonSolver::initializeJacobianFreeLinearSolver() {
+    this->jfnk_jacobian = std::make_unique<FiniteDifferenceJacobian>(*this);
+    auto &s = *(this->jfnk_linear_solver);
+    // the operator must be set before the preconditioner, since
+    // `SetOperator` forwards the operator to the preconditioner
+    s.SetOperator(*(this->jfnk_jacobian));
+    s.iterative_mode = false;
+    s.SetRelTol(real(1e-6));
+    s.SetAbsTol(real{0});
+    s.SetMaxIter(100);
+  }  // end of initializeJacobianFreeLinearSolver
+
   void NewtonSolver::SetOperator(const mfem::Operator &) {
     raise("NewtonSolver::SetOperator: invalid call");
   }  // end of SetOperator
@@ -62,12 +229,170 @@ namespace mfem_mgis {
   void NewtonSolver::setLinearSolver(LinearSolver &s) {
     this->prec = &s;
     this->prec->iterative_mode = false;
+    this->jacobian_available = false;
   }  // end of setLinearSolver
 
+  void NewtonSolver::setParameters(const Parameters &params) {
+    checkParameters(params, NewtonSolver::getParametersList());
+    if (contains(params, NewtonSolver::JacobianUpdatePolicy)) {
+      const auto p =
+          get<std::string>(params, NewtonSolver::JacobianUpdatePolicy);
+      if (p == "EveryIteration") {
+        this->jacobian_update_policy =
+            JacobianUpdatePolicyType::EVERY_ITERATION;
+      } else if (p == "Periodic") {
+        this->jacobian_update_policy = JacobianUpdatePolicyType::PERIODIC;
+      } else if (p == "OnSlowConvergence") {
+        this->jacobian_update_policy =
+            JacobianUpdatePolicyType::ON_SLOW_CONVERGENCE;
+      } else if (p == "InitialTangent") {
+        this->jacobian_update_policy =
+            JacobianUpdatePolicyType::INITIAL_TANGENT;
+      } else {
+        raise("NewtonSolver::setParameters: invalid jacobian update policy '" +
+              p + "'");
+      }
+    }
+    if (contains(params, NewtonSolver::JacobianUpdatePeriod)) {
+      const auto n = get<int>(params, NewtonSolver::JacobianUpdatePeriod);
+      if (n < 1) {
+        raise(
+            "NewtonSolver::setParameters: "
+            "invalid jacobian update period");
+      }
+      this->jacobian_update_period = static_cast<size_type>(n);
+    }
+    if (contains(params,
+                 NewtonSolver::JacobianUpdateConvergenceRateThreshold)) {
+      const auto r = get<double>(
+          params, NewtonSolver::JacobianUpdateConvergenceRateThreshold);
+      if (!(r > 0)) {
+        raise(
+            "NewtonSolver::setParameters: "
+            "invalid convergence rate threshold");
+      }
+      this->jacobian_update_convergence_rate_threshold = r;
+    }
+    if (contains(params, NewtonSolver::LineSearch)) {
+      const auto l = get<std::string>(params, NewtonSolver::LineSearch);
+      if (l == "None") {
+        this->line_search = LineSearchType::NONE;
+      } else if (l == "Backtracking") {
+        this->line_search = LineSearchType::BACKTRACKING;
+      } else if (l == "CriticalPoint") {
+        this->line_search = LineSearchType::CRITICAL_POINT;
+      } else {
+        raise("NewtonSolver::setParameters: invalid line search '" + l + "'");
+      }
+    }
+    if (contains(params, NewtonSolver::LineSearchMaximumNumberOfIterations)) {
+      const auto n =
+          get<int>(params, NewtonSolver::LineSearchMaximumNumberOfIterations);
+      if (n < 0) {
+        raise(
+            "NewtonSolver::setParameters: "
+            "invalid maximum number of iterations of the line search");
+      }
+      this->line_search_maximum_number_of_iterations =
+          static_cast<size_type>(n);
+    }
+    if (contains(params, NewtonSolver::JacobianFreeNewtonKrylov)) {
+      this->use_jacobian_free_newton_krylov =
+          get<bool>(params, NewtonSolver::JacobianFreeNewtonKrylov);
+    }
+    if (contains(params, NewtonSolver::JacobianFreeNewtonKrylovPerturbation)) {
+      const auto e = get<double>(
+          params, NewtonSolver::JacobianFreeNewtonKrylovPerturbation);
+      if (!(e > 0)) {
+        raise(
+            "NewtonSolver::setParameters: "
+            "invalid perturbation of the jacobian-free mode");
+      }
+      this->jacobian_free_newton_krylov_perturbation = e;
+    }
+    if (contains(params,
+                 NewtonSolver::JacobianFreeNewtonKrylovRelativeTolerance)) {
+      const auto e = get<double>(
+          params, NewtonSolver::JacobianFreeNewtonKrylovRelativeTolerance);
+      if (!(e > 0)) {
+        raise(
+            "NewtonSolver::setParameters: "
+            "invalid relative tolerance of the jacobian-free mode");
+      }
+      this->jfnk_linear_solver->SetRelTol(e);
+    }
+    if (contains(
+            params,
+            NewtonSolver::JacobianFreeNewtonKrylovMaximumNumberOfIterations)) {
+      const auto n = get<int>(
+          params,
+          NewtonSolver::JacobianFreeNewtonKrylovMaximumNumberOfIterations);
+      if (n < 1) {
+        raise(
+            "NewtonSolver::setParameters: "
+            "invalid maximum number of iterations of the jacobian-free mode");
+      }
+      this->jfnk_linear_solver->SetMaxIter(n);
+    }
+    if (contains(params, NewtonSolver::ForcingTerm)) {
+      const auto f = get<std::string>(params, NewtonSolver::ForcingTerm);
+      if (f == "Constant") {
+        this->forcing_term_policy = ForcingTermType::CONSTANT;
+      } else if (f == "EisenstatWalker") {
+        this->forcing_term_policy = ForcingTermType::EISENSTAT_WALKER;
+      } else {
+        raise("NewtonSolver::setParameters: invalid forcing term '" + f +
+              "'");
+      }
+    }
+    if (contains(params, NewtonSolver::ForcingTermMaximumValue)) {
+      this->forcing_term_maximum_value =
+          get<double>(params, NewtonSolver::ForcingTermMaximumValue);
+    }
+    if (contains(params, NewtonSolver::ForcingTermMinimumValue)) {
+      this->forcing_term_minimum_value =
+          get<double>(params, NewtonSolver::ForcingTermMinimumValue);
+    }
+    if ((!(this->forcing_term_minimum_value > 0)) ||
+        (!(this->forcing_term_maximum_value < 1)) ||
+        (this->forcing_term_minimum_value >
+         this->forcing_term_maximum_value)) {
+      raise(
+          "NewtonSolver::setParameters: "
+          "invalid bounds of the forcing term");
+    }
+  }  // end of setParameters
+
   real NewtonSolver::GetInitialNorm() const {
     return this->initial_norm;
   }  // end of GetInitialNorm
 
+  size_type NewtonSolver::getNumberOfLinearSolverIterations() const {
+    return this->linear_solver_iterations;
+  }  // end of getNumberOfLinearSolverIterations
+
+  size_type NewtonSolver::getEstimatedNumberOfSavedLinearSolverIterations()
+      const {
+    return static_cast<size_type>(
+        std::round(this->saved_linear_solver_iterations));
+  }  // end of getEstimatedNumberOfSavedLinearSolverIterations
+
+  /*!
+   * \return the relative tolerance of an iterative solver.
+   * \param[in] s: iterative solver
+   *
+   * \note `mfem::IterativeSolver` does not provide any accessor to its
+   * relative tolerance, which is a protected member.
+   */
+  static real getRelativeTolerance(const mfem::IterativeSolver &s) {
+    struct Accessor : mfem::IterativeSolver {
+      static real get(const mfem::IterativeSolver &is) {
+        return is.*(&Accessor::rel_tol);
+      }
+    };
+    return Accessor::get(s);
+  }  // end of getRelativeTolerance
+
   void NewtonSolver::Mult(const mfem::Vector &, mfem::Vector &x) const {
     MFEM_ASSERT(this->oper != nullptr,
                 "the Operator is not set (use SetOperator).");
@@ -85,9 +410,34 @@ namespace mfem_mgis {
 
     this->final_iter = size_type{};
     this->final_norm = std::numeric_limits<real>::max();
+    this->linear_solver_iterations = size_type{};
+    this->saved_linear_solver_iterations = real{0};
+
+    // the relative tolerance of the linear solver is modified by the
+    // `"EisenstatWalker"` policy: the configured one is restored on exit
+    struct RelativeToleranceGuard {
+      ~RelativeToleranceGuard() {
+        if (this->s != nullptr) {
+          this->s->SetRelTol(this->rtol);
+        }
+      }
+      mfem::IterativeSolver *const s;
+      const real rtol;
+    };
+    auto *const ls =
+        (this->forcing_term_policy == ForcingTermType::EISENSTAT_WALKER)
+            ? this->getIterativeLinearSolver()
+            : nullptr;
+    if (ls != nullptr) {
+      this->linear_solver_relative_tolerance = getRelativeTolerance(*ls);
+    }
+    const auto guard =
+        RelativeToleranceGuard{ls, this->linear_solver_relative_tolerance};
 
+    this->update_jacobian = this->mustUpdateJacobian(0, real{0});
     if (!this->processNewUnknownsEstimate(x)) {
       this->converged = 0;
+      this->update_jacobian = true;
       return;
     }
     this->initial_norm = updateResidual();
@@ -96,6 +446,7 @@ namespace mfem_mgis {
     const auto norm_goal = std::max(rel_tol * (this->initial_norm), abs_tol);
     auto it = size_type{};
     auto norm = this->initial_norm;
+    auto previous_norm = real{0};
 
     while (true) {
       MFEM_ASSERT(mfem::IsFinite(norm), "norm = " << norm);
@@ -121,26 +472,43 @@ namespace mfem_mgis {
         break;
       }
       //
+      if (this->forcing_term_policy == ForcingTermType::EISENSTAT_WALKER) {
+        this->updateForcingTerm(norm, previous_norm, norm_goal);
+      }
+      //
       if (!this->computeNewtonCorrection(c, r, x)) {
-        this->converged = 0;
-        break;
+        if (this->update_jacobian) {
+          this->converged = 0;
+          break;
+        }
+        // the reused jacobian matrix may be inappropriate: the behaviours
+        // are integrated again to compute the tangent operator
+        this->update_jacobian = true;
+        if ((!this->processNewUnknownsEstimate(x)) ||
+            (!this->computeNewtonCorrection(c, r, x))) {
+          this->converged = 0;
+          break;
+        }
       }
       //
-      // x_{i+1} = x_i - c * [DF(x_i)]^{-1} [F(x_i)-b]
-      //      add(x, -1, c, x);
-      x -= c;
-
-      if (!this->processNewUnknownsEstimate(x)) {
+      const auto rate = (previous_norm > 0) ? norm / previous_norm : real{0};
+      this->update_jacobian = this->mustUpdateJacobian(it + 1, rate);
+      //
+      // x_{i+1} = x_i - alpha * [DF(x_i)]^{-1} [F(x_i)-b]
+      if (!this->applyNewtonCorrection(x, r, c, norm)) {
         this->converged = 0;
         break;
       }
 
-      updateResidual();
+      previous_norm = norm;
       norm = this->Norm(r);
       ++it;
     }
     this->final_iter = it;
     this->final_norm = norm;
+    // calls to computeNewtonCorrection outside of this method always
+    // update the jacobian matrix
+    this->update_jacobian = true;
   }  // end of Mult
 
   void NewtonSolver::computeResidual(mfem::Vector &r,
@@ -157,9 +525,105 @@ namespace mfem_mgis {
                 "the Operator is not set (use SetOperator).");
     MFEM_ASSERT(this->prec != nullptr,
                 "the Solver is not set (use setLinearSolver).");
+    if ((this->update_jacobian) || (!this->jacobian_available)) {
+      this->prec->SetOperator(this->getJacobian(u));
+      this->jacobian_available = true;
+    }
+    const auto success = this->use_jacobian_free_newton_krylov
+                             ? this->solveJacobianFreeLinearSystem(c, r, u)
+                             : this->solveLinearSystem(c, r);
+    this->updateLinearSolverStatistics();
+    return success;
+  }  // end of computeNewtonCorrection
+
+  bool NewtonSolver::solveLinearisedProblem(mfem::Vector &c,
+                                            const mfem::Vector &r,
+                                            const mfem::Vector &u) const {
+    MFEM_ASSERT(this->oper != nullptr,
+                "the Operator is not set (use SetOperator).");
+    MFEM_ASSERT(this->prec != nullptr,
+                "the Solver is not set (use setLinearSolver).");
+    this->prec->SetOperator(this->getJacobian(u));
+    this->jacobian_available = true;
+    return this->solveLinearSystem(c, r);
+  }  // end of solveLinearisedProblem
+
+  mfem::IterativeSolver *NewtonSolver::getIterativeLinearSolver() const {
+    if (this->use_jacobian_free_newton_krylov) {
+      return this->jfnk_linear_solver.get();
+    }
+    return dynamic_cast<mfem::IterativeSolver *>(this->prec);
+  }  // end of getIterativeLinearSolver
+
+  void NewtonSolver::updateForcingTerm(const real norm,
+                                       const real previous_norm,
+                                       const real norm_goal) const {
+    // parameters of the second choice of Eisenstat and Walker
+    constexpr auto gamma = real(0.9);
+    constexpr auto alpha = real(2);
+    // forcing term at the first iteration
+    constexpr auto eta0 = real(0.5);
+    auto *const s = this->getIterativeLinearSolver();
+    if (s == nullptr) {
+      return;
+    }
+    const auto eta_min = this->forcing_term_minimum_value;
+    const auto eta_max = this->forcing_term_maximum_value;
+    auto eta = std::min(eta0, eta_max);
+    if (previous_norm > 0) {
+      eta = gamma * std::pow(norm / previous_norm, alpha);
+      // safeguard against a too fast decrease of the forcing term
+      const auto eta_s = gamma * std::pow(this->forcing_term, alpha);
+      if (eta_s > real(0.1)) {
+        eta = std::max(eta, eta_s);
+      }
+      eta = std::min(eta, eta_max);
+      // safeguard against oversolving the last linear systems
+      eta = std::max(eta, std::min(eta_max, norm_goal / (2 * norm)));
+    }
+    this->forcing_term = std::max(eta, eta_min);
+    s->SetRelTol(this->forcing_term);
+  }  // end of updateForcingTerm
+
+  void NewtonSolver::updateLinearSolverStatistics() const {
+    const auto *const s = this->getIterativeLinearSolver();
+    if (s == nullptr) {
+      return;
+    }
+    const auto n = s->GetNumIterations();
+    this->linear_solver_iterations += n;
+    const auto rtol = this->linear_solver_relative_tolerance;
+    if ((this->forcing_term_policy == ForcingTermType::EISENSTAT_WALKER) &&
+        (n > 0) && (rtol > 0) && (this->forcing_term > rtol) &&
+        (this->forcing_term < 1)) {
+      // number of iterations required to reduce the residual of the linear
+      // solver by its configured relative tolerance, i.e. without the
+      // `"EisenstatWalker"` policy, assuming that the residual decreases
+      // geometrically
+      const auto nref =
+          n * std::log(rtol) / std::log(this->forcing_term);
+      this->saved_linear_solver_iterations += nref - n;
+    }
+  }  // end of updateLinearSolverStatistics
+
+  bool NewtonSolver::solveJacobianFreeLinearSystem(
+      mfem::Vector &c, const mfem::Vector &r, const mfem::Vector &u) const {
+    auto &s = *(this->jfnk_linear_solver);
+    // the linear solver holding the jacobian matrix is only used as a
+    // preconditioner: its convergence is not checked
+    s.SetPreconditioner(*(this->prec));
+    this->jfnk_jacobian->setLinearisationPoint(u, r);
+    s.Mult(r, c);
+    if (this->jfnk_jacobian->hasFailed()) {
+      return false;
+    }
+    return s.GetConverged();
+  }  // end of solveJacobianFreeLinearSystem
+
+  bool NewtonSolver::solveLinearSystem(mfem::Vector &c,
+                                       const mfem::Vector &r) const {
     const auto usesIterativeLinearSolver =
         dynamic_cast<const IterativeSolver *>(this->prec) != nullptr;
-    this->prec->SetOperator(this->getJacobian(u));
     this->prec->Mult(r, c);  // c = [DF(x_i)]^{-1} [F(x_i)-b]
     if (usesIterativeLinearSolver) {
       const auto &iprec =
@@ -167,7 +631,132 @@ namespace mfem_mgis {
       return iprec.GetConverged();
     }
     return true;
-  }  // end of computeNewtonCorrection
+  }  // end of solveLinearSystem
+
+  bool NewtonSolver::applyNewtonCorrection(mfem::Vector &u,
+                                           mfem::Vector &r,
+                                           const mfem::Vector &c,
+                                           const real norm) const {
+    // parameter of the sufficient decrease condition
+    constexpr auto eps = real(1e-4);
+    // ratio of the projections of the residual on the Newton correction
+    // below which the critical point line search stops
+    constexpr auto cp_eps = real(1e-1);
+    // bounds of the step
+    constexpr auto alpha_min = real(1e-2);
+    constexpr auto alpha_max = real(1);
+    if (this->line_search == LineSearchType::NONE) {
+      u -= c;
+      if (!this->processNewUnknownsEstimate(u)) {
+        return false;
+      }
+      this->computeResidual(r, u);
+      return true;
+    }
+    // estimate the unknowns for the given step and compute the residual
+    auto trial = [this, &u, &r, &c](const real alpha) {
+      u = this->line_search_unknowns;
+      u.Add(-alpha, c);
+      if (!this->processNewUnknownsEstimate(u)) {
+        return false;
+      }
+      this->computeResidual(r, u);
+      return true;
+    };
+    // projection of the residual on the Newton correction at the beginning
+    // of the line search
+    const auto s0 = (this->line_search == LineSearchType::CRITICAL_POINT)
+                        ? this->Dot(c, r)
+                        : real{0};
+    this->line_search_unknowns = u;
+    // the full step is integrated with the tangent operator if required
+    auto alpha = alpha_max;
+    auto success = trial(alpha);
+    auto ra = success ? this->Norm(r) : real{0};
+    if ((success) && (ra <= (1 - eps * alpha) * norm)) {
+      return true;
+    }
+    // the other trials don't compute the tangent operator
+    const auto update = this->update_jacobian;
+    this->update_jacobian = false;
+    auto tangent_operator_computed = true;
+    auto alpha_p = real{0};
+    auto s_p = s0;
+    for (size_type i = 0; i != this->line_search_maximum_number_of_iterations;
+         ++i) {
+      auto alpha_n = alpha / 2;
+      if (success) {
+        if (this->line_search == LineSearchType::BACKTRACKING) {
+          // minimum of the quadratic interpolation of the square of the norm
+          // of the residual
+          const auto d = ra * ra - norm * norm + 2 * alpha * norm * norm;
+          if (d > 0) {
+            alpha_n = std::clamp(alpha * alpha * norm * norm / d,
+                                 alpha / 10, alpha / 2);
+          }
+        } else {
+          // secant iteration on the projection of the residual on the Newton
+          // correction
+          const auto sa = this->Dot(c, r);
+          if (std::abs(sa) <= cp_eps * std::abs(s0)) {
+            break;
+          }
+          if (sa != s_p) {
+            alpha_n = std::clamp(alpha - sa * (alpha - alpha_p) / (sa - s_p),
+                                 alpha_min, alpha_max);
+          }
+          alpha_p = alpha;
+          s_p = sa;
+        }
+      }
+      alpha = alpha_n;
+      success = trial(alpha);
+      tangent_operator_computed = false;
+      if (!success) {
+        continue;
+      }
+      ra = this->Norm(r);
+      if ((this->line_search == LineSearchType::BACKTRACKING) &&
+          (ra <= (1 - eps * alpha) * norm)) {
+        break;
+      }
+    }
+    this->update_jacobian = update;
+    if (!success) {
+      return false;
+    }
+    if ((!tangent_operator_computed) && (this->update_jacobian)) {
+      // the tangent operator is computed at the accepted estimate. The
+      // residual is unchanged.
+      return this->processNewUnknownsEstimate(u);
+    }
+    return true;
+  }  // end of applyNewtonCorrection
+
+  bool NewtonSolver::mustUpdateJacobian(const size_type i,
+                                        const real rate) const {
+    if (!this->jacobian_available) {
+      return true;
+    }
+    switch (this->jacobian_update_policy) {
+      case JacobianUpdatePolicyType::PERIODIC:
+        return i % (this->jacobian_update_period) == 0;
+      case JacobianUpdatePolicyType::ON_SLOW_CONVERGENCE:
+        return rate > this->jacobian_update_convergence_rate_threshold;
+      case JacobianUpdatePolicyType::INITIAL_TANGENT:
+        return false;
+      case JacobianUpdatePolicyType::EVERY_ITERATION:
+        break;
+    }
+    return true;
+  }  // end of mustUpdateJacobian
+
+  IntegrationType NewtonSolver::getIntegrationType() const {
+    if (this->update_jacobian) {
+      return IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    }
+    return IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+  }  // end of getIntegrationType
 
   mfem::Operator &NewtonSolver::getJacobian(const mfem::Vector &u) const {
     MFEM_ASSERT(this->oper != nullptr,
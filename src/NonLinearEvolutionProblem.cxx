@@ -215,6 +215,22 @@ namespace mfem_mgis {
     this->pimpl->revert();
   }  // end of revert
 
+  void NonLinearEvolutionProblem::pushSnapshot() {
+    this->pimpl->pushSnapshot();
+  }  // end of pushSnapshot
+
+  void NonLinearEvolutionProblem::restoreSnapshot() {
+    this->pimpl->restoreSnapshot();
+  }  // end of restoreSnapshot
+
+  void NonLinearEvolutionProblem::popSnapshot() {
+    this->pimpl->popSnapshot();
+  }  // end of popSnapshot
+
+  size_type NonLinearEvolutionProblem::getNumberOfSnapshots() const {
+    return this->pimpl->getNumberOfSnapshots();
+  }  // end of getNumberOfSnapshots
+
   void NonLinearEvolutionProblem::setup(const real, const real) {
   }  // end of setup
 
@@ -9,6 +9,11 @@
 #include "mfem/linalg/petsc.hpp"
 #endif MFEM_USE_PETSC
 
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <exception>
 #include "MGIS/Raise.hxx"
 #include "MFEMMGIS/Parameters.hxx"
 #include "MFEMMGIS/SolverUtilities.hxx"
@@ -19,6 +24,7 @@
 #include "MFEMMGIS/PostProcessingFactory.hxx"
 #include "MFEMMGIS/FiniteElementDiscretization.hxx"
 #include "MFEMMGIS/MultiMaterialNonLinearIntegrator.hxx"
+#include "MFEMMGIS/MatrixFreeJacobianOperator.hxx"
 #include "MFEMMGIS/NonLinearEvolutionProblemImplementation.hxx"
 
 namespace mfem_mgis {
@@ -51,6 +57,334 @@ namespace mfem_mgis {
     std::function<void(const real, const real)> f;
   };  // end of struct StdFunctionPostProcessing
 
+  /*!
+   * \brief apply a function on all the elements of a finite element space
+   * \return true if the function succeeded on every element
+   * \param[in] fespace: finite element space
+   * \param[in] u: current estimate of the unknowns (prolongated)
+   * \param[in] nthreads: number of threads
+   * \param[in] f: function called on each element with the finite element,
+   * the element transformation and the values of the unknowns on the element
+   *
+   * \note if more than one thread is used, each thread has its own element
+   * transformation. The behaviour integrators are responsible for providing a
+   * workspace per thread.
+   */
+  template <typename FiniteElementSpaceType, typename ElementFunction>
+  static bool performLoopOverElements(const FiniteElementSpaceType& fespace,
+                                      const mfem::Vector& u,
+                                      const size_type nthreads,
+                                      const ElementFunction& f) {
+    const auto ne = fespace.GetNE();
+    if (nthreads == 1) {
+      mfem::Array<int> vdofs;
+      mfem::Vector ue;
+      for (size_type i = 0; i != ne; ++i) {
+        const auto& e = *(fespace.GetFE(i));
+        auto& tr = *(fespace.GetElementTransformation(i));
+        fespace.GetElementVDofs(i, vdofs);
+        u.GetSubVector(vdofs, ue);
+        if (!f(e, tr, ue)) {
+          return false;
+        }
+      }
+      return true;
+    }
+#ifdef _OPENMP
+    auto& mesh = *(fespace.GetMesh());
+    const auto n = std::min(nthreads, getMaximumNumberOfThreads());
+    auto noerror = true;
+    // exceptions can't be propagated outside a parallel region
+    auto error = std::exception_ptr{};
+#pragma omp parallel num_threads(n) reduction(&& : noerror)
+    {
+      mfem::Array<int> vdofs;
+      mfem::Vector ue;
+      mfem::IsoparametricTransformation tr;
+#pragma omp for schedule(dynamic, 64)
+      for (size_type i = 0; i < ne; ++i) {
+        if (!noerror) {
+          // the function failed on an element treated by this thread
+          continue;
+        }
+        try {
+          const auto& e = *(fespace.GetFE(i));
+          mesh.GetElementTransformation(i, &tr);
+          fespace.GetElementVDofs(i, vdofs);
+          u.GetSubVector(vdofs, ue);
+          noerror = f(e, tr, ue);
+        } catch (...) {
+#pragma omp critical
+          {
+            if (!error) {
+              error = std::current_exception();
+            }
+          }
+          noerror = false;
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return noerror;
+#else  /* _OPENMP */
+    raise("performLoopOverElements: support for OpenMP has not been enabled");
+#endif /* _OPENMP */
+  }  // end of performLoopOverElements
+
+  /*!
+   * \brief integrate the behaviours over all the elements of a finite element
+   * space.
+   * \return true if the integration succeeded on every element
+   * \param[in] mi: multi-material integrator
+   * \param[in] fespace: finite element space
+   * \param[in] u: current estimate of the unknowns (prolongated)
+   * \param[in] it: integration type
+   * \param[in] nthreads: number of threads
+   * \param[in] batched: if true, the gradients are computed on all the
+   * elements before integrating the behaviours on each material at once.
+   */
+  template <typename FiniteElementSpaceType>
+  static bool integrateOverElements(MultiMaterialNonLinearIntegrator& mi,
+                                    const FiniteElementSpaceType& fespace,
+                                    const mfem::Vector& u,
+                                    const IntegrationType it,
+                                    const size_type nthreads,
+                                    const bool batched) {
+    if (batched) {
+      performLoopOverElements(
+          fespace, u, nthreads,
+          [&mi, it](const mfem::FiniteElement& e,
+                    mfem::ElementTransformation& tr, const mfem::Vector& ue) {
+            mi.computeGradients(e, tr, ue, it);
+            return true;
+          });
+      return mi.performsBehaviourIntegration(it, nthreads);
+    }
+    return performLoopOverElements(
+        fespace, u, nthreads,
+        [&mi, it](const mfem::FiniteElement& e,
+                  mfem::ElementTransformation& tr, const mfem::Vector& ue) {
+          return mi.integrate(e, tr, ue, it);
+        });
+  }  // end of integrateOverElements
+
+  /*!
+   * \brief build the sparsity pattern of the jacobian matrix and, for each
+   * element, the positions of the entries of the elementary matrix in the
+   * values of the jacobian matrix.
+   * \return the jacobian matrix, finalized and filled with zeros
+   * \param[out] offsets: offsets of the positions associated with each
+   * element
+   * \param[out] positions: positions of the entries of the elementary
+   * matrices, stored in column-major order as the elementary matrices.
+   * \param[in] fespace: finite element space
+   */
+  template <typename FiniteElementSpaceType>
+  static mfem::SparseMatrix* buildScatterMaps(
+      std::vector<std::size_t>& offsets,
+      std::vector<size_type>& positions,
+      const FiniteElementSpaceType& fespace) {
+    const auto ne = fespace.GetNE();
+    auto K = std::make_unique<mfem::SparseMatrix>(fespace.GetVSize());
+    mfem::Array<int> vdofs;
+    mfem::DenseMatrix Ke;
+    offsets.resize(ne + 1);
+    offsets[0] = 0;
+    for (size_type i = 0; i != ne; ++i) {
+      fespace.GetElementVDofs(i, vdofs);
+      for (size_type j = 0; j != vdofs.Size(); ++j) {
+        if (vdofs[j] < 0) {
+          raise(
+              "buildScatterMaps: "
+              "oriented degrees of freedom are not supported");
+        }
+      }
+      // null entries are kept to build the sparsity pattern
+      Ke.SetSize(vdofs.Size());
+      Ke = real{0};
+      K->AddSubMatrix(vdofs, vdofs, Ke, 0);
+      const auto n = static_cast<std::size_t>(vdofs.Size());
+      offsets[i + 1] = offsets[i] + n * n;
+    }
+    K->Finalize(0);
+    K->SortColumnIndices();
+    const auto* const rows = K->GetI();
+    const auto* const columns = K->GetJ();
+    positions.resize(offsets.back());
+    for (size_type i = 0; i != ne; ++i) {
+      fespace.GetElementVDofs(i, vdofs);
+      const auto n = vdofs.Size();
+      auto* const p = positions.data() + offsets[i];
+      for (size_type r = 0; r != n; ++r) {
+        const auto* const b = columns + rows[vdofs[r]];
+        const auto* const e = columns + rows[vdofs[r] + 1];
+        for (size_type c = 0; c != n; ++c) {
+          const auto pos = std::lower_bound(b, e, vdofs[c]);
+          p[r + c * n] = static_cast<size_type>(pos - columns);
+        }
+      }
+    }
+    return K.release();
+  }  // end of buildScatterMaps
+
+  /*!
+   * \brief add an elementary matrix to the values of the jacobian matrix
+   * \param[out] K: values of the jacobian matrix
+   * \param[in] p: positions of the entries of the elementary matrix
+   * \param[in] Ke: elementary matrix
+   */
+  static void scatterElementMatrix(real* const K,
+                                   const size_type* const p,
+                                   const mfem::DenseMatrix& Ke) {
+    const auto* const v = Ke.Data();
+    const auto n = Ke.Height() * Ke.Width();
+    for (size_type i = 0; i != n; ++i) {
+      K[p[i]] += v[i];
+    }
+  }  // end of scatterElementMatrix
+
+  /*!
+   * \brief assemble the residual and the jacobian matrix in a single loop
+   * over the elements.
+   * \param[out] r: residual, not restricted to the true degrees of freedom
+   * \param[out] K: jacobian matrix, not finalized
+   * \param[in] mi: multi-material integrator
+   * \param[in] fespace: finite element space
+   * \param[in] u: current estimate of the unknowns (prolongated)
+   * \param[in] offsets: offsets of the positions associated with each
+   * element. If empty, the elementary matrices are added using the generic
+   * method of the `mfem::SparseMatrix` class.
+   * \param[in] positions: positions of the entries of the elementary
+   * matrices in the values of the jacobian matrix
+   */
+  template <typename FiniteElementSpaceType>
+  static void assembleResidualAndJacobian(
+      mfem::Vector& r,
+      mfem::SparseMatrix& K,
+      MultiMaterialNonLinearIntegrator& mi,
+      const FiniteElementSpaceType& fespace,
+      const mfem::Vector& u,
+      const std::vector<std::size_t>& offsets,
+      const std::vector<size_type>& positions) {
+    mfem::Array<int> vdofs;
+    mfem::Vector ue, Fe;
+    mfem::DenseMatrix Ke;
+    const auto use_scatter_maps = !offsets.empty();
+    r = real{0};
+    for (size_type i = 0; i != fespace.GetNE(); ++i) {
+      const auto& e = *(fespace.GetFE(i));
+      auto& tr = *(fespace.GetElementTransformation(i));
+      fespace.GetElementVDofs(i, vdofs);
+      u.GetSubVector(vdofs, ue);
+      mi.AssembleElementVectorAndGrad(e, tr, ue, Fe, Ke);
+      r.AddElementVector(vdofs, Fe);
+      if (use_scatter_maps) {
+        scatterElementMatrix(K.GetData(), positions.data() + offsets[i], Ke);
+      } else {
+        K.AddSubMatrix(vdofs, vdofs, Ke, 0);
+      }
+    }
+  }  // end of assembleResidualAndJacobian
+
+  /*!
+   * \brief assemble the jacobian matrix using the scatter maps
+   * \param[out] K: jacobian matrix, whose sparsity pattern is described by
+   * the scatter maps
+   * \param[in] mi: multi-material integrator
+   * \param[in] fespace: finite element space
+   * \param[in] u: current estimate of the unknowns (prolongated)
+   * \param[in] offsets: offsets of the positions associated with each
+   * element.
+   * \param[in] positions: positions of the entries of the elementary
+   * matrices in the values of the jacobian matrix
+   */
+  template <typename FiniteElementSpaceType>
+  static void assembleJacobian(mfem::SparseMatrix& K,
+                               MultiMaterialNonLinearIntegrator& mi,
+                               const FiniteElementSpaceType& fespace,
+                               const mfem::Vector& u,
+                               const std::vector<std::size_t>& offsets,
+                               const std::vector<size_type>& positions) {
+    mfem::Array<int> vdofs;
+    mfem::Vector ue;
+    mfem::DenseMatrix Ke;
+    auto* const values = K.GetData();
+    for (size_type i = 0; i != fespace.GetNE(); ++i) {
+      const auto& e = *(fespace.GetFE(i));
+      auto& tr = *(fespace.GetElementTransformation(i));
+      fespace.GetElementVDofs(i, vdofs);
+      u.GetSubVector(vdofs, ue);
+      mi.AssembleElementGrad(e, tr, ue, Ke);
+      scatterElementMatrix(values, positions.data() + offsets[i], Ke);
+    }
+  }  // end of assembleJacobian
+
+  /*!
+   * \brief partition the elements of a finite element space in groups of
+   * elements sharing no degree of freedom using a greedy colouring
+   * algorithm.
+   * \return the groups of elements
+   * \param[in] fespace: finite element space
+   */
+  template <typename FiniteElementSpaceType>
+  static std::vector<std::vector<size_type>> buildElementColours(
+      const FiniteElementSpaceType& fespace) {
+    const auto ne = fespace.GetNE();
+    const auto& element_to_dofs = fespace.GetElementToDofTable();
+    mfem::Table dof_to_elements;
+    mfem::Transpose(element_to_dofs, dof_to_elements);
+    auto colours = std::vector<std::vector<size_type>>{};
+    auto element_colour = std::vector<size_type>(ne, -1);
+    // colours used by the neighbours of the current element are marked by
+    // the index of the current element
+    auto marks = std::vector<size_type>{};
+    for (size_type i = 0; i != ne; ++i) {
+      const auto* const dofs = element_to_dofs.GetRow(i);
+      for (size_type j = 0; j != element_to_dofs.RowSize(i); ++j) {
+        // decoding oriented degrees of freedom
+        const auto d = (dofs[j] >= 0) ? dofs[j] : -1 - dofs[j];
+        const auto* const elts = dof_to_elements.GetRow(d);
+        for (size_type k = 0; k != dof_to_elements.RowSize(d); ++k) {
+          const auto c = element_colour[elts[k]];
+          if (c != -1) {
+            marks[c] = i;
+          }
+        }
+      }
+      const auto pc = std::find_if(marks.begin(), marks.end(),
+                                   [i](const size_type m) { return m != i; });
+      const auto c = static_cast<size_type>(pc - marks.begin());
+      if (pc == marks.end()) {
+        marks.push_back(-1);
+        colours.emplace_back();
+      }
+      element_colour[i] = c;
+      colours[c].push_back(i);
+    }
+    return colours;
+  }  // end of buildElementColours
+
+  /*!
+   * \brief add an elementary vector to a global vector
+   * \param[out] r: values of the global vector
+   * \param[in] vdofs: degrees of freedom of the element
+   * \param[in] Fe: elementary vector
+   */
+  static void addElementVector(real* const r,
+                               const mfem::Array<int>& vdofs,
+                               const mfem::Vector& Fe) {
+    for (size_type i = 0; i != vdofs.Size(); ++i) {
+      const auto d = vdofs[i];
+      if (d >= 0) {
+        r[d] += Fe[i];
+      } else {
+        r[-1 - d] -= Fe[i];
+      }
+    }
+  }  // end of addElementVector
+
 #ifdef MFEM_USE_MPI
 
   NonLinearEvolutionProblemImplementation<true>::
@@ -84,9 +418,112 @@ namespace mfem_mgis {
     }
   }  // end of NonLinearEvolutionProblemImplementation
   
-  void NonLinearEvolutionProblemImplementation<true>::Mult(const mfem::Vector & u, mfem::Vector & r) const{
-    return mfem_mgis::NonlinearForm<true>::Mult(u, r);
-  } // end of Mult
+  bool NonLinearEvolutionProblemImplementation<true>::useFusedAssembly()
+      const {
+    return (this->use_fused_assembly) && (this->mgis_integrator != nullptr) &&
+           (this->dnfi.Size() == 1) && (this->fnfi.Size() == 0) &&
+           (this->bfnfi.Size() == 0);
+  }  // end of useFusedAssembly
+
+  bool NonLinearEvolutionProblemImplementation<true>::useScatterMaps() const {
+    return (this->use_scatter_maps) && (this->mgis_integrator != nullptr) &&
+           (this->dnfi.Size() == 1) && (this->fnfi.Size() == 0) &&
+           (this->bfnfi.Size() == 0);
+  }  // end of useScatterMaps
+
+  bool NonLinearEvolutionProblemImplementation<true>::useMatrixFreeJacobian()
+      const {
+    return (this->use_matrix_free_jacobian) &&
+           (this->mgis_integrator != nullptr) && (this->dnfi.Size() == 1) &&
+           (this->fnfi.Size() == 0) && (this->bfnfi.Size() == 0);
+  }  // end of useMatrixFreeJacobian
+
+  mfem::Operator&
+  NonLinearEvolutionProblemImplementation<true>::getMatrixFreeJacobian(
+      const mfem::Vector& u) const {
+    if (this->matrix_free_jacobian == nullptr) {
+      this->matrix_free_jacobian = std::make_unique<MatrixFreeJacobianOperator>(
+          *(this->mgis_integrator), this->getFiniteElementSpace(), this->P,
+          this->ess_tdof_list);
+    }
+    this->matrix_free_jacobian->setUnknowns(this->Prolongate(u));
+    return *(this->matrix_free_jacobian);
+  }  // end of getMatrixFreeJacobian
+
+  void
+  NonLinearEvolutionProblemImplementation<true>::initializeJacobianMatrix()
+      const {
+    if (!this->useScatterMaps()) {
+      if (this->Grad == nullptr) {
+        this->Grad = new mfem::SparseMatrix(this->fes->GetVSize());
+      } else {
+        *(this->Grad) = real{0};
+      }
+      return;
+    }
+    if (this->scatter_offsets.empty()) {
+      // the sparsity pattern is built once for all
+      delete this->Grad;
+      this->Grad =
+          buildScatterMaps(this->scatter_offsets, this->scatter_positions,
+                           this->getFiniteElementSpace());
+    } else {
+      *(this->Grad) = real{0};
+    }
+  }  // end of initializeJacobianMatrix
+
+  void NonLinearEvolutionProblemImplementation<true>::Mult(
+      const mfem::Vector& u, mfem::Vector& r) const {
+    if ((!this->useFusedAssembly()) || (!this->mustPerformFusedAssembly())) {
+      mfem_mgis::NonlinearForm<true>::Mult(u, r);
+      return;
+    }
+    const auto& pu = this->Prolongate(u);
+    this->initializeJacobianMatrix();
+    this->aux2.SetSize(this->P->Height());
+    assembleResidualAndJacobian(
+        this->aux2, *(this->Grad), *(this->mgis_integrator),
+        this->getFiniteElementSpace(), pu, this->scatter_offsets,
+        this->scatter_positions);
+    this->P->MultTranspose(this->aux2, r);
+    for (size_type i = 0; i != this->ess_tdof_list.Size(); ++i) {
+      r(this->ess_tdof_list[i]) = real{0};
+    }
+    this->fused_assembly_unknowns = u;
+    this->fused_jacobian_available = true;
+  }  // end of Mult
+
+  mfem::Operator& NonLinearEvolutionProblemImplementation<true>::GetGradient(
+      const mfem::Vector& u) const {
+    if (this->useMatrixFreeJacobian()) {
+      return this->getMatrixFreeJacobian(u);
+    }
+    if (!this->isFusedJacobianAvailable(u)) {
+      if (!this->useScatterMaps()) {
+        return mfem_mgis::NonlinearForm<true>::GetGradient(u);
+      }
+      this->initializeJacobianMatrix();
+      assembleJacobian(*(this->Grad), *(this->mgis_integrator),
+                       this->getFiniteElementSpace(), this->Prolongate(u),
+                       this->scatter_offsets, this->scatter_positions);
+    }
+    // the local jacobian matrix has been assembled, either above or by the
+    // last call to the Mult method: only the parallel matrix has to be built.
+    this->fused_jacobian_available = false;
+    const auto& pfes = this->getFiniteElementSpace();
+    this->pGrad.Clear();
+    if (!this->Grad->Finalized()) {
+      this->Grad->Finalize(0);
+    }
+    mfem::OperatorHandle dA(this->pGrad.Type()), Ph(this->pGrad.Type());
+    dA.MakeSquareBlockDiag(pfes.GetComm(), pfes.GlobalVSize(),
+                           pfes.GetDofOffsets(), this->Grad);
+    Ph.ConvertFrom(pfes.Dof_TrueDof_Matrix());
+    this->pGrad.MakePtAP(dA, Ph);
+    mfem::OperatorHandle pGrad_e;
+    pGrad_e.EliminateRowsCols(this->pGrad, this->ess_tdof_list);
+    return *(this->pGrad.Ptr());
+  }  // end of GetGradient
   
   void NonLinearEvolutionProblemImplementation<true>::addPostProcessing(
       std::unique_ptr<PostProcessing<true>> p) {
@@ -143,23 +580,53 @@ namespace mfem_mgis {
     if (this->mgis_integrator == nullptr) {
       return true;
     }
+    // the behaviours are integrated again: the jacobian matrix assembled by
+    // a previous fused assembly is outdated
+    this->fused_jacobian_available = false;
+    this->last_integration_type = it;
     const auto& pu = this->Prolongate(u);
-    const auto& fespace = this->getFiniteElementSpace();
-    mfem::Array<int> vdofs;
-    mfem::Vector ue;
-    bool noerror = true;
-    for (size_type i = 0; noerror && (i != fespace.GetNE()); ++i) {
-      const auto& e = *(fespace.GetFE(i));
-      auto& tr = *(fespace.GetElementTransformation(i));
-      fespace.GetElementVDofs(i, vdofs);
-      pu.GetSubVector(vdofs, ue);
-      noerror = this->mgis_integrator->integrate(e, tr, ue, it);
-    }
+    this->mgis_integrator->resetTimeStepScalingFactor();
+    bool noerror =
+        integrateOverElements(*(this->mgis_integrator),
+                              this->getFiniteElementSpace(), pu, it,
+                              this->number_of_threads,
+                              this->use_batched_behaviour_integration);
     MPI_Allreduce(MPI_IN_PLACE, &noerror, 1, MPI_C_BOOL, MPI_LAND,
                   MPI_COMM_WORLD);
+    this->time_step_scaling_factor =
+        this->mgis_integrator->getTimeStepScalingFactor();
+    MPI_Allreduce(MPI_IN_PLACE, &(this->time_step_scaling_factor), 1,
+                  MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    this->time_step_scaling_factors_histogram =
+        this->mgis_integrator->getTimeStepScalingFactorHistogram();
+    MPI_Allreduce(MPI_IN_PLACE,
+                  this->time_step_scaling_factors_histogram.counts.data(),
+                  TimeStepScalingFactorHistogram::number_of_bins, MPI_INT,
+                  MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(
+        MPI_IN_PLACE,
+        &(this->time_step_scaling_factors_histogram.number_of_failures), 1,
+        MPI_INT, MPI_SUM, MPI_COMM_WORLD);
     return noerror;
   }  // end of integrate
 
+  bool NonLinearEvolutionProblemImplementation<true>::evaluateTrialResidual(
+      mfem::Vector& r, const mfem::Vector& u) {
+    // the time step scaling factor is associated with the accepted
+    // estimates of the unknowns
+    const auto rdt = this->time_step_scaling_factor;
+    const auto rdt_histogram = this->time_step_scaling_factors_histogram;
+    const auto noerror =
+        this->integrate(u, IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR);
+    this->time_step_scaling_factor = rdt;
+    this->time_step_scaling_factors_histogram = rdt_histogram;
+    if (!noerror) {
+      return false;
+    }
+    this->Mult(u, r);
+    return true;
+  }  // end of evaluateTrialResidual
+
   void NonLinearEvolutionProblemImplementation<true>::
       markDegreesOfFreedomHandledByDirichletBoundaryConditions(
           std::vector<size_type> dofs) {
@@ -237,6 +704,270 @@ namespace mfem_mgis {
     return this->fe_discretization->getFiniteElementSpace<false>();
   }  // end of getFiniteElementSpace
 
+  bool NonLinearEvolutionProblemImplementation<false>::useFusedAssembly()
+      const {
+    return (this->use_fused_assembly) && (this->mgis_integrator != nullptr) &&
+           (this->dnfi.Size() == 1) && (this->fnfi.Size() == 0) &&
+           (this->bfnfi.Size() == 0);
+  }  // end of useFusedAssembly
+
+  bool NonLinearEvolutionProblemImplementation<false>::useScatterMaps() const {
+    // the multi-threaded assembly of the jacobian matrix requires the
+    // scatter maps
+    if (this->useMultiThreadedAssembly()) {
+      return true;
+    }
+    return (this->use_scatter_maps) && (this->mgis_integrator != nullptr) &&
+           (this->dnfi.Size() == 1) && (this->fnfi.Size() == 0) &&
+           (this->bfnfi.Size() == 0);
+  }  // end of useScatterMaps
+
+  bool NonLinearEvolutionProblemImplementation<false>::useMatrixFreeJacobian()
+      const {
+    return (this->use_matrix_free_jacobian) &&
+           (this->mgis_integrator != nullptr) && (this->dnfi.Size() == 1) &&
+           (this->fnfi.Size() == 0) && (this->bfnfi.Size() == 0);
+  }  // end of useMatrixFreeJacobian
+
+  mfem::Operator&
+  NonLinearEvolutionProblemImplementation<false>::getMatrixFreeJacobian(
+      const mfem::Vector& u) const {
+    if (this->matrix_free_jacobian == nullptr) {
+      this->matrix_free_jacobian = std::make_unique<MatrixFreeJacobianOperator>(
+          *(this->mgis_integrator), this->getFiniteElementSpace(), this->P,
+          this->ess_tdof_list);
+    }
+    this->matrix_free_jacobian->setUnknowns(this->Prolongate(u));
+    return *(this->matrix_free_jacobian);
+  }  // end of getMatrixFreeJacobian
+
+  bool NonLinearEvolutionProblemImplementation<
+      false>::useMultiThreadedAssembly() const {
+    return (this->number_of_threads > 1) &&
+           (this->multi_threaded_assembly !=
+            MultiThreadedAssemblyStrategy::NONE) &&
+           (this->mgis_integrator != nullptr) && (this->dnfi.Size() == 1) &&
+           (this->fnfi.Size() == 0) && (this->bfnfi.Size() == 0);
+  }  // end of useMultiThreadedAssembly
+
+  void NonLinearEvolutionProblemImplementation<false>::assembleUsingThreads(
+      mfem::Vector* const r,
+      mfem::SparseMatrix* const K,
+      const mfem::Vector& u) const {
+#ifdef _OPENMP
+    const auto& fespace = this->getFiniteElementSpace();
+    auto& mesh = *(fespace.GetMesh());
+    auto& mi = *(this->mgis_integrator);
+    const auto ne = fespace.GetNE();
+    const auto n =
+        std::min(this->number_of_threads, getMaximumNumberOfThreads());
+    const auto rsize = static_cast<std::size_t>((r != nullptr) ? r->Size() : 0);
+    const auto ksize =
+        static_cast<std::size_t>((K != nullptr) ? K->NumNonZeroElems() : 0);
+    const auto use_colours = this->multi_threaded_assembly ==
+                             MultiThreadedAssemblyStrategy::ELEMENT_COLOURING;
+    if (use_colours) {
+      if (this->element_colours.empty()) {
+        this->element_colours = buildElementColours(fespace);
+      }
+    } else {
+      this->assembly_buffers.resize(n);
+      for (auto& b : this->assembly_buffers) {
+        b.resize(rsize + ksize);
+      }
+    }
+    if (r != nullptr) {
+      *r = real{0};
+    }
+    // exceptions can't be propagated outside a parallel region
+    auto error = std::exception_ptr{};
+#pragma omp parallel num_threads(n)
+    {
+      mfem::Array<int> vdofs;
+      mfem::Vector ue, Fe;
+      mfem::DenseMatrix Ke;
+      mfem::IsoparametricTransformation tr;
+      // assembly of one element in the given arrays
+      auto assemble = [&](const size_type i, real* const lr, real* const lK) {
+        try {
+          const auto& e = *(fespace.GetFE(i));
+          mesh.GetElementTransformation(i, &tr);
+          fespace.GetElementVDofs(i, vdofs);
+          u.GetSubVector(vdofs, ue);
+          if ((r != nullptr) && (K != nullptr)) {
+            mi.AssembleElementVectorAndGrad(e, tr, ue, Fe, Ke);
+          } else if (r != nullptr) {
+            mi.AssembleElementVector(e, tr, ue, Fe);
+          } else {
+            mi.AssembleElementGrad(e, tr, ue, Ke);
+          }
+          if (r != nullptr) {
+            addElementVector(lr, vdofs, Fe);
+          }
+          if (K != nullptr) {
+            const auto* const p = this->scatter_positions.data() +
+                                  this->scatter_offsets[i];
+            scatterElementMatrix(lK, p, Ke);
+          }
+        } catch (...) {
+#pragma omp critical
+          {
+            if (!error) {
+              error = std::current_exception();
+            }
+          }
+        }
+      };
+      auto* const gr = (r != nullptr) ? r->GetData() : nullptr;
+      auto* const gK = (K != nullptr) ? K->GetData() : nullptr;
+      if (use_colours) {
+        // the elements of a colour share no degree of freedom and can be
+        // assembled directly in the global arrays
+        for (const auto& c : this->element_colours) {
+          const auto nc = static_cast<size_type>(c.size());
+#pragma omp for schedule(dynamic, 16)
+          for (size_type j = 0; j < nc; ++j) {
+            assemble(c[j], gr, gK);
+          }
+        }
+      } else {
+        const auto nb = static_cast<size_type>(this->assembly_buffers.size());
+#pragma omp for schedule(static)
+        for (size_type t = 0; t < nb; ++t) {
+          auto& b = this->assembly_buffers[t];
+          std::fill(b.begin(), b.end(), real{0});
+        }
+        auto& b = this->assembly_buffers[getThreadIdentifier()];
+#pragma omp for schedule(dynamic, 64)
+        for (size_type i = 0; i < ne; ++i) {
+          assemble(i, b.data(), b.data() + rsize);
+        }
+        // summation of the private buffers
+        const auto ntotal = static_cast<std::ptrdiff_t>(rsize + ksize);
+#pragma omp for schedule(static)
+        for (std::ptrdiff_t k = 0; k < ntotal; ++k) {
+          auto v = real{0};
+          for (const auto& lb : this->assembly_buffers) {
+            v += lb[k];
+          }
+          const auto uk = static_cast<std::size_t>(k);
+          if (uk < rsize) {
+            gr[uk] = v;
+          } else {
+            gK[uk - rsize] += v;
+          }
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+#else  /* _OPENMP */
+    static_cast<void>(r);
+    static_cast<void>(K);
+    static_cast<void>(u);
+    raise(
+        "NonLinearEvolutionProblemImplementation<false>::"
+        "assembleUsingThreads: support for OpenMP has not been enabled");
+#endif /* _OPENMP */
+  }  // end of assembleUsingThreads
+
+  void
+  NonLinearEvolutionProblemImplementation<false>::initializeJacobianMatrix()
+      const {
+    if (!this->useScatterMaps()) {
+      if (this->Grad == nullptr) {
+        this->Grad = new mfem::SparseMatrix(this->fes->GetVSize());
+      } else {
+        *(this->Grad) = real{0};
+      }
+      return;
+    }
+    if (this->scatter_offsets.empty()) {
+      // the sparsity pattern is built once for all
+      delete this->Grad;
+      this->Grad =
+          buildScatterMaps(this->scatter_offsets, this->scatter_positions,
+                           this->getFiniteElementSpace());
+    } else {
+      *(this->Grad) = real{0};
+    }
+  }  // end of initializeJacobianMatrix
+
+  void NonLinearEvolutionProblemImplementation<false>::Mult(
+      const mfem::Vector& u, mfem::Vector& r) const {
+    const auto fused =
+        (this->useFusedAssembly()) && (this->mustPerformFusedAssembly());
+    if ((!fused) && (!this->useMultiThreadedAssembly())) {
+      mfem_mgis::NonlinearForm<false>::Mult(u, r);
+      return;
+    }
+    const auto& pu = this->Prolongate(u);
+    if (fused) {
+      this->initializeJacobianMatrix();
+    }
+    // conforming prolongation, only defined for non-conforming meshes
+    if (this->P != nullptr) {
+      this->aux2.SetSize(this->P->Height());
+    }
+    auto& pr = (this->P != nullptr) ? this->aux2 : r;
+    if (this->useMultiThreadedAssembly()) {
+      this->assembleUsingThreads(&pr, fused ? this->Grad : nullptr, pu);
+    } else {
+      assembleResidualAndJacobian(
+          pr, *(this->Grad), *(this->mgis_integrator),
+          this->getFiniteElementSpace(), pu, this->scatter_offsets,
+          this->scatter_positions);
+    }
+    if (this->P != nullptr) {
+      this->P->MultTranspose(pr, r);
+    }
+    for (size_type i = 0; i != this->ess_tdof_list.Size(); ++i) {
+      r(this->ess_tdof_list[i]) = real{0};
+    }
+    if (fused) {
+      this->fused_assembly_unknowns = u;
+      this->fused_jacobian_available = true;
+    }
+  }  // end of Mult
+
+  mfem::Operator& NonLinearEvolutionProblemImplementation<false>::GetGradient(
+      const mfem::Vector& u) const {
+    if (this->useMatrixFreeJacobian()) {
+      return this->getMatrixFreeJacobian(u);
+    }
+    if (!this->isFusedJacobianAvailable(u)) {
+      if (!this->useScatterMaps()) {
+        return mfem_mgis::NonlinearForm<false>::GetGradient(u);
+      }
+      this->initializeJacobianMatrix();
+      if (this->useMultiThreadedAssembly()) {
+        this->assembleUsingThreads(nullptr, this->Grad, this->Prolongate(u));
+      } else {
+        assembleJacobian(*(this->Grad), *(this->mgis_integrator),
+                         this->getFiniteElementSpace(), this->Prolongate(u),
+                         this->scatter_offsets, this->scatter_positions);
+      }
+    }
+    // the jacobian matrix has been assembled, either above or by the last
+    // call to the Mult method: only the boundary conditions have to be taken
+    // into account.
+    this->fused_jacobian_available = false;
+    if (!this->Grad->Finalized()) {
+      this->Grad->Finalize(0);
+    }
+    auto* K = this->Grad;
+    if (this->cP != nullptr) {
+      delete this->cGrad;
+      this->cGrad = mfem::RAP(*(this->cP), *(this->Grad), *(this->cP));
+      K = this->cGrad;
+    }
+    for (size_type i = 0; i != this->ess_tdof_list.Size(); ++i) {
+      K->EliminateRowCol(this->ess_tdof_list[i]);
+    }
+    return *K;
+  }  // end of GetGradient
+
   void NonLinearEvolutionProblemImplementation<false>::setLinearSolver(
       std::string_view n, const Parameters& p) {
     const auto& f = LinearSolverFactory<false>::getFactory();
@@ -248,21 +979,40 @@ namespace mfem_mgis {
     if (this->mgis_integrator == nullptr) {
       return true;
     }
+    // the behaviours are integrated again: the jacobian matrix assembled by
+    // a previous fused assembly is outdated
+    this->fused_jacobian_available = false;
+    this->last_integration_type = it;
     const auto& pu = this->Prolongate(u);
-    const auto& fespace = this->getFiniteElementSpace();
-    mfem::Array<int> vdofs;
-    mfem::Vector ue;
-    for (size_type i = 0; i != fespace.GetNE(); ++i) {
-      const auto& e = *(fespace.GetFE(i));
-      auto& tr = *(fespace.GetElementTransformation(i));
-      fespace.GetElementVDofs(i, vdofs);
-      pu.GetSubVector(vdofs, ue);
-      if (!this->mgis_integrator->integrate(e, tr, ue, it)) {
-        return false;
-      }
+    this->mgis_integrator->resetTimeStepScalingFactor();
+    const auto noerror =
+        integrateOverElements(*(this->mgis_integrator),
+                              this->getFiniteElementSpace(), pu, it,
+                              this->number_of_threads,
+                              this->use_batched_behaviour_integration);
+    this->time_step_scaling_factor =
+        this->mgis_integrator->getTimeStepScalingFactor();
+    this->time_step_scaling_factors_histogram =
+        this->mgis_integrator->getTimeStepScalingFactorHistogram();
+    return noerror;
+  }  // end of integrate
+
+  bool NonLinearEvolutionProblemImplementation<false>::evaluateTrialResidual(
+      mfem::Vector& r, const mfem::Vector& u) {
+    // the time step scaling factor is associated with the accepted
+    // estimates of the unknowns
+    const auto rdt = this->time_step_scaling_factor;
+    const auto rdt_histogram = this->time_step_scaling_factors_histogram;
+    const auto noerror =
+        this->integrate(u, IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR);
+    this->time_step_scaling_factor = rdt;
+    this->time_step_scaling_factors_histogram = rdt_histogram;
+    if (!noerror) {
+      return false;
     }
+    this->Mult(u, r);
     return true;
-  }  // end of integrate
+  }  // end of evaluateTrialResidual
 
   void NonLinearEvolutionProblemImplementation<false>::
       markDegreesOfFreedomHandledByDirichletBoundaryConditions(
@@ -7,15 +7,18 @@
 
 #include <iostream>
 #include <utility>
+#include <algorithm>
 #include "MGIS/Raise.hxx"
 #include "MFEMMGIS/Parameters.hxx"
 #include "MFEMMGIS/NewtonSolver.hxx"
+#include "MFEMMGIS/Material.hxx"
 #include "MFEMMGIS/IntegrationType.hxx"
 #include "MFEMMGIS/SolverUtilities.hxx"
 #include "MFEMMGIS/DirichletBoundaryCondition.hxx"
 #include "MFEMMGIS/FiniteElementDiscretization.hxx"
 #include "MFEMMGIS/MultiMaterialNonLinearIntegrator.hxx"
 #include "MFEMMGIS/LinearSolverFactory.hxx"
+#include "MFEMMGIS/MatrixFreeJacobianOperator.hxx"
 #include "MFEMMGIS/NonLinearEvolutionProblemImplementationBase.hxx"
 
 namespace mfem_mgis {
@@ -24,10 +27,53 @@ namespace mfem_mgis {
       UseMultiMaterialNonLinearIntegrator =
           "UseMultiMaterialNonLinearIntegrator";
 
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      NumberOfThreads = "NumberOfThreads";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      UseBatchedBehaviourIntegration = "UseBatchedBehaviourIntegration";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      UseGeometricCache = "UseGeometricCache";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      UseFusedAssembly = "UseFusedAssembly";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      UseScatterMaps = "UseScatterMaps";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      MultiThreadedAssembly = "MultiThreadedAssembly";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      UseMatrixFreeJacobian = "UseMatrixFreeJacobian";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      NumberOfLocalSubsteppingLevels = "NumberOfLocalSubsteppingLevels";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      UseSymmetricStiffnessMatrixKernel = "UseSymmetricStiffnessMatrixKernel";
+
+  const char* const NonLinearEvolutionProblemImplementationBase::
+      UseVectorisedKernels = "UseVectorisedKernels";
+
   std::vector<std::string>
   NonLinearEvolutionProblemImplementationBase::getParametersList() {
     return {NonLinearEvolutionProblemImplementationBase::
-                UseMultiMaterialNonLinearIntegrator};
+                UseMultiMaterialNonLinearIntegrator,
+            NonLinearEvolutionProblemImplementationBase::NumberOfThreads,
+            NonLinearEvolutionProblemImplementationBase::
+                UseBatchedBehaviourIntegration,
+            NonLinearEvolutionProblemImplementationBase::UseGeometricCache,
+            NonLinearEvolutionProblemImplementationBase::UseFusedAssembly,
+            NonLinearEvolutionProblemImplementationBase::UseScatterMaps,
+            NonLinearEvolutionProblemImplementationBase::MultiThreadedAssembly,
+            NonLinearEvolutionProblemImplementationBase::UseMatrixFreeJacobian,
+            NonLinearEvolutionProblemImplementationBase::
+                NumberOfLocalSubsteppingLevels,
+            NonLinearEvolutionProblemImplementationBase::
+                UseSymmetricStiffnessMatrixKernel,
+            NonLinearEvolutionProblemImplementationBase::UseVectorisedKernels};
   }  // end of getParametersList
 
   MultiMaterialNonLinearIntegrator* buildMultiMaterialNonLinearIntegrator(
@@ -44,6 +90,49 @@ namespace mfem_mgis {
     return new MultiMaterialNonLinearIntegrator(fed, h);
   }  // end of buildMultiMaterialNonLinearIntegrator
 
+  static size_type getNumberOfThreads(const Parameters& p) {
+    const auto* const n =
+        NonLinearEvolutionProblemImplementationBase::NumberOfThreads;
+    if (!contains(p, n)) {
+      return 1;
+    }
+    const auto nthreads = get<int>(p, n);
+    if (nthreads < 1) {
+      raise(
+          "NonLinearEvolutionProblemImplementationBase::"
+          "NonLinearEvolutionProblemImplementationBase: "
+          "invalid number of threads");
+    }
+#if !(defined _OPENMP && defined MFEM_THREAD_SAFE)
+    // the evaluation of the shape functions by MFEM is only reentrant if
+    // MFEM has been compiled with the `MFEM_THREAD_SAFE` option.
+    if (nthreads != 1) {
+      raise(
+          "NonLinearEvolutionProblemImplementationBase::"
+          "NonLinearEvolutionProblemImplementationBase: "
+          "multi-threaded integration requires the support of OpenMP "
+          "and a thread safe version of MFEM");
+    }
+#endif /* !(defined _OPENMP && defined MFEM_THREAD_SAFE) */
+    return nthreads;
+  }  // end of getNumberOfThreads
+
+  static size_type getNumberOfLocalSubsteppingLevels(const Parameters& p) {
+    const auto* const n = NonLinearEvolutionProblemImplementationBase::
+        NumberOfLocalSubsteppingLevels;
+    if (!contains(p, n)) {
+      return 0;
+    }
+    const auto nlevels = get<int>(p, n);
+    if (nlevels < 0) {
+      raise(
+          "NonLinearEvolutionProblemImplementationBase::"
+          "NonLinearEvolutionProblemImplementationBase: "
+          "invalid number of levels of the local substepping");
+    }
+    return nlevels;
+  }  // end of getNumberOfLocalSubsteppingLevels
+
   NonLinearEvolutionProblemImplementationBase::
       NonLinearEvolutionProblemImplementationBase(
           std::shared_ptr<FiniteElementDiscretization> fed,
@@ -53,7 +142,81 @@ namespace mfem_mgis {
         u0(getTrueVSize(*fed)),
         u1(getTrueVSize(*fed)),
         mgis_integrator(buildMultiMaterialNonLinearIntegrator(fed, h, p)),
-        hypothesis(h) {
+        hypothesis(h),
+        number_of_threads(getNumberOfThreads(p)),
+        use_batched_behaviour_integration(get_if<bool>(
+            p,
+            NonLinearEvolutionProblemImplementationBase::
+                UseBatchedBehaviourIntegration,
+            false)),
+        use_geometric_cache(get_if<bool>(
+            p,
+            NonLinearEvolutionProblemImplementationBase::UseGeometricCache,
+            false)),
+        use_fused_assembly(get_if<bool>(
+            p,
+            NonLinearEvolutionProblemImplementationBase::UseFusedAssembly,
+            false)),
+        use_scatter_maps(get_if<bool>(
+            p,
+            NonLinearEvolutionProblemImplementationBase::UseScatterMaps,
+            false)),
+        use_matrix_free_jacobian(get_if<bool>(
+            p,
+            NonLinearEvolutionProblemImplementationBase::UseMatrixFreeJacobian,
+            false)),
+        number_of_local_substepping_levels(
+            getNumberOfLocalSubsteppingLevels(p)),
+        use_symmetric_stiffness_matrix_kernel(
+            get_if<bool>(p,
+                         NonLinearEvolutionProblemImplementationBase::
+                             UseSymmetricStiffnessMatrixKernel,
+                         true)),
+        use_vectorised_kernels(get_if<bool>(
+            p,
+            NonLinearEvolutionProblemImplementationBase::UseVectorisedKernels,
+            true)) {
+    if ((this->use_fused_assembly) && (usePETSc())) {
+      raise(
+          "NonLinearEvolutionProblemImplementationBase::"
+          "NonLinearEvolutionProblemImplementationBase: "
+          "the fused assembly is not supported when PETSc is used");
+    }
+    if (this->use_matrix_free_jacobian) {
+      if (usePETSc()) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::"
+            "NonLinearEvolutionProblemImplementationBase: "
+            "the matrix-free jacobian is not supported when PETSc is used");
+      }
+      if (this->use_fused_assembly) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::"
+            "NonLinearEvolutionProblemImplementationBase: "
+            "the matrix-free jacobian is not compatible with the fused "
+            "assembly");
+      }
+    }
+    const auto* const mta =
+        NonLinearEvolutionProblemImplementationBase::MultiThreadedAssembly;
+    if (contains(p, mta)) {
+      const auto s = get<std::string>(p, mta);
+      if (s == "ElementColouring") {
+        this->multi_threaded_assembly =
+            MultiThreadedAssemblyStrategy::ELEMENT_COLOURING;
+      } else if (s == "PrivateBuffers") {
+        this->multi_threaded_assembly =
+            MultiThreadedAssemblyStrategy::PRIVATE_BUFFERS;
+      } else if (s == "None") {
+        this->multi_threaded_assembly = MultiThreadedAssemblyStrategy::NONE;
+      } else {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::"
+            "NonLinearEvolutionProblemImplementationBase: "
+            "invalid multi-threaded assembly strategy '" +
+            s + "'");
+      }
+    }
     this->u0 = real{0};
     this->u1 = real{0};
   }  // end of NonLinearEvolutionProblemImplementationBase
@@ -110,6 +273,48 @@ namespace mfem_mgis {
     }
   }  // end of update
 
+  void NonLinearEvolutionProblemImplementationBase::pushSnapshot() {
+    if (this->number_of_snapshots ==
+        static_cast<size_type>(this->unknowns_snapshots.size())) {
+      this->unknowns_snapshots.emplace_back();
+    }
+    this->unknowns_snapshots[this->number_of_snapshots] = this->u0;
+    ++(this->number_of_snapshots);
+    if (this->mgis_integrator != nullptr) {
+      this->mgis_integrator->pushStateSnapshot();
+    }
+  }  // end of pushSnapshot
+
+  void NonLinearEvolutionProblemImplementationBase::restoreSnapshot() {
+    if (this->number_of_snapshots == 0) {
+      raise(
+          "NonLinearEvolutionProblemImplementationBase::restoreSnapshot: "
+          "no snapshot defined");
+    }
+    this->u0 = this->unknowns_snapshots[this->number_of_snapshots - 1];
+    this->u1 = this->u0;
+    if (this->mgis_integrator != nullptr) {
+      this->mgis_integrator->restoreStateSnapshot();
+    }
+  }  // end of restoreSnapshot
+
+  void NonLinearEvolutionProblemImplementationBase::popSnapshot() {
+    if (this->number_of_snapshots == 0) {
+      raise(
+          "NonLinearEvolutionProblemImplementationBase::popSnapshot: "
+          "no snapshot defined");
+    }
+    --(this->number_of_snapshots);
+    if (this->mgis_integrator != nullptr) {
+      this->mgis_integrator->popStateSnapshot();
+    }
+  }  // end of popSnapshot
+
+  size_type NonLinearEvolutionProblemImplementationBase::getNumberOfSnapshots()
+      const {
+    return this->number_of_snapshots;
+  }  // end of getNumberOfSnapshots
+
   static void checkMultiMaterialSupportEnabled(
       const char* const n, const MultiMaterialNonLinearIntegrator* const p) {
     if (p == nullptr) {
@@ -168,6 +373,19 @@ namespace mfem_mgis {
                                      this->mgis_integrator);
     for (const auto& id : this->getMaterialsIdentifiers(m)) {
       this->mgis_integrator->addBehaviourIntegrator(n, id, l, b);
+      if (this->number_of_local_substepping_levels > 0) {
+        this->mgis_integrator->getBehaviourIntegrator(id)
+            .setNumberOfLocalSubsteppingLevels(
+                this->number_of_local_substepping_levels);
+      }
+      if (!this->use_symmetric_stiffness_matrix_kernel) {
+        this->mgis_integrator->getBehaviourIntegrator(id)
+            .setSymmetricStiffnessMatrixKernelUsage(false);
+      }
+      if (!this->use_vectorised_kernels) {
+        this->mgis_integrator->getBehaviourIntegrator(id)
+            .setVectorisedKernelsUsage(false);
+      }
     }
   }  // end of addBehaviourIntegrator
 
@@ -213,16 +431,95 @@ namespace mfem_mgis {
     this->mgis_integrator->setMacroscopicGradients(g);
   }  // end of setMacroscopicGradients
 
+  /*!
+   * \return the integration type associated with a prediction policy, or an
+   * empty value if no prediction shall be made.
+   * \param[in] p: prediction policy
+   */
+  static std::optional<IntegrationType> getPredictionType(
+      const std::string& p) {
+    if (p == "None") {
+      return {};
+    } else if (p == "ElasticOperator") {
+      return IntegrationType::PREDICTION_ELASTIC_OPERATOR;
+    } else if (p == "SecantOperator") {
+      return IntegrationType::PREDICTION_SECANT_OPERATOR;
+    } else if (p != "TangentOperator") {
+      raise("getPredictionType: invalid prediction policy '" + p + "'");
+    }
+    return IntegrationType::PREDICTION_TANGENT_OPERATOR;
+  }  // end of getPredictionType
+
   void NonLinearEvolutionProblemImplementationBase::setSolverParameters(
       const Parameters& params) {
+    using Problem = AbstractNonLinearEvolutionProblem;
+    auto names = getIterativeSolverParametersList();
+    names.push_back(Problem::SolverPredictionPolicy);
+    for (const auto& n : NewtonSolver::getParametersList()) {
+      names.push_back(n);
+    }
+    checkParameters(params, names);
+    if (contains(params, Problem::SolverPredictionPolicy)) {
+      this->prediction_type = getPredictionType(
+          get<std::string>(params, Problem::SolverPredictionPolicy));
+      if ((this->prediction_type.has_value()) && (usePETSc())) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::setSolverParameters: "
+            "predictions are not supported when PETSc is used");
+      }
+    }
+    const auto nparams = extract(params, NewtonSolver::getParametersList());
+    if (nparams.begin() != nparams.end()) {
+      if (usePETSc()) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::setSolverParameters: "
+            "the parameters of the Newton solver can't be changed when "
+            "PETSc is used");
+      }
+      if ((this->use_fused_assembly) &&
+          (contains(nparams, NewtonSolver::JacobianUpdatePolicy)) &&
+          (get<std::string>(nparams, NewtonSolver::JacobianUpdatePolicy) !=
+           "EveryIteration")) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::setSolverParameters: "
+            "reusing the jacobian matrix is not supported by the fused "
+            "assembly");
+      }
+      if ((this->use_matrix_free_jacobian) &&
+          (contains(nparams, NewtonSolver::JacobianUpdatePolicy)) &&
+          (get<std::string>(nparams, NewtonSolver::JacobianUpdatePolicy) !=
+           "EveryIteration")) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::setSolverParameters: "
+            "reusing the jacobian is not supported by the matrix-free "
+            "jacobian");
+      }
+      if ((this->use_matrix_free_jacobian) &&
+          (contains(nparams, NewtonSolver::LineSearch)) &&
+          (get<std::string>(nparams, NewtonSolver::LineSearch) != "None")) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::setSolverParameters: "
+            "line searches are not supported by the matrix-free jacobian");
+      }
+      if (((this->use_fused_assembly) || (this->use_matrix_free_jacobian)) &&
+          (contains(nparams, NewtonSolver::JacobianFreeNewtonKrylov)) &&
+          (get<bool>(nparams, NewtonSolver::JacobianFreeNewtonKrylov))) {
+        raise(
+            "NonLinearEvolutionProblemImplementationBase::setSolverParameters: "
+            "the jacobian-free Newton-Krylov mode is not supported by the "
+            "fused assembly nor by the matrix-free jacobian");
+      }
+      this->solver->setParameters(nparams);
+    }
+    const auto iparams = extract(params, getIterativeSolverParametersList());
 #ifdef MFEM_USE_PETSC
     if (usePETSc()) {
-      mfem_mgis::setSolverParameters(*(this->petsc_solver), params);
+      mfem_mgis::setSolverParameters(*(this->petsc_solver), iparams);
     } else {
-      mfem_mgis::setSolverParameters(*(this->solver), params);
+      mfem_mgis::setSolverParameters(*(this->solver), iparams);
     }
 #else  /* MFEM_USE_PETSC */
-    mfem_mgis::setSolverParameters(*(this->solver), params);
+    mfem_mgis::setSolverParameters(*(this->solver), iparams);
 #endif /* MFEM_USE_PETSC */
   }  // end of setSolverParameters
 
@@ -237,6 +534,23 @@ namespace mfem_mgis {
     return ddofs;
   }  // end of getEssentialDegreesOfFreedom
 
+  bool NonLinearEvolutionProblemImplementationBase::isFusedJacobianAvailable(
+      const mfem::Vector& u) const {
+    if ((!this->fused_jacobian_available) ||
+        (u.Size() != this->fused_assembly_unknowns.Size())) {
+      return false;
+    }
+    return std::equal(u.GetData(), u.GetData() + u.Size(),
+                      this->fused_assembly_unknowns.GetData());
+  }  // end of isFusedJacobianAvailable
+
+  bool NonLinearEvolutionProblemImplementationBase::mustPerformFusedAssembly()
+      const {
+    return (this->use_fused_assembly) &&
+           (this->last_integration_type !=
+            IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR);
+  }  // end of mustPerformFusedAssembly
+
   void NonLinearEvolutionProblemImplementationBase::setup(const real t,
                                                           const real dt) {
     if (this->initialization_phase) {
@@ -250,6 +564,10 @@ namespace mfem_mgis {
       bc->updateImposedValues(this->u1, t + dt);
     }
     if (this->mgis_integrator != nullptr) {
+      if (this->use_geometric_cache) {
+        // this does nothing if the caches have already been built
+        this->mgis_integrator->buildGeometricCaches();
+      }
       this->mgis_integrator->setup(t, dt);
     }
   }  // end of setup
@@ -301,7 +619,9 @@ namespace mfem_mgis {
       const real t, const real dt) {
     this->setTimeIncrement(dt);
     this->setup(t, dt);
-    //    this->computePrediction(t, dt);
+    this->time_step_scaling_factor = real{1};
+    this->time_step_scaling_factors_histogram.reset();
+    this->computePrediction(t, dt);
     NonLinearResolutionOutput output;
     auto file_output = [&output](const auto& s) {
       output.status = s.GetConverged();
@@ -322,40 +642,80 @@ namespace mfem_mgis {
       this->solver->Mult(this->u0, this->u1);
       file_output(*(this->solver));
       output.initial_residual_norm = this->solver->GetInitialNorm();
+      output.linear_solver_iterations =
+          this->solver->getNumberOfLinearSolverIterations();
+      output.estimated_saved_linear_solver_iterations =
+          this->solver->getEstimatedNumberOfSavedLinearSolverIterations();
     }
+    output.time_step_scaling_factor = this->time_step_scaling_factor;
+    output.time_step_scaling_factors_histogram =
+        this->time_step_scaling_factors_histogram;
     return output;
   }  // end of solve
 
-  void NonLinearEvolutionProblemImplementationBase::computePrediction(const real /*t*/, const real /*dt*/) {
-    // if (mgis_integrator == nullptr) {
-    //   return;
-    // }
-    // constexpr auto it = IntegrationType::PREDICTION_ELASTIC_OPERATOR;
-    // if (!this->integrate(this->u0, it)) {
-    //   return;
-    // }
-    // mfem::Vector du(this->u1.Size());
-    // mfem::Vector r(this->u1.Size());
-    // r = 0.;
-    // du = 0.;
-    // //
-    // // unmarked Dirichlet boundary conditions
-    // const auto ddofs = this->getEssentialDegreesOfFreedom();
-    // this->markDegreesOfFreedomHandledByDirichletBoundaryConditions({});
-    // auto& K = this->solver->getJacobian(this->u0);
-    // for (const auto& bc : this->dirichlet_boundary_conditions) {
-    //   bc->setImposedValuesIncrements(du, t, t + dt);
-    // }
-
-    // // solve the tangent problem
-    // this->markDegreesOfFreedomHandledByDirichletBoundaryConditions(ddofs);
-    // for (const auto& bc : this->dirichlet_boundary_conditions) {
-    //   bc->setImposedValuesIncrements(r, t, t + dt);
-    // }
-    // if (this->solver->computeNewtonCorrection(du, r, this->u0)) {
-    //   this->u1 = this->u0;
-    //   this->u1 += du;
-    // }
+  /*!
+   * \brief set the thermodynamic forces at the end of the time step to their
+   * values at the beginning of the time step for all the materials.
+   * \param[in] mi: multi-material integrator
+   */
+  static void resetEndOfTimeStepThermodynamicForces(
+      MultiMaterialNonLinearIntegrator& mi) {
+    for (const auto& id : mi.getAssignedMaterialsIdentifiers()) {
+      auto& m = mi.getMaterial(id);
+      const auto& t0 = m.s0.thermodynamic_forces;
+      auto& t1 = m.s1.thermodynamic_forces;
+      if (t0.data() != t1.data()) {
+        std::copy(t0.begin(), t0.end(), t1.begin());
+      }
+    }
+  }  // end of resetEndOfTimeStepThermodynamicForces
+
+  void NonLinearEvolutionProblemImplementationBase::computePrediction(
+      const real t, const real dt) {
+    if ((this->mgis_integrator == nullptr) ||
+        (!this->prediction_type.has_value())) {
+      return;
+    }
+    if (!this->integrate(this->u0, *(this->prediction_type))) {
+      return;
+    }
+    const auto n = this->u0.Size();
+    // increments of the imposed values
+    mfem::Vector du(n);
+    du = real{0};
+    for (const auto& bc : this->dirichlet_boundary_conditions) {
+      bc->setImposedValuesIncrements(du, t, t + dt);
+    }
+    // the integration of the behaviours with a prediction type does not
+    // compute the thermodynamic forces: the residual of the linearized
+    // problem must be assembled from their values at the beginning of the
+    // time step.
+    resetEndOfTimeStepThermodynamicForces(*(this->mgis_integrator));
+    // residual of the linearized problem: the Dirichlet boundary conditions
+    // are temporarily unmarked so that the coupling between the imposed
+    // degrees of freedom and the other ones are taken into account
+    const auto ddofs = this->getEssentialDegreesOfFreedom();
+    this->markDegreesOfFreedomHandledByDirichletBoundaryConditions({});
+    mfem::Vector r(n);
+    mfem::Vector Kdu(n);
+    this->solver->computeResidual(r, this->u0);
+    this->solver->getJacobian(this->u0).Mult(du, Kdu);
+    r += Kdu;
+    this->markDegreesOfFreedomHandledByDirichletBoundaryConditions(ddofs);
+    for (const auto& dof : ddofs) {
+      r[dof] = real{0};
+    }
+    // solve the linearized problem. The jacobian-free Newton-Krylov method,
+    // if enabled, can't be used here since r is not the residual of the
+    // non linear problem at u0.
+    mfem::Vector c(n);
+    c = real{0};
+    if (!this->solver->solveLinearisedProblem(c, r, this->u0)) {
+      return;
+    }
+    this->u1 = this->u0;
+    this->u1 += du;
+    this->u1 -= c;
   }  // end of computePrediction
 
   NonLinearEvolutionProblemImplementationBase::
@@ -91,7 +91,7 @@ namespace mfem_mgis {
       RotationMatrix
       OrthotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
           getRotationMatrix(const size_type i) const {
-    return this->get_rotation_fct_ptr(this->r2D, this->r3D, i);
+    return Material::getRotationMatrix(i);
   }  // end of getRotationMatrix
 
   void
@@ -172,6 +172,19 @@ namespace mfem_mgis {
     return this->implementIntegrate(e, tr, u, it);
   }  // end of integrate
 
+  void OrthotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::computeGradients(
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u,
+      const IntegrationType it) {
+    this->implementComputeGradients(e, tr, u, it);
+  }  // end of computeGradients
+
+  bool OrthotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::performsBehaviourIntegration(
+      const IntegrationType it, const size_type nthreads) {
+    return this->implementPerformsBehaviourIntegration(it, nthreads);
+  }  // end of performsBehaviourIntegration
+
   void
   OrthotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
       updateResidual(mfem::Vector &Fe,
@@ -190,6 +203,24 @@ namespace mfem_mgis {
     this->implementUpdateJacobian(Ke, e, tr);
   }  // end of updateJacobian
 
+  void OrthotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
+      updateResidualAndJacobian(mfem::Vector &Fe,
+                                mfem::DenseMatrix &Ke,
+                                const mfem::FiniteElement &e,
+                                mfem::ElementTransformation &tr,
+                                const mfem::Vector &) {
+    this->implementUpdateResidualAndJacobian(Fe, Ke, e, tr);
+  }  // end of updateResidualAndJacobian
+
+  void OrthotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
+      updateJacobianAction(mfem::Vector &Ye,
+                           const mfem::FiniteElement &e,
+                           mfem::ElementTransformation &tr,
+                           const mfem::Vector &,
+                           const mfem::Vector &Xe) {
+    this->implementUpdateJacobianAction(Ye, e, tr, Xe);
+  }  // end of updateJacobianAction
+
   void
   OrthotropicPlaneStrainStationaryNonLinearHeatTransferBehaviourIntegrator::
       computeInnerForces(mfem::Vector &Fe,
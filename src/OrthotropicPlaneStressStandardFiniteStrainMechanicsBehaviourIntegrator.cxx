@@ -55,7 +55,7 @@ namespace mfem_mgis {
       RotationMatrix
       OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
           getRotationMatrix(const size_type i) const {
-    return this->get_rotation_fct_ptr(this->r2D, this->r3D, i);
+    return Material::getRotationMatrix(i);
   }  // end of getRotationMatrix
 
   void OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
@@ -142,6 +142,157 @@ namespace mfem_mgis {
     }  // end of for (size_type nj = 0; nj != nnodes; ++nj)
   }    // end of updateStiffnessMatrix
 
+  inline void
+  OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
+      updateSymmetricStiffnessMatrix(mfem::DenseMatrix &Ke,
+                                     const mgis::span<const real> &Kip,
+                                     const mfem::DenseMatrix &dN,
+                                     const real w,
+                                     const size_type ni) const noexcept {
+    const auto nnodes = dN.NumRows();
+    const auto dNi_0 = dN(ni, 0);
+    const auto dNi_1 = dN(ni, 1);
+    const auto ni_0 = ni;
+    const auto ni_1 = ni + nnodes;
+    for (size_type nj = ni; nj != nnodes; ++nj) {
+      const auto dNj_0 = dN(nj, 0);
+      const auto dNj_1 = dN(nj, 1);
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      Ke(ni_0, nj_0) += w * (dNj_1 * dNi_0 * Kip[3] + dNi_1 * Kip[15] * dNj_0 +
+                             dNj_1 * dNi_1 * Kip[18] + dNi_0 * dNj_0 * Kip[0]);
+      Ke(ni_0, nj_1) += w * (dNj_1 * Kip[1] * dNi_0 + Kip[4] * dNi_0 * dNj_0 +
+                             Kip[19] * dNi_1 * dNj_0 + Kip[16] * dNj_1 * dNi_1);
+      Ke(ni_1, nj_0) += w * (Kip[5] * dNi_1 * dNj_0 + dNj_1 * Kip[8] * dNi_1 +
+                             dNj_1 * Kip[23] * dNi_0 + dNi_0 * Kip[20] * dNj_0);
+      Ke(ni_1, nj_1) += w * (dNi_0 * Kip[24] * dNj_0 + dNj_1 * dNi_0 * Kip[21] +
+                             dNj_1 * dNi_1 * Kip[6] + dNi_1 * Kip[9] * dNj_0);
+    }  // end of for (size_type nj = ni; nj != nnodes; ++nj)
+  }    // end of updateSymmetricStiffnessMatrix
+
+  template <size_type N>
+  inline void
+  OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
+      updateGradientsVectorised(mgis::span<real> &g,
+                                const mfem::Vector &u,
+                                const mfem::DenseMatrix &dN) noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    auto g_0 = real{0};
+    auto g_1 = real{0};
+    auto g_2 = real{0};
+    auto g_3 = real{0};
+    auto g_4 = real{0};
+    MFEM_MGIS_SIMD_REDUCTION_LOOP(g_0, g_1, g_2, g_3, g_4)
+    for (size_type ni = 0; ni < nnodes; ++ni) {
+      const auto dNi_0 = dN(ni, 0);
+      const auto dNi_1 = dN(ni, 1);
+      const auto u_0 = u[ni];
+      const auto u_1 = u[ni + nnodes];
+      g_0 += u_0 * dNi_0;
+      g_1 += dNi_1 * u_1;
+      g_2 += 0;
+      g_3 += dNi_1 * u_0;
+      g_4 += u_1 * dNi_0;
+    }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+    g[0] += g_0;
+    g[1] += g_1;
+    g[2] += g_2;
+    g[3] += g_3;
+    g[4] += g_4;
+  }  // end of updateGradientsVectorised
+
+  template <size_type N>
+  inline void
+  OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
+      updateInnerForcesVectorised(mfem::Vector &Fe,
+                                  const mgis::span<const real> &s,
+                                  const mfem::DenseMatrix &dN,
+                                  const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    MFEM_MGIS_SIMD_LOOP
+    for (size_type ni = 0; ni < nnodes; ++ni) {
+      const auto dNi_0 = dN(ni, 0);
+      const auto dNi_1 = dN(ni, 1);
+      const auto ni_0 = ni;
+      const auto ni_1 = ni + nnodes;
+      Fe[ni_0] += w * (dNi_1 * s[3] + dNi_0 * s[0]);
+      Fe[ni_1] += w * (s[1] * dNi_1 + s[4] * dNi_0);
+    }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+  }    // end of updateInnerForcesVectorised
+
+  template <size_type N>
+  inline void
+  OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
+      updateStiffnessMatrixVectorised(mfem::DenseMatrix &Ke,
+                                      const mgis::span<const real> &Kip,
+                                      const mfem::DenseMatrix &dN,
+                                      const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    for (size_type nj = 0; nj != nnodes; ++nj) {
+      const auto dNj_0 = dN(nj, 0);
+      const auto dNj_1 = dN(nj, 1);
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      MFEM_MGIS_SIMD_LOOP
+      for (size_type ni = 0; ni < nnodes; ++ni) {
+        const auto dNi_0 = dN(ni, 0);
+        const auto dNi_1 = dN(ni, 1);
+        const auto ni_0 = ni;
+        const auto ni_1 = ni + nnodes;
+        Ke(ni_0, nj_0) += w * (dNj_1 * dNi_0 * Kip[3] +
+                               dNi_1 * Kip[15] * dNj_0 +
+                               dNj_1 * dNi_1 * Kip[18] +
+                               dNi_0 * dNj_0 * Kip[0]);
+        Ke(ni_0, nj_1) += w * (dNj_1 * Kip[1] * dNi_0 + Kip[4] * dNi_0 * dNj_0 +
+                               Kip[19] * dNi_1 * dNj_0 +
+                               Kip[16] * dNj_1 * dNi_1);
+        Ke(ni_1, nj_0) += w * (Kip[5] * dNi_1 * dNj_0 + dNj_1 * Kip[8] * dNi_1 +
+                               dNj_1 * Kip[23] * dNi_0 +
+                               dNi_0 * Kip[20] * dNj_0);
+        Ke(ni_1, nj_1) += w * (dNi_0 * Kip[24] * dNj_0 +
+                               dNj_1 * dNi_0 * Kip[21] +
+                               dNj_1 * dNi_1 * Kip[6] + dNi_1 * Kip[9] * dNj_0);
+      }  // end of for (size_type ni = 0; ni < nnodes; ++ni)
+    }    // end of for (size_type nj = 0; nj != nnodes; ++nj)
+  }      // end of updateStiffnessMatrixVectorised
+
+  template <size_type N>
+  inline void
+  OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
+      updateSymmetricStiffnessMatrixVectorised(
+          mfem::DenseMatrix &Ke,
+          const mgis::span<const real> &Kip,
+          const mfem::DenseMatrix &dN,
+          const real w) const noexcept {
+    const size_type nnodes = (N != 0) ? N : dN.NumRows();
+    for (size_type nj = 0; nj != nnodes; ++nj) {
+      const auto dNj_0 = dN(nj, 0);
+      const auto dNj_1 = dN(nj, 1);
+      const auto nj_0 = nj;
+      const auto nj_1 = nj + nnodes;
+      MFEM_MGIS_SIMD_LOOP
+      for (size_type ni = 0; ni < nj + 1; ++ni) {
+        const auto dNi_0 = dN(ni, 0);
+        const auto dNi_1 = dN(ni, 1);
+        const auto ni_0 = ni;
+        const auto ni_1 = ni + nnodes;
+        Ke(ni_0, nj_0) += w * (dNj_1 * dNi_0 * Kip[3] +
+                               dNi_1 * Kip[15] * dNj_0 +
+                               dNj_1 * dNi_1 * Kip[18] +
+                               dNi_0 * dNj_0 * Kip[0]);
+        Ke(ni_0, nj_1) += w * (dNj_1 * Kip[1] * dNi_0 + Kip[4] * dNi_0 * dNj_0 +
+                               Kip[19] * dNi_1 * dNj_0 +
+                               Kip[16] * dNj_1 * dNi_1);
+        Ke(ni_1, nj_0) += w * (Kip[5] * dNi_1 * dNj_0 + dNj_1 * Kip[8] * dNi_1 +
+                               dNj_1 * Kip[23] * dNi_0 +
+                               dNi_0 * Kip[20] * dNj_0);
+        Ke(ni_1, nj_1) += w * (dNi_0 * Kip[24] * dNj_0 +
+                               dNj_1 * dNi_0 * Kip[21] +
+                               dNj_1 * dNi_1 * Kip[6] + dNi_1 * Kip[9] * dNj_0);
+      }  // end of for (size_type ni = 0; ni < nj + 1; ++ni)
+    }    // end of for (size_type nj = 0; nj != nnodes; ++nj)
+  }      // end of updateSymmetricStiffnessMatrixVectorised
+
   bool OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
       integrate(const mfem::FiniteElement &e,
                 mfem::ElementTransformation &tr,
@@ -150,6 +301,19 @@ namespace mfem_mgis {
     return this->implementIntegrate(e, tr, u, it);
   }  // end of integrate
 
+  void OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::computeGradients(
+      const mfem::FiniteElement &e,
+      mfem::ElementTransformation &tr,
+      const mfem::Vector &u,
+      const IntegrationType it) {
+    this->implementComputeGradients(e, tr, u, it);
+  }  // end of computeGradients
+
+  bool OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::performsBehaviourIntegration(
+      const IntegrationType it, const size_type nthreads) {
+    return this->implementPerformsBehaviourIntegration(it, nthreads);
+  }  // end of performsBehaviourIntegration
+
   void OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
       updateResidual(mfem::Vector &Fe,
                      const mfem::FiniteElement &e,
@@ -166,6 +330,24 @@ namespace mfem_mgis {
     this->implementUpdateJacobian(Ke, e, tr);
   }  // end of updateJacobian
 
+  void OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
+      updateResidualAndJacobian(mfem::Vector &Fe,
+                                mfem::DenseMatrix &Ke,
+                                const mfem::FiniteElement &e,
+                                mfem::ElementTransformation &tr,
+                                const mfem::Vector &) {
+    this->implementUpdateResidualAndJacobian(Fe, Ke, e, tr);
+  }  // end of updateResidualAndJacobian
+
+  void OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
+      updateJacobianAction(mfem::Vector &Ye,
+                           const mfem::FiniteElement &e,
+                           mfem::ElementTransformation &tr,
+                           const mfem::Vector &,
+                           const mfem::Vector &Xe) {
+    this->implementUpdateJacobianAction(Ye, e, tr, Xe);
+  }  // end of updateJacobianAction
+
   void OrthotropicPlaneStressStandardFiniteStrainMechanicsBehaviourIntegrator::
       computeInnerForces(mfem::Vector &Fe,
                          const mfem::FiniteElement &e,
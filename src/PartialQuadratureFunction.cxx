@@ -27,12 +27,8 @@ namespace mfem_mgis {
                          mfem::ElementTransformation&)> f) {
     const auto& fed = s->getFiniteElementDiscretization();
     const auto& fespace = fed.getFiniteElementSpace<parallel>();
-    const auto m = s->getId();
     auto values = std::make_shared<PartialQuadratureFunction>(s, 1);
-    for (size_type i = 0; i != fespace.GetNE(); ++i) {
-      if (fespace.GetAttribute(i) != m) {
-        continue;
-      }
+    for (const auto i : s->getElements()) {
       const auto& fe = *(fespace.GetFE(i));
       auto& tr = *(fespace.GetElementTransformation(i));
       const auto& ir = s->getIntegrationRule(fe, tr);
@@ -178,6 +174,16 @@ namespace mfem_mgis {
     this->immutable_values = v;
   }  // end of ImmutablePartialQuadratureFunctionView
 
+  ImmutablePartialQuadratureFunctionView::
+      ImmutablePartialQuadratureFunctionView(
+          std::shared_ptr<const PartialQuadratureSpace> s,
+          const mgis::span<real>* const v,
+          const size_type db,
+          const size_type ds)
+      : ImmutablePartialQuadratureFunctionView(s, *v, db, ds) {
+    this->bound_values = v;
+  }  // end of ImmutablePartialQuadratureFunctionView
+
   const real& ImmutablePartialQuadratureFunctionView::getIntegrationPointValue(
       const size_type e, const size_type i) const {
     return this->getIntegrationPointValue(this->qspace->getOffset(e) + i);
@@ -210,6 +216,15 @@ namespace mfem_mgis {
         values(v) {
   }  // end of PartialQuadratureFunction::PartialQuadratureFunction
 
+  PartialQuadratureFunction::PartialQuadratureFunction(
+      std::shared_ptr<const PartialQuadratureSpace> s,
+      const mgis::span<real>* const v,
+      const size_type db,
+      const size_type ds)
+      : ImmutablePartialQuadratureFunctionView(s, v, db, ds),
+        values(*v) {
+  }  // end of PartialQuadratureFunction::PartialQuadratureFunction
+
   real& PartialQuadratureFunction::getIntegrationPointValue(const size_type e,
                                                             const size_type i) {
     return this->getIntegrationPointValue(this->qspace->getOffset(e) + i);
@@ -7,7 +7,9 @@
 
 #include <cmath>
 #include <iterator>
+#include <utility>
 #include <algorithm>
+#include "mfem/linalg/densemat.hpp"
 #include "mfem/fem/fespace.hpp"
 #ifdef MFEM_USE_MPI
 #include "mfem/fem/pfespace.hpp"
@@ -20,26 +22,93 @@ namespace mfem_mgis {
 
   template <bool parallel>
   static size_type buildPartialQuadratureSpaceOffsets(
-      std::unordered_map<size_type, size_type>& offsets,
+      std::vector<size_type>& offsets,
+      const std::vector<size_type>& elements,
       const FiniteElementSpace<parallel>& fespace,
-      const size_type m,
       const std::function<const mfem::IntegrationRule&(
           const mfem::FiniteElement&, const mfem::ElementTransformation&)>&
           integration_rule_selector) {
+    // The integration rule depends on the finite element and on the element
+    // transformation. The latter is fully determined by the finite element
+    // describing the nodes of the mesh, if any, and by the geometry of the
+    // element otherwise, which is given by the finite element.
+    struct RuleKey {
+      //! \brief finite element
+      const mfem::FiniteElement* fe;
+      //! \brief finite element of the nodes of the mesh, if any
+      const mfem::FiniteElement* nodes_fe;
+    };
+    // integration rules associated with the keys already encountered. The
+    // number of distinct keys is very small (one per geometry in most
+    // cases), so a linear search is used.
+    using Rule = std::pair<RuleKey, const mfem::IntegrationRule*>;
+    auto rules = std::vector<Rule>{};
+    const auto* const nodes = fespace.GetMesh()->GetNodalFESpace();
     auto ng = size_type{};
-    for (size_type i = 0; i != fespace.GetNE(); ++i) {
-      if (fespace.GetAttribute(i) != m) {
-        continue;
+    offsets.resize(elements.size());
+    for (std::size_t idx = 0; idx != elements.size(); ++idx) {
+      const auto i = elements[idx];
+      const auto k = RuleKey{fespace.GetFE(i),
+                             nodes != nullptr ? nodes->GetFE(i) : nullptr};
+      auto p = std::find_if(rules.begin(), rules.end(), [&k](const auto& r) {
+        return (r.first.fe == k.fe) && (r.first.nodes_fe == k.nodes_fe);
+      });
+      if (p == rules.end()) {
+        const auto& tr = *(fespace.GetElementTransformation(i));
+        rules.emplace_back(k, &(integration_rule_selector(*(k.fe), tr)));
+        p = std::prev(rules.end());
       }
-      const auto& fe = *(fespace.GetFE(i));
-      const auto& tr = *(fespace.GetElementTransformation(i));
-      offsets[i] = ng;
-      const auto& ir = integration_rule_selector(fe, tr);
-      ng += ir.GetNPoints();
+      offsets[idx] = ng;
+      ng += p->second->GetNPoints();
     }
     return ng;
   }  // end of buildPartialQuadratureSpaceOffsets
 
+  template <bool parallel>
+  static void buildPartialQuadratureSpaceGeometricCache(
+      PartialQuadratureSpace::GeometricCache& c,
+      const FiniteElementSpace<parallel>& fespace,
+      const PartialQuadratureSpace& s,
+      const PartialQuadratureSpace::IntegrationPointWeightFunction& wfct) {
+    const auto ng = s.getNumberOfIntegrationPoints();
+    c.dshapes_offsets.resize(ng);
+    c.weights.resize(ng);
+    // computation of the size of the dshapes array
+    auto dsize = size_type{};
+    for (const auto i : s.getElements()) {
+      const auto eoffset = s.getOffset(i);
+      const auto& fe = *(fespace.GetFE(i));
+      const auto& tr = *(fespace.GetElementTransformation(i));
+      const auto& ir = s.getIntegrationRule(fe, tr);
+      const auto nnodes = fe.GetDof();
+      const auto dim = fe.GetDim();
+      for (size_type g = 0; g != ir.GetNPoints(); ++g) {
+        c.dshapes_offsets[eoffset + g] = dsize;
+        dsize += nnodes * dim;
+      }
+    }
+    c.dshapes.resize(dsize);
+    // computation of the geometric data
+    mfem::DenseMatrix dshape;
+    for (const auto i : s.getElements()) {
+      const auto eoffset = s.getOffset(i);
+      const auto& fe = *(fespace.GetFE(i));
+      auto& tr = *(fespace.GetElementTransformation(i));
+      const auto& ir = s.getIntegrationRule(fe, tr);
+      const auto nnodes = fe.GetDof();
+      const auto dim = fe.GetDim();
+      for (size_type g = 0; g != ir.GetNPoints(); ++g) {
+        const auto o = eoffset + g;
+        const auto& ip = ir.IntPoint(g);
+        tr.SetIntPoint(&ip);
+        dshape.UseExternalData(c.dshapes.data() + c.dshapes_offsets[o],
+                               nnodes, dim);
+        fe.CalcPhysDShape(tr, dshape);
+        c.weights[o] = wfct(tr, ip);
+      }
+    }
+  }  // end of buildPartialQuadratureSpaceGeometricCache
+
   void PartialQuadratureSpace::treatInvalidOffset(const size_type id,
                                                   const size_type i) {
     mgis::raise(
@@ -53,13 +122,21 @@ namespace mfem_mgis {
       const size_type m,
       const std::function<const mfem::IntegrationRule&(
           const mfem::FiniteElement&, const mfem::ElementTransformation&)>& irs)
-      : fe_discretization(fed), integration_rule_selector(irs), id(m) {
+      : fe_discretization(fed),
+        elements_partition(fed.getElementsPartition()),
+        integration_rule_selector(irs),
+        id(m) {
+    const auto pe = this->elements_partition.elements.find(m);
+    if (pe != this->elements_partition.elements.end()) {
+      this->elements = pe->second;
+    }
     if (fed.describesAParallelComputation()) {
 #ifdef MFEM_USE_MPI
       const auto& fespace =
           this->fe_discretization.getFiniteElementSpace<true>();
       this->ng = buildPartialQuadratureSpaceOffsets<true>(
-          this->offsets, fespace, this->id, this->integration_rule_selector);
+          this->elements_offsets, this->elements, fespace,
+          this->integration_rule_selector);
 #else  /* MFEM_USE_MPI */
       reportUnsupportedParallelComputations();
 #endif /* MFEM_USE_MPI */
@@ -67,7 +144,8 @@ namespace mfem_mgis {
       const auto& fespace =
           this->fe_discretization.getFiniteElementSpace<false>();
       this->ng = buildPartialQuadratureSpaceOffsets<false>(
-          this->offsets, fespace, this->id, this->integration_rule_selector);
+          this->elements_offsets, this->elements, fespace,
+          this->integration_rule_selector);
     }
   }  // end of PartialQuadratureSpace
 
@@ -77,6 +155,39 @@ namespace mfem_mgis {
     return this->integration_rule_selector(e, tr);
   }
 
+  void PartialQuadratureSpace::buildGeometricCache(
+      const IntegrationPointWeightFunction& wfct) const {
+    if (this->geometric_cache != nullptr) {
+      return;
+    }
+    auto c = std::make_unique<GeometricCache>();
+    if (this->fe_discretization.describesAParallelComputation()) {
+#ifdef MFEM_USE_MPI
+      const auto& fespace =
+          this->fe_discretization.getFiniteElementSpace<true>();
+      buildPartialQuadratureSpaceGeometricCache<true>(*c, fespace, *this, wfct);
+#else  /* MFEM_USE_MPI */
+      reportUnsupportedParallelComputations();
+#endif /* MFEM_USE_MPI */
+    } else {
+      const auto& fespace =
+          this->fe_discretization.getFiniteElementSpace<false>();
+      buildPartialQuadratureSpaceGeometricCache<false>(*c, fespace, *this,
+                                                       wfct);
+    }
+    this->geometric_cache = std::move(c);
+  }  // end of buildGeometricCache
+
+  std::size_t PartialQuadratureSpace::getGeometricCacheMemoryUsage() const {
+    if (this->geometric_cache == nullptr) {
+      return 0;
+    }
+    const auto& c = *(this->geometric_cache);
+    return sizeof(GeometricCache) +
+           c.dshapes_offsets.capacity() * sizeof(size_type) +
+           (c.dshapes.capacity() + c.weights.capacity()) * sizeof(real);
+  }  // end of getGeometricCacheMemoryUsage
+
   const FiniteElementDiscretization&
   PartialQuadratureSpace::getFiniteElementDiscretization() const {
     return this->fe_discretization;
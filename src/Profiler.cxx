@@ -6,6 +6,7 @@
  */
 
 #include <ctime>
+#include <iterator>
 #include <vector>
 #include <numeric>
 #include <ostream>
@@ -162,10 +163,99 @@ namespace mfem_mgis {
     return this->current->getTimer(n);
   }  // end of getTimer
 
+  void Profiler::incrementCounter(std::string_view n, const uint64_t v) {
+    std::lock_guard<std::mutex> lock(this->counters_mutex);
+    auto p = this->counters.find(n);
+    if (p == this->counters.end()) {
+      p = this->counters.insert({std::string(n), uint64_t{}}).first;
+    }
+    p->second += v;
+  }  // end of incrementCounter
+
+  uint64_t Profiler::getCounter(std::string_view n) const {
+    std::lock_guard<std::mutex> lock(this->counters_mutex);
+    const auto p = this->counters.find(n);
+    if (p == this->counters.end()) {
+      return uint64_t{};
+    }
+    return p->second;
+  }  // end of getCounter
+
+#ifdef MFEM_USE_MPI
+
+  /*!
+   * \return the names of the counters defined on at least one process,
+   * sorted in lexicographic order
+   * \param[in] counters: counters defined on the current process
+   *
+   * \note this function must be called by all the processes.
+   */
+  static std::vector<std::string> gatherCountersNames(
+      const std::map<std::string, uint64_t, std::less<>>& counters) {
+    // the names of the local counters are concatenated, each name being
+    // followed by a null character
+    auto local_names = std::vector<char>{};
+    for (const auto& c : counters) {
+      local_names.insert(local_names.end(), c.first.begin(), c.first.end());
+      local_names.push_back('\0');
+    }
+    int gsize;
+    MPI_Comm_size(MPI_COMM_WORLD, &gsize);
+    const auto local_size = static_cast<int>(local_names.size());
+    auto sizes = std::vector<int>(gsize);
+    MPI_Allgather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT,
+                  MPI_COMM_WORLD);
+    auto displacements = std::vector<int>(gsize, 0);
+    std::partial_sum(sizes.begin(), sizes.end() - 1,
+                     displacements.begin() + 1);
+    auto all_names = std::vector<char>(displacements.back() + sizes.back());
+    MPI_Allgatherv(local_names.data(), local_size, MPI_CHAR, all_names.data(),
+                   sizes.data(), displacements.data(), MPI_CHAR,
+                   MPI_COMM_WORLD);
+    auto names = std::vector<std::string>{};
+    for (auto p = all_names.begin(); p != all_names.end();) {
+      const auto pe = std::find(p, all_names.end(), '\0');
+      names.emplace_back(p, pe);
+      p = std::next(pe);
+    }
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+    return names;
+  }  // end of gatherCountersNames
+
+#endif /* MFEM_USE_MPI */
+
   void Profiler::print(std::ostream& os) const {
     for (const auto& ts : this->main.subsections) {
       ts.second->print(os, ts.first, "");
     }
+    std::lock_guard<std::mutex> lock(this->counters_mutex);
+#ifdef MFEM_USE_MPI
+    // the processes must agree on the list of counters before summing their
+    // values, since a counter may only be defined on some processes
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    const auto names = gatherCountersNames(this->counters);
+    auto values = std::vector<uint64_t>(names.size(), uint64_t{});
+    for (std::size_t i = 0; i != names.size(); ++i) {
+      const auto p = this->counters.find(names[i]);
+      if (p != this->counters.end()) {
+        values[i] = p->second;
+      }
+    }
+    auto totals = std::vector<uint64_t>(names.size(), uint64_t{});
+    MPI_Reduce(values.data(), totals.data(), static_cast<int>(values.size()),
+               MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    if (rank == 0) {
+      for (std::size_t i = 0; i != names.size(); ++i) {
+        os << "- " << names[i] << ": " << totals[i] << '\n';
+      }
+    }
+#else  /* MFEM_USE_MPI */
+    for (const auto& c : this->counters) {
+      os << "- " << c.first << ": " << c.second << '\n';
+    }
+#endif /* MFEM_USE_MPI */
   }  // end of print
 
   Profiler::Timer getTimer(std::string_view n) {
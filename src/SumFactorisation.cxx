@@ -0,0 +1,287 @@
+/*!
+ * \file   src/SumFactorisation.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include "mfem/fem/fe.hpp"
+#include "mfem/fem/intrules.hpp"
+#include "mfem/fem/geom.hpp"
+#include "MFEMMGIS/SumFactorisation.hxx"
+
+namespace mfem_mgis {
+
+  /*!
+   * \return if the given integration rule is the tensor product of the given
+   * one-dimensional rule, the integration points being ordered
+   * lexicographically.
+   * \param[in] ir: integration rule
+   * \param[in] ir1d: one-dimensional integration rule
+   * \param[in] d: dimension
+   */
+  static bool isTensorProductIntegrationRule(
+      const mfem::IntegrationRule &ir,
+      const mfem::IntegrationRule &ir1d,
+      const size_type d) {
+    const auto nq = ir1d.GetNPoints();
+    const auto nqd = (d == 2) ? nq * nq : nq * nq * nq;
+    if (ir.GetNPoints() != nqd) {
+      return false;
+    }
+    for (size_type q = 0; q != nqd; ++q) {
+      const auto &ip = ir.IntPoint(q);
+      if ((ip.x != ir1d.IntPoint(q % nq).x) ||
+          (ip.y != ir1d.IntPoint((q / nq) % nq).x)) {
+        return false;
+      }
+      if ((d == 3) && (ip.z != ir1d.IntPoint(q / (nq * nq)).x)) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of isTensorProductIntegrationRule
+
+  const mfem::DofToQuad *getTensorProductBasisMaps(
+      const mfem::FiniteElement &e, const mfem::IntegrationRule &ir) {
+    const auto g = e.GetGeomType();
+    if ((g != mfem::Geometry::SQUARE) && (g != mfem::Geometry::CUBE)) {
+      return nullptr;
+    }
+    if ((e.GetMapType() != mfem::FiniteElement::VALUE) ||
+        (dynamic_cast<const mfem::TensorBasisElement *>(&e) == nullptr)) {
+      return nullptr;
+    }
+    // one-dimensional rule used by MFEM to build the tensor-product maps
+    const auto &ir1d = mfem::IntRules.Get(mfem::Geometry::SEGMENT,
+                                          ir.GetOrder());
+    if (!isTensorProductIntegrationRule(ir, ir1d, e.GetDim())) {
+      return nullptr;
+    }
+    return &(e.GetDofToQuad(ir, mfem::DofToQuad::TENSOR));
+  }  // end of getTensorProductBasisMaps
+
+  const mfem::Array<int> &getLexicographicOrdering(
+      const mfem::FiniteElement &e) {
+    const auto *const te = dynamic_cast<const mfem::TensorBasisElement *>(&e);
+    if (te == nullptr) {
+      raise("getLexicographicOrdering: unsupported element");
+    }
+    return te->GetDofMap();
+  }  // end of getLexicographicOrdering
+
+  void interpolateReferenceGradients(real *const D,
+                                     std::vector<real> &wk,
+                                     const mfem::DofToQuad &m,
+                                     const size_type d,
+                                     const real *const X) {
+    const auto nd = m.ndof;
+    const auto nq = m.nqpt;
+    const auto *const B = m.B.GetData();
+    const auto *const G = m.G.GetData();
+    if (d == 2) {
+      // contraction along the first direction
+      wk.resize(2 * nd * nq);
+      auto *const BX = wk.data();
+      auto *const GX = BX + nd * nq;
+      for (size_type dy = 0; dy != nd; ++dy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto bx = real{0};
+          auto gx = real{0};
+          for (size_type dx = 0; dx != nd; ++dx) {
+            const auto x = X[dy * nd + dx];
+            bx += B[qx + nq * dx] * x;
+            gx += G[qx + nq * dx] * x;
+          }
+          BX[dy * nq + qx] = bx;
+          GX[dy * nq + qx] = gx;
+        }
+      }
+      // contraction along the second direction
+      for (size_type qy = 0; qy != nq; ++qy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto dx = real{0};
+          auto dy = real{0};
+          for (size_type k = 0; k != nd; ++k) {
+            dx += B[qy + nq * k] * GX[k * nq + qx];
+            dy += G[qy + nq * k] * BX[k * nq + qx];
+          }
+          const auto q = qy * nq + qx;
+          D[2 * q] = dx;
+          D[2 * q + 1] = dy;
+        }
+      }
+      return;
+    }
+    if (d != 3) {
+      raise("interpolateReferenceGradients: unsupported dimension");
+    }
+    wk.resize(2 * nd * nd * nq + 3 * nd * nq * nq);
+    auto *const BX = wk.data();
+    auto *const GX = BX + nd * nd * nq;
+    auto *const BGX = GX + nd * nd * nq;
+    auto *const GBX = BGX + nd * nq * nq;
+    auto *const BBX = GBX + nd * nq * nq;
+    // contraction along the first direction
+    for (size_type dz = 0; dz != nd; ++dz) {
+      for (size_type dy = 0; dy != nd; ++dy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto bx = real{0};
+          auto gx = real{0};
+          for (size_type dx = 0; dx != nd; ++dx) {
+            const auto x = X[(dz * nd + dy) * nd + dx];
+            bx += B[qx + nq * dx] * x;
+            gx += G[qx + nq * dx] * x;
+          }
+          BX[(dz * nd + dy) * nq + qx] = bx;
+          GX[(dz * nd + dy) * nq + qx] = gx;
+        }
+      }
+    }
+    // contraction along the second direction
+    for (size_type dz = 0; dz != nd; ++dz) {
+      for (size_type qy = 0; qy != nq; ++qy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto bgx = real{0};
+          auto gbx = real{0};
+          auto bbx = real{0};
+          for (size_type dy = 0; dy != nd; ++dy) {
+            const auto b = B[qy + nq * dy];
+            const auto i = (dz * nd + dy) * nq + qx;
+            bgx += b * GX[i];
+            gbx += G[qy + nq * dy] * BX[i];
+            bbx += b * BX[i];
+          }
+          const auto o = (dz * nq + qy) * nq + qx;
+          BGX[o] = bgx;
+          GBX[o] = gbx;
+          BBX[o] = bbx;
+        }
+      }
+    }
+    // contraction along the third direction
+    for (size_type qz = 0; qz != nq; ++qz) {
+      for (size_type qy = 0; qy != nq; ++qy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto dx = real{0};
+          auto dy = real{0};
+          auto dz = real{0};
+          for (size_type k = 0; k != nd; ++k) {
+            const auto b = B[qz + nq * k];
+            const auto i = (k * nq + qy) * nq + qx;
+            dx += b * BGX[i];
+            dy += b * GBX[i];
+            dz += G[qz + nq * k] * BBX[i];
+          }
+          const auto q = (qz * nq + qy) * nq + qx;
+          D[3 * q] = dx;
+          D[3 * q + 1] = dy;
+          D[3 * q + 2] = dz;
+        }
+      }
+    }
+  }  // end of interpolateReferenceGradients
+
+  void integrateReferenceGradients(real *const Y,
+                                   std::vector<real> &wk,
+                                   const mfem::DofToQuad &m,
+                                   const size_type d,
+                                   const real *const T) {
+    const auto nd = m.ndof;
+    const auto nq = m.nqpt;
+    const auto *const B = m.B.GetData();
+    const auto *const G = m.G.GetData();
+    if (d == 2) {
+      // contraction along the second direction
+      wk.resize(2 * nd * nq);
+      auto *const TX = wk.data();
+      auto *const TY = TX + nd * nq;
+      for (size_type dy = 0; dy != nd; ++dy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto tx = real{0};
+          auto ty = real{0};
+          for (size_type qy = 0; qy != nq; ++qy) {
+            const auto q = qy * nq + qx;
+            tx += B[qy + nq * dy] * T[2 * q];
+            ty += G[qy + nq * dy] * T[2 * q + 1];
+          }
+          TX[dy * nq + qx] = tx;
+          TY[dy * nq + qx] = ty;
+        }
+      }
+      // contraction along the first direction
+      for (size_type dy = 0; dy != nd; ++dy) {
+        for (size_type dx = 0; dx != nd; ++dx) {
+          auto y = real{0};
+          for (size_type qx = 0; qx != nq; ++qx) {
+            y += G[qx + nq * dx] * TX[dy * nq + qx] +
+                 B[qx + nq * dx] * TY[dy * nq + qx];
+          }
+          Y[dy * nd + dx] += y;
+        }
+      }
+      return;
+    }
+    if (d != 3) {
+      raise("integrateReferenceGradients: unsupported dimension");
+    }
+    wk.resize(3 * nd * nq * nq + 2 * nd * nd * nq);
+    auto *const TX = wk.data();
+    auto *const TY = TX + nd * nq * nq;
+    auto *const TZ = TY + nd * nq * nq;
+    auto *const TGX = TZ + nd * nq * nq;
+    auto *const TBX = TGX + nd * nd * nq;
+    // contraction along the third direction
+    for (size_type dz = 0; dz != nd; ++dz) {
+      for (size_type qy = 0; qy != nq; ++qy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto tx = real{0};
+          auto ty = real{0};
+          auto tz = real{0};
+          for (size_type qz = 0; qz != nq; ++qz) {
+            const auto b = B[qz + nq * dz];
+            const auto q = (qz * nq + qy) * nq + qx;
+            tx += b * T[3 * q];
+            ty += b * T[3 * q + 1];
+            tz += G[qz + nq * dz] * T[3 * q + 2];
+          }
+          const auto o = (dz * nq + qy) * nq + qx;
+          TX[o] = tx;
+          TY[o] = ty;
+          TZ[o] = tz;
+        }
+      }
+    }
+    // contraction along the second direction
+    for (size_type dz = 0; dz != nd; ++dz) {
+      for (size_type dy = 0; dy != nd; ++dy) {
+        for (size_type qx = 0; qx != nq; ++qx) {
+          auto tgx = real{0};
+          auto tbx = real{0};
+          for (size_type qy = 0; qy != nq; ++qy) {
+            const auto b = B[qy + nq * dy];
+            const auto i = (dz * nq + qy) * nq + qx;
+            tgx += b * TX[i];
+            tbx += G[qy + nq * dy] * TY[i] + b * TZ[i];
+          }
+          TGX[(dz * nd + dy) * nq + qx] = tgx;
+          TBX[(dz * nd + dy) * nq + qx] = tbx;
+        }
+      }
+    }
+    // contraction along the first direction
+    for (size_type dz = 0; dz != nd; ++dz) {
+      for (size_type dy = 0; dy != nd; ++dy) {
+        for (size_type dx = 0; dx != nd; ++dx) {
+          auto y = real{0};
+          for (size_type qx = 0; qx != nq; ++qx) {
+            const auto i = (dz * nd + dy) * nq + qx;
+            y += G[qx + nq * dx] * TGX[i] + B[qx + nq * dx] * TBX[i];
+          }
+          Y[(dz * nd + dy) * nd + dx] += y;
+        }
+      }
+    }
+  }  // end of integrateReferenceGradients
+
+}  // end of namespace mfem_mgis
@@ -24,6 +24,7 @@
 #include "MGIS/Raise.hxx"
 #include "MFEMMGIS/Material.hxx"
 #include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/AdaptiveTimeStepping.hxx"
 #include "MFEMMGIS/UniformDirichletBoundaryCondition.hxx"
 #include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
 #include "MFEMMGIS/NonLinearEvolutionProblemImplementation.hxx"
@@ -146,36 +147,28 @@ int main(int argc, char** argv) {
   const auto dt = mfem_mgis::real{1} / nsteps;
   auto t = mfem_mgis::real{0};
   auto iteration = mfem_mgis::size_type{};
+  auto time_stepping = mfem_mgis::AdaptiveTimeStepping(
+      problem, {{"InitialTimeIncrement", dt},
+                {"MaximalTimeIncrement", dt},
+                {"MinimalTimeIncrement", dt / 1024},
+                {"MaximumNumberOfSuccessiveFailures", 10}});
   for (mfem_mgis::size_type i = 0; i != nsteps; ++i) {
     std::cout << "iteration " << iteration << " from " << t << " to " << t + dt
               << '\n';
-    // resolution
-    auto ct = t;
-    auto dt2 = dt;
-    auto nsteps = mfem_mgis::size_type{1};
-    auto niter  = mfem_mgis::size_type{0};
-    while (nsteps != 0) {
-      bool converged = problem.solve(ct, dt2);
-      if (converged) {
-        --nsteps;
-        ct += dt2;
-      } else {
-        std::cout << "\nsubstep: " << niter << '\n';
-        nsteps *= 2;
-        dt2 /= 2;
-        ++niter;
-        problem.revert();
-        if (niter == 10) {
-          mgis::raise("maximum number of substeps");
-        }
-      }
+    // resolution, the state is updated by the adaptive time stepping
+    if (!time_stepping.solve(t, t + dt)) {
+      mgis::raise("maximum number of substeps");
     }
     problem.executePostProcessings(t, dt);
-    problem.update();
     t += dt;
     ++iteration;
     std::cout << '\n';
   }
+  const auto& statistics = time_stepping.getStatistics();
+  std::cout << "number of accepted steps: "
+            << statistics.number_of_accepted_steps << '\n'
+            << "number of rejected steps: "
+            << statistics.number_of_rejected_steps << '\n';
   }
   mfem_mgis::Profiler::getProfiler().print(out);
   return EXIT_SUCCESS;
@@ -0,0 +1,57 @@
+/*!
+ * \file   tests/AdaptiveTimeSteppingTest.cxx
+ * \brief
+ * This test checks the adaptive time stepping driver:
+ *
+ * - the time increment is increased, up to its maximal value, when the
+ *   Newton solver converges quickly.
+ * - the results at the final time are the ones obtained using a constant
+ *   time step.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/AdaptiveTimeStepping.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  constexpr auto dt0 = mfem_mgis::real{0.01};
+  constexpr auto dt_max = mfem_mgis::real{0.1};
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  mfem_mgis::AdaptiveTimeStepping ats(*problem,
+                                      {{"InitialTimeIncrement", dt0},
+                                       {"MaximalTimeIncrement", dt_max}});
+  if (!ats.solve(t0, t1)) {
+    mfem_mgis::getErrorStream() << "AdaptiveTimeStepping: non convergence\n";
+    return EXIT_FAILURE;
+  }
+  auto success = compareResults(extractResults(*problem),
+                                computeReferenceResults(p),
+                                "AdaptiveTimeStepping");
+  auto report = [&success](const char* const msg) {
+    mfem_mgis::getErrorStream() << "AdaptiveTimeStepping: " << msg << '\n';
+    success = false;
+  };
+  const auto& s = ats.getStatistics();
+  if (s.number_of_rejected_steps != 0) {
+    report("unexpected rejected time steps");
+  }
+  if (!(s.maximal_time_increment > dt0)) {
+    report("the time increment has not been increased");
+  }
+  if (s.maximal_time_increment > dt_max * (1 + 1e-12)) {
+    report("the maximal time increment has been exceeded");
+  }
+  const auto n = static_cast<mfem_mgis::size_type>((t1 - t0) / dt0);
+  if (s.number_of_accepted_steps >= n) {
+    report("invalid number of time steps");
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,117 @@
+/*!
+ * \file   tests/BatchedBehaviourIntegrationTest.cxx
+ * \brief
+ * This test checks the batched integration of the behaviours (see the
+ * `UseBatchedBehaviourIntegration` parameter) against the integration
+ * performed element by element:
+ *
+ * - the iterations of the Newton solver, the jacobian matrix and the results
+ *   are unchanged.
+ * - the time step scaling factor is unchanged and the histogram of the
+ *   ratios proposed by the behaviours holds one value per material.
+ * - when the integration fails, the ratio proposed by the behaviour is not
+ *   taken into account and a failure is reported in the histogram.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+static bool checkBatchedIntegration(const FeatureTestParameters& p) {
+  const auto msg = "UseBatchedBehaviourIntegration";
+  const auto threads =
+      mfem_mgis::Parameters{{"NumberOfThreads", p.number_of_threads}};
+  auto batched_options = threads;
+  batched_options.insert("UseBatchedBehaviourIntegration", true);
+  auto reference = buildUniaxialTensileTest(p, threads, {});
+  auto problem = buildUniaxialTensileTest(p, batched_options, {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return false;
+  }
+  auto success = compareNumberOfIterations(s, sref, msg);
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference), msg) &&
+            success;
+  success = compareMatrices(getJacobianMatrix(*problem),
+                            getJacobianMatrix(*reference), 1e-12, msg) &&
+            success;
+  const auto& o = s.last_output;
+  const auto& oref = sref.last_output;
+  if (o.time_step_scaling_factor != oref.time_step_scaling_factor) {
+    mfem_mgis::getErrorStream()
+        << msg << ": invalid time step scaling factor ("
+        << o.time_step_scaling_factor << " vs "
+        << oref.time_step_scaling_factor << ")\n";
+    success = false;
+  }
+  const auto& m = reference->getMaterial(1);
+  const auto& h = o.time_step_scaling_factors_histogram;
+  const auto& href = oref.time_step_scaling_factors_histogram;
+  if ((href.getNumberOfValues() != m.n) || (h.getNumberOfValues() != 1) ||
+      (h.number_of_failures != 0)) {
+    mfem_mgis::getErrorStream()
+        << msg << ": invalid histogram of the time step scaling factors ("
+        << h.getNumberOfValues() << " values and " << h.number_of_failures
+        << " failures, " << href.getNumberOfValues()
+        << " values for the reference)\n";
+    success = false;
+  }
+  return success;
+}  // end of checkBatchedIntegration
+
+static bool checkFailure(const FeatureTestParameters& p) {
+  // the integration of this behaviour fails if the norm of the strain
+  // increment is greater than 7.5e-4, which is the case in the first time
+  // step
+  const auto msg = "UseBatchedBehaviourIntegration (failure)";
+  auto p2 = p;
+  p2.behaviour = "PlasticityWithLimitedStrainIncrement";
+  const auto prediction =
+      mfem_mgis::Parameters{{"PredictionPolicy", "ElasticOperator"}};
+  auto reference = buildUniaxialTensileTest(
+      p2, {{"NumberOfThreads", p.number_of_threads}}, prediction);
+  auto problem = buildUniaxialTensileTest(
+      p2,
+      {{"NumberOfThreads", p.number_of_threads},
+       {"UseBatchedBehaviourIntegration", true}},
+      prediction);
+  const auto oref = reference->solve(t0, (t1 - t0) / nsteps);
+  const auto o = problem->solve(t0, (t1 - t0) / nsteps);
+  if ((oref.status) || (o.status)) {
+    mfem_mgis::getErrorStream()
+        << msg << ": the integration of the behaviour did not fail\n";
+    return false;
+  }
+  auto success = true;
+  if (o.time_step_scaling_factor != oref.time_step_scaling_factor) {
+    mfem_mgis::getErrorStream()
+        << msg << ": invalid time step scaling factor ("
+        << o.time_step_scaling_factor << " vs "
+        << oref.time_step_scaling_factor << ")\n";
+    success = false;
+  }
+  if (o.time_step_scaling_factors_histogram.number_of_failures != 1) {
+    mfem_mgis::getErrorStream() << msg << ": the failure is not reported\n";
+    success = false;
+  }
+  return success;
+}  // end of checkFailure
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  if ((p.number_of_threads > 1) && (!areMultiThreadedComputationsSupported())) {
+    return EXIT_SUCCESS;
+  }
+  auto success = checkBatchedIntegration(p);
+  success = checkFailure(p) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
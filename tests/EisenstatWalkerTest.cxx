@@ -0,0 +1,98 @@
+/*!
+ * \file   tests/EisenstatWalkerTest.cxx
+ * \brief
+ * This test checks the `EisenstatWalker` forcing terms of the Newton solver
+ * (see the `ForcingTerm` parameter) with an iterative linear solver:
+ *
+ * - the relative tolerance of the linear solver is modified during the
+ *   resolution and restored on exit, even if the resolution fails.
+ * - fewer iterations of the linear solver are performed than with the
+ *   configured relative tolerance, and an estimate of the saved iterations
+ *   is reported.
+ * - the results are unchanged, up to the tolerance of the Newton solver.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+/*!
+ * \return true if the relative tolerance of the linear solver is the
+ * configured one
+ * \param[in] ls: linear solver
+ * \param[in] msg: description of the check
+ */
+static bool checkRelativeTolerance(const CountingCGSolver& ls,
+                                   const char* const msg) {
+  // relative tolerance set by the constructor of the `CountingCGSolver` class
+  constexpr auto rtol = mfem_mgis::real{1e-12};
+  if (ls.getRelativeTolerance() != rtol) {
+    mfem_mgis::getErrorStream()
+        << "EisenstatWalker: the relative tolerance of the linear solver has "
+        << "not been restored " << msg << " (" << ls.getRelativeTolerance()
+        << " vs " << rtol << ")\n";
+    return false;
+  }
+  return true;
+}  // end of checkRelativeTolerance
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  auto problem =
+      buildUniaxialTensileTest(p, {}, {{"ForcingTerm", "EisenstatWalker"}});
+  const auto& lsref = setCountingCGSolver(*reference);
+  const auto& ls = setCountingCGSolver(*problem);
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return EXIT_FAILURE;
+  }
+  auto success = compareResults(extractResults(*problem),
+                                extractResults(*reference), "EisenstatWalker");
+  success = checkRelativeTolerance(ls, "after a successful resolution") &&
+            success;
+  if (!(ls.maximum_relative_tolerance > lsref.maximum_relative_tolerance)) {
+    mfem_mgis::getErrorStream() << "EisenstatWalker: the relative tolerance "
+                                << "of the linear solver was not modified\n";
+    success = false;
+  }
+  if (!(s.linear_solver_iterations < sref.linear_solver_iterations)) {
+    mfem_mgis::getErrorStream()
+        << "EisenstatWalker: the number of iterations of the linear solver "
+        << "was not decreased (" << s.linear_solver_iterations << " vs "
+        << sref.linear_solver_iterations << ")\n";
+    success = false;
+  }
+  if (s.estimated_saved_linear_solver_iterations == 0) {
+    mfem_mgis::getErrorStream()
+        << "EisenstatWalker: no saved iteration of the linear solver\n";
+    success = false;
+  }
+  if (sref.estimated_saved_linear_solver_iterations != 0) {
+    mfem_mgis::getErrorStream() << "EisenstatWalker: unexpected saved "
+                                << "iterations of the linear solver\n";
+    success = false;
+  }
+  // the relative tolerance shall also be restored if the resolution fails.
+  // A single iteration does not allow the convergence of a plastic loading.
+  problem->setSolverParameters({{"MaximumNumberOfIterations", 1}});
+  const auto dt = (t1 - t0) / nsteps;
+  const auto output = problem->solve(t1, dt);
+  if (output.status) {
+    mfem_mgis::getErrorStream()
+        << "EisenstatWalker: unexpected convergence in one iteration\n";
+    success = false;
+  }
+  problem->revert();
+  success = checkRelativeTolerance(ls, "after a failed resolution") &&
+            success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,63 @@
+/*!
+ * \file   tests/FusedAssemblyTest.cxx
+ * \brief
+ * This test checks that assembling the residual and the jacobian matrix in
+ * the same loop over the elements (see the `UseFusedAssembly` parameter)
+ * leads to the same iterations of the Newton solver, to the same jacobian
+ * matrix and to the same results as the separate assemblies.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  auto problem = buildUniaxialTensileTest(p, {{"UseFusedAssembly", true}}, {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return EXIT_FAILURE;
+  }
+  auto success = compareNumberOfIterations(s, sref, "UseFusedAssembly");
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference), "UseFusedAssembly") &&
+            success;
+  // the last evaluation of the residual has been made at the unknowns at the
+  // end of the time step: the jacobian matrix is the one assembled with the
+  // residual
+  success = compareMatrices(getJacobianMatrix(*problem),
+                            getJacobianMatrix(*reference), 1e-12,
+                            "UseFusedAssembly") &&
+            success;
+  // When the jacobian matrix is reused or when a line search is used, some
+  // residuals are evaluated after integrations of the behaviours which do not
+  // compute the tangent operators. Only the residual is then assembled.
+  const auto solver_options =
+      mfem_mgis::Parameters{{"JacobianUpdatePolicy", "Periodic"},
+                            {"JacobianUpdatePeriod", 2},
+                            {"LineSearch", "Backtracking"}};
+  auto reference2 = buildUniaxialTensileTest(p, {}, solver_options);
+  auto problem2 = buildUniaxialTensileTest(p, {{"UseFusedAssembly", true}},
+                                           solver_options);
+  const auto sref2 = solve(*reference2, t0, t1, nsteps);
+  const auto s2 = solve(*problem2, t0, t1, nsteps);
+  if ((!sref2.status) || (!s2.status)) {
+    return EXIT_FAILURE;
+  }
+  success = compareNumberOfIterations(s2, sref2,
+                                      "UseFusedAssembly (Periodic)") &&
+            success;
+  success = compareResults(extractResults(*problem2),
+                           extractResults(*reference2),
+                           "UseFusedAssembly (Periodic)") &&
+            success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
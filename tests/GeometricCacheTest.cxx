@@ -0,0 +1,76 @@
+/*!
+ * \file   tests/GeometricCacheTest.cxx
+ * \brief
+ * This test checks that precomputing the derivatives of the shape functions
+ * and the weights of the integration points (see the `UseGeometricCache`
+ * parameter) leads to the same iterations of the Newton solver, to the same
+ * jacobian matrix and to the same results as the reference computation. The
+ * check is also performed with the batched integration of the behaviours,
+ * which computes the gradients in a separate pass over the elements.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/BehaviourIntegrator.hxx"
+#include "MFEMMGIS/PartialQuadratureSpace.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+//! \return the quadrature space of the first material of the given problem
+static const mfem_mgis::PartialQuadratureSpace& getQuadratureSpace(
+    mfem_mgis::NonLinearEvolutionProblem& problem) {
+  return problem.getImplementation<false>()
+      .getBehaviourIntegrator(1)
+      .getPartialQuadratureSpace();
+}  // end of getQuadratureSpace
+
+static bool checkGeometricCache(const FeatureTestParameters& p,
+                                const bool batched) {
+  const auto msg = std::string{batched ? "UseGeometricCache (batched)"
+                                       : "UseGeometricCache"};
+  auto reference = buildUniaxialTensileTest(
+      p, {{"UseBatchedBehaviourIntegration", batched}}, {});
+  auto problem = buildUniaxialTensileTest(
+      p,
+      {{"UseBatchedBehaviourIntegration", batched},
+       {"UseGeometricCache", true}},
+      {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return false;
+  }
+  auto success = true;
+  if (getQuadratureSpace(*reference).getGeometricCache() != nullptr) {
+    mfem_mgis::getErrorStream() << msg << ": unexpected geometric cache\n";
+    success = false;
+  }
+  const auto& qspace = getQuadratureSpace(*problem);
+  if ((qspace.getGeometricCache() == nullptr) ||
+      (qspace.getGeometricCacheMemoryUsage() == 0)) {
+    mfem_mgis::getErrorStream() << msg << ": no geometric cache\n";
+    success = false;
+  }
+  success = compareNumberOfIterations(s, sref, msg) && success;
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference), msg) &&
+            success;
+  success = compareMatrices(getJacobianMatrix(*problem),
+                            getJacobianMatrix(*reference), 1e-12, msg) &&
+            success;
+  return success;
+}  // end of checkGeometricCache
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto success = checkGeometricCache(p, false);
+  success = checkGeometricCache(p, true) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
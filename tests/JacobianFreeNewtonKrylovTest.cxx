@@ -0,0 +1,78 @@
+/*!
+ * \file   tests/JacobianFreeNewtonKrylovTest.cxx
+ * \brief
+ * This test checks the Jacobian-free Newton-Krylov method (see the
+ * `JacobianFreeNewtonKrylov` parameter of the solver):
+ *
+ * - the Newton corrections are computed by the Krylov solver, the linear
+ *   solver holding the jacobian matrix being only used as a preconditioner.
+ * - the convergence of the Newton solver is preserved.
+ * - the preconditioner may be updated periodically without changing the
+ *   results.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  if (!sref.status) {
+    return EXIT_FAILURE;
+  }
+  const auto rref = extractResults(*reference);
+  auto success = true;
+  auto check = [&p, &sref, &rref, &success](
+                   const mfem_mgis::Parameters& options,
+                   const bool periodic, const std::string& msg) {
+    auto problem = buildUniaxialTensileTest(p, {}, options);
+    const auto& ls = setCountingCGSolver(*problem);
+    const auto s = solve(*problem, t0, t1, nsteps);
+    if (!s.status) {
+      success = false;
+      return;
+    }
+    success = compareResults(extractResults(*problem), rref, msg) && success;
+    // the Newton corrections are computed up to the tolerance of the Krylov
+    // solver: at most one additional iteration per time step is expected if
+    // the preconditioner is updated at each iteration
+    for (std::size_t i = 0; i != s.iterations.size(); ++i) {
+      if ((!periodic) && (s.iterations[i] > sref.iterations[i] + 1)) {
+        mfem_mgis::getErrorStream()
+            << msg << ": too many iterations at time step " << i << " ("
+            << s.iterations[i] << " vs " << sref.iterations[i] << ")\n";
+        success = false;
+      }
+    }
+    if (s.linear_solver_iterations == 0) {
+      mfem_mgis::getErrorStream()
+          << msg << ": the Krylov solver has not been used\n";
+      success = false;
+    }
+    const auto n = getTotalNumberOfIterations(s);
+    if ((periodic) ? (ls.number_of_operators >= n)
+                   : (ls.number_of_operators != n)) {
+      mfem_mgis::getErrorStream()
+          << msg << ": invalid number of updates of the preconditioner ("
+          << ls.number_of_operators << " updates for " << n
+          << " iterations)\n";
+      success = false;
+    }
+  };
+  check({{"JacobianFreeNewtonKrylov", true}}, false,
+        "JacobianFreeNewtonKrylov");
+  check({{"JacobianFreeNewtonKrylov", true},
+         {"JacobianUpdatePolicy", "Periodic"},
+         {"JacobianUpdatePeriod", 3}},
+        true, "JacobianFreeNewtonKrylov (Periodic)");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
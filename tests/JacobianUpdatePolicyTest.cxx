@@ -0,0 +1,66 @@
+/*!
+ * \file   tests/JacobianUpdatePolicyTest.cxx
+ * \brief
+ * This test checks the policies of the update of the jacobian matrix by the
+ * Newton solver (see the `JacobianUpdatePolicy` parameter of the solver):
+ *
+ * - the jacobian matrix is updated at each iteration by default.
+ * - the jacobian matrix is reused by the `Periodic` and `OnSlowConvergence`
+ *   policies, i.e. the number of updates is lower than the number of
+ *   iterations.
+ * - the reuse of the jacobian matrix does not change the results.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  const auto& lsref = setCountingCGSolver(*reference);
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  if (!sref.status) {
+    return EXIT_FAILURE;
+  }
+  auto success = true;
+  if (lsref.number_of_operators != getTotalNumberOfIterations(sref)) {
+    mfem_mgis::getErrorStream()
+        << "EveryIteration: invalid number of updates of the jacobian ("
+        << lsref.number_of_operators << " vs "
+        << getTotalNumberOfIterations(sref) << ")\n";
+    success = false;
+  }
+  const auto rref = extractResults(*reference);
+  auto check = [&p, &rref, &success](const mfem_mgis::Parameters& options,
+                                     const std::string& msg) {
+    auto problem = buildUniaxialTensileTest(p, {}, options);
+    const auto& ls = setCountingCGSolver(*problem);
+    const auto s = solve(*problem, t0, t1, nsteps);
+    if (!s.status) {
+      success = false;
+      return;
+    }
+    success = compareResults(extractResults(*problem), rref, msg) && success;
+    if (ls.number_of_operators >= getTotalNumberOfIterations(s)) {
+      mfem_mgis::getErrorStream()
+          << msg << ": the jacobian matrix has not been reused ("
+          << ls.number_of_operators << " updates for "
+          << getTotalNumberOfIterations(s) << " iterations)\n";
+      success = false;
+    }
+  };
+  check({{"JacobianUpdatePolicy", "Periodic"}, {"JacobianUpdatePeriod", 2}},
+        "JacobianUpdatePolicy (Periodic)");
+  check({{"JacobianUpdatePolicy", "OnSlowConvergence"},
+         {"JacobianUpdateConvergenceRateThreshold", 0.5}},
+        "JacobianUpdatePolicy (OnSlowConvergence)");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
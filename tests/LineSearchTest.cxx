@@ -0,0 +1,57 @@
+/*!
+ * \file   tests/LineSearchTest.cxx
+ * \brief
+ * This test checks the line searches of the Newton solver (see the
+ * `LineSearch` parameter of the solver):
+ *
+ * - the full Newton steps are accepted when they decrease the residual
+ *   enough: with the full Newton method, the line searches don't change the
+ *   iterations of the solver.
+ * - the line searches don't change the results, including when the jacobian
+ *   matrix is reused.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  if (!sref.status) {
+    return EXIT_FAILURE;
+  }
+  const auto rref = extractResults(*reference);
+  auto success = true;
+  for (const auto* const l : {"Backtracking", "CriticalPoint"}) {
+    const auto msg = "LineSearch (" + std::string{l} + ")";
+    auto problem = buildUniaxialTensileTest(p, {}, {{"LineSearch", l}});
+    const auto s = solve(*problem, t0, t1, nsteps);
+    if (!s.status) {
+      return EXIT_FAILURE;
+    }
+    success = compareNumberOfIterations(s, sref, msg) && success;
+    success = compareResults(extractResults(*problem), rref, msg) && success;
+    // with a reused jacobian matrix
+    auto problem2 = buildUniaxialTensileTest(p, {},
+                                             {{"LineSearch", l},
+                                              {"JacobianUpdatePolicy",
+                                               "Periodic"},
+                                              {"JacobianUpdatePeriod", 3}});
+    if (!solve(*problem2, t0, t1, nsteps).status) {
+      return EXIT_FAILURE;
+    }
+    success = compareResults(extractResults(*problem2), rref,
+                             msg + " with a reused jacobian matrix") &&
+              success;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,167 @@
+/*!
+ * \file   tests/LinearSolverReuseTest.cxx
+ * \brief
+ * This test checks that reusing the preconditioners of the iterative solvers
+ * (see the `UpdatePeriod` and `IterationsGrowthThreshold` parameters of the
+ * preconditioners) and the symbolic factorisation of the `UMFPackSolver`
+ * solver (see the `ReuseSymbolicFactorisation` parameter) does not change the
+ * iterations of the Newton solver nor the results, and that those reuses
+ * actually happen.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "mfem/config/config.hpp"
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+//! \brief results of a resolution using a given linear solver
+struct LinearSolverReuseResults {
+  //! \brief statistics of the resolution
+  ResolutionStatistics statistics;
+  //! \brief results at the end of the last time step
+  FeatureTestResults results;
+  //! \brief increase of the counter of reuses during the resolution
+  mfem_mgis::size_type number_of_reuses = 0;
+};  // end of struct LinearSolverReuseResults
+
+/*!
+ * \return the results of the uniaxial tensile test using the given linear
+ * solver
+ * \param[in] p: test parameters
+ * \param[in] s: name of the linear solver
+ * \param[in] params: parameters of the linear solver
+ * \param[in] c: name of the counter of reuses
+ */
+static LinearSolverReuseResults run(const FeatureTestParameters& p,
+                                    const std::string& s,
+                                    const mfem_mgis::Parameters& params,
+                                    const std::string& c) {
+  auto& profiler = mfem_mgis::Profiler::getProfiler();
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  problem->setLinearSolver(s, params);
+  auto r = LinearSolverReuseResults{};
+  const auto n0 = profiler.getCounter(c);
+  r.statistics = solve(*problem, t0, t1, nsteps);
+  r.number_of_reuses =
+      static_cast<mfem_mgis::size_type>(profiler.getCounter(c) - n0);
+  if (!r.statistics.status) {
+    mfem_mgis::abort("LinearSolverReuseTest: non convergence");
+  }
+  r.results = extractResults(*problem);
+  return r;
+}  // end of run
+
+/*!
+ * \return true if the given results are equal to the reference results
+ * \param[in] r: results
+ * \param[in] ref: reference results
+ * \param[in] msg: description of the results
+ */
+static bool compare(const LinearSolverReuseResults& r,
+                    const LinearSolverReuseResults& ref,
+                    const std::string& msg) {
+  const auto b = compareNumberOfIterations(r.statistics, ref.statistics, msg);
+  return compareResults(r.results, ref.results, msg) && b;
+}  // end of compare
+
+/*!
+ * \return the parameters of the `CGSolver` solver using the `Jacobi`
+ * preconditioner
+ * \param[in] pr: additional parameters of the preconditioner
+ */
+static mfem_mgis::Parameters getCGSolverParameters(
+    const mfem_mgis::Parameters& pr) {
+  auto prec = mfem_mgis::Parameters{{"Name", "Jacobi"}};
+  prec.insert(pr);
+  return {{"VerbosityLevel", 0},
+          {"AbsoluteTolerance", 1e-12},
+          {"RelativeTolerance", 1e-12},
+          {"MaximumNumberOfIterations", 300},
+          {"Preconditioner", prec}};
+}  // end of getCGSolverParameters
+
+static bool checkReusablePreconditioner(const FeatureTestParameters& p) {
+  const auto c = std::string{"PreconditionerReuses"};
+  const auto ref = run(p, "CGSolver", getCGSolverParameters({}), c);
+  auto success = true;
+  // the preconditioner is kept during 3 updates of the jacobian matrix
+  const auto r1 = run(p, "CGSolver",
+                      getCGSolverParameters({{"UpdatePeriod", 3}}), c);
+  success = compare(r1, ref, "UpdatePeriod") && success;
+  if (r1.number_of_reuses == 0) {
+    mfem_mgis::getErrorStream() << "UpdatePeriod: no reuse\n";
+    success = false;
+  }
+  // the preconditioner is kept as long as the number of iterations of the
+  // linear solver does not grow
+  const auto r2 = run(p, "CGSolver",
+                      getCGSolverParameters({{"UpdatePeriod", 1000}}), c);
+  const auto r3 =
+      run(p, "CGSolver",
+          getCGSolverParameters(
+              {{"UpdatePeriod", 1000}, {"IterationsGrowthThreshold", 0.}}),
+          c);
+  success = compare(r2, ref, "UpdatePeriod") && success;
+  success = compare(r3, ref, "IterationsGrowthThreshold") && success;
+  if ((r2.number_of_reuses == 0) ||
+      (r3.number_of_reuses > r2.number_of_reuses)) {
+    mfem_mgis::getErrorStream()
+        << "IterationsGrowthThreshold: invalid number of reuses ("
+        << r3.number_of_reuses << " vs " << r2.number_of_reuses << ")\n";
+    success = false;
+  }
+  // the threshold has no effect if the preconditioner is updated at each
+  // update of the jacobian matrix, which is the default
+  const auto r4 = run(
+      p, "CGSolver",
+      getCGSolverParameters({{"IterationsGrowthThreshold", 0.5}}), c);
+  success = compare(r4, ref, "IterationsGrowthThreshold") && success;
+  if (r4.number_of_reuses != 0) {
+    mfem_mgis::getErrorStream()
+        << "IterationsGrowthThreshold: unexpected reuses\n";
+    success = false;
+  }
+  return success;
+}  // end of checkReusablePreconditioner
+
+static bool checkSymbolicFactorisationReuse(const FeatureTestParameters& p) {
+#ifdef MFEM_USE_SUITESPARSE
+  const auto c = std::string{"SymbolicFactorisationReuses"};
+  const auto ref = run(p, "UMFPackSolver", {}, c);
+  const auto r =
+      run(p, "UMFPackSolver", {{"ReuseSymbolicFactorisation", true}}, c);
+  auto success = compare(r, ref, "ReuseSymbolicFactorisation");
+  if (ref.number_of_reuses != 0) {
+    mfem_mgis::getErrorStream()
+        << "ReuseSymbolicFactorisation: unexpected reuses\n";
+    success = false;
+  }
+  // the sparsity pattern of the jacobian matrix never changes: the symbolic
+  // factorisation is only computed once
+  if (r.number_of_reuses == 0) {
+    mfem_mgis::getErrorStream() << "ReuseSymbolicFactorisation: no reuse\n";
+    success = false;
+  }
+  return success;
+#else  /* MFEM_USE_SUITESPARSE */
+  static_cast<void>(p);
+  mfem_mgis::getOutputStream()
+      << "UMFPack is not available, ReuseSymbolicFactorisation not tested\n";
+  return true;
+#endif /* MFEM_USE_SUITESPARSE */
+}  // end of checkSymbolicFactorisationReuse
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto success = checkReusablePreconditioner(p);
+  success = checkSymbolicFactorisationReuse(p) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,112 @@
+/*!
+ * \file   tests/LocalSubsteppingTest.cxx
+ * \brief
+ * This test checks the local substepping (see the
+ * `NumberOfLocalSubsteppingLevels` parameter):
+ *
+ * - with a behaviour whose integration never fails, the local substepping is
+ *   never triggered and the results are unchanged.
+ * - with a behaviour whose integration fails if the strain increment is too
+ *   large, the local substepping recovers from the failures and gives the
+ *   results obtained with smaller time steps. This also holds for the
+ *   batched integration of the behaviours.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+//! \return the number of recoveries by the local substepping
+static mfem_mgis::size_type getNumberOfLocalSubsteppingRecoveries() {
+  return static_cast<mfem_mgis::size_type>(
+      mfem_mgis::Profiler::getProfiler().getCounter(
+          "LocalSubsteppingRecoveries"));
+}  // end of getNumberOfLocalSubsteppingRecoveries
+
+static bool checkNoRecovery(const FeatureTestParameters& p) {
+  const auto msg = "NumberOfLocalSubsteppingLevels";
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  auto problem = buildUniaxialTensileTest(
+      p, {{"NumberOfLocalSubsteppingLevels", 3}}, {});
+  const auto n0 = getNumberOfLocalSubsteppingRecoveries();
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return false;
+  }
+  auto success = compareNumberOfIterations(s, sref, msg);
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference), msg) &&
+            success;
+  if (getNumberOfLocalSubsteppingRecoveries() != n0) {
+    mfem_mgis::getErrorStream() << msg << ": unexpected recoveries\n";
+    success = false;
+  }
+  return success;
+}  // end of checkNoRecovery
+
+static bool checkRecovery(const FeatureTestParameters& p) {
+  // The integration of this behaviour fails if the norm of the strain
+  // increment is greater than 7.5e-4. The time steps of the reference
+  // computation are small enough to avoid any failure, whereas the ones of
+  // the other computations lead to strain increments close to 1e-3. The
+  // prediction avoids large strain increments in the elements close to the
+  // boundary on which the displacement is imposed.
+  const auto msg = "NumberOfLocalSubsteppingLevels (recovery)";
+  auto p2 = p;
+  p2.behaviour = "PlasticityWithLimitedStrainIncrement";
+  const auto prediction =
+      mfem_mgis::Parameters{{"PredictionPolicy", "ElasticOperator"}};
+  auto reference = buildUniaxialTensileTest(p2, {}, prediction);
+  if (!solve(*reference, t0, t1, 4 * nsteps).status) {
+    mfem_mgis::getErrorStream()
+        << msg << ": the reference computation failed\n";
+    return false;
+  }
+  // without substepping, the computation fails
+  auto success = true;
+  auto failing = buildUniaxialTensileTest(p2, {}, prediction);
+  if (failing->solve(t0, (t1 - t0) / nsteps)) {
+    mfem_mgis::getErrorStream()
+        << msg << ": the integration of the behaviour did not fail\n";
+    success = false;
+  }
+  const auto rref = extractResults(*reference);
+  // the failed batched integrations must also be recovered
+  for (const auto batched : {false, true}) {
+    const auto msg2 = std::string{msg} + (batched ? " (batched)" : "");
+    auto problem = buildUniaxialTensileTest(
+        p2,
+        {{"NumberOfLocalSubsteppingLevels", 3},
+         {"UseBatchedBehaviourIntegration", batched}},
+        prediction);
+    const auto n0 = getNumberOfLocalSubsteppingRecoveries();
+    if (!solve(*problem, t0, t1, nsteps).status) {
+      mfem_mgis::getErrorStream()
+          << msg2 << ": the local substepping did not recover\n";
+      success = false;
+      continue;
+    }
+    if (getNumberOfLocalSubsteppingRecoveries() == n0) {
+      mfem_mgis::getErrorStream() << msg2 << ": no recovery reported\n";
+      success = false;
+    }
+    success = compareResults(extractResults(*problem), rref, msg2) && success;
+  }
+  return success;
+}  // end of checkRecovery
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto success = checkNoRecovery(p);
+  success = checkRecovery(p) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,85 @@
+/*!
+ * \file   tests/MatrixFreeJacobianTest.cxx
+ * \brief
+ * This test checks the matrix-free jacobian operator (see the
+ * `UseMatrixFreeJacobian` parameter):
+ *
+ * - the product of the operator by a vector and its diagonal are the ones of
+ *   the assembled jacobian matrix.
+ * - the iterations of the Newton solver and the results are unchanged.
+ * - line searches are rejected.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <vector>
+#include <cstdlib>
+#include <stdexcept>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+//! \return the values of the given vector
+static std::vector<mfem_mgis::real> getValues(const mfem::Vector& v) {
+  return std::vector<mfem_mgis::real>(v.GetData(), v.GetData() + v.Size());
+}  // end of getValues
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  auto problem =
+      buildUniaxialTensileTest(p, {{"UseMatrixFreeJacobian", true}}, {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return EXIT_FAILURE;
+  }
+  auto success = compareNumberOfIterations(s, sref, "UseMatrixFreeJacobian");
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference),
+                           "UseMatrixFreeJacobian") &&
+            success;
+  // both problems share the same tangent operator blocks: the matrix-free
+  // operator is compared to the assembled jacobian matrix
+  const auto K = getJacobianMatrix(*reference);
+  const auto& J = problem->getImplementation<false>().GetGradient(
+      problem->getUnknownsAtEndOfTheTimeStep());
+  if ((J.Height() != K.Height()) || (J.Width() != K.Width())) {
+    mfem_mgis::getErrorStream()
+        << "UseMatrixFreeJacobian: invalid operator size\n";
+    return EXIT_FAILURE;
+  }
+  const auto eps = 1e-12 * K.MaxNorm();
+  auto x = mfem::Vector(K.Width());
+  auto y = mfem::Vector(K.Height());
+  auto yref = mfem::Vector(K.Height());
+  for (const auto seed : {1, 2, 3}) {
+    x.Randomize(seed);
+    J.Mult(x, y);
+    K.Mult(x, yref);
+    success = compareValues(getValues(y), getValues(yref), eps * x.Size(),
+                            "UseMatrixFreeJacobian (product)") &&
+              success;
+  }
+  auto d = mfem::Vector(K.Height());
+  auto dref = mfem::Vector(K.Height());
+  J.AssembleDiagonal(d);
+  K.GetDiag(dref);
+  success = compareValues(getValues(d), getValues(dref), eps,
+                          "UseMatrixFreeJacobian (diagonal)") &&
+            success;
+  // line searches shall be rejected, since the tangent operator blocks would
+  // be overwritten by the integrations of the behaviours at trial points
+  try {
+    problem->setSolverParameters({{"LineSearch", "Backtracking"}});
+    mfem_mgis::getErrorStream()
+        << "UseMatrixFreeJacobian: line searches shall be rejected\n";
+    success = false;
+  } catch (const std::runtime_error&) {
+    // expected
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
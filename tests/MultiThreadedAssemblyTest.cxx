@@ -0,0 +1,58 @@
+/*!
+ * \file   tests/MultiThreadedAssemblyTest.cxx
+ * \brief
+ * This test checks that the strategies of multi-threaded assembly (see the
+ * `MultiThreadedAssembly` parameter) lead to the same jacobian matrix, to the
+ * same iterations of the Newton solver and to the same results as the
+ * sequential computation.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  if (!areMultiThreadedComputationsSupported()) {
+    return EXIT_SUCCESS;
+  }
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  if (!sref.status) {
+    return EXIT_FAILURE;
+  }
+  const auto Kref = getJacobianMatrix(*reference);
+  const auto rref = extractResults(*reference);
+  auto success = true;
+  for (const auto* const a : {"ElementColouring", "PrivateBuffers", "None"}) {
+    for (const auto scatter_maps : {false, true}) {
+      const auto msg = "MultiThreadedAssembly (" + std::string{a} +
+                       (scatter_maps ? ", with scatter maps)" : ")");
+      auto problem = buildUniaxialTensileTest(
+          p,
+          {{"NumberOfThreads", p.number_of_threads},
+           {"MultiThreadedAssembly", a},
+           {"UseScatterMaps", scatter_maps}},
+          {});
+      const auto s = solve(*problem, t0, t1, nsteps);
+      if (!s.status) {
+        mfem_mgis::getErrorStream() << msg << ": non convergence\n";
+        success = false;
+        continue;
+      }
+      success = compareNumberOfIterations(s, sref, msg) && success;
+      success = compareResults(extractResults(*problem), rref, msg) && success;
+      success =
+          compareMatrices(getJacobianMatrix(*problem), Kref, 1e-12, msg) &&
+          success;
+    }
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,47 @@
+/*!
+ * \file   tests/MultiThreadedIntegrationTest.cxx
+ * \brief
+ * This test checks that integrating the behaviours using several threads
+ * (see the `NumberOfThreads` parameter) leads to the same iterations of the
+ * Newton solver, to the same jacobian matrix and to the same results as the
+ * sequential integration.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  if (!areMultiThreadedComputationsSupported()) {
+    return EXIT_SUCCESS;
+  }
+  // the assembly is kept sequential, so that only the integration of the
+  // behaviours is performed by several threads
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  auto problem = buildUniaxialTensileTest(
+      p,
+      {{"NumberOfThreads", p.number_of_threads},
+       {"MultiThreadedAssembly", "None"}},
+      {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return EXIT_FAILURE;
+  }
+  auto success = compareNumberOfIterations(s, sref, "NumberOfThreads");
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference), "NumberOfThreads") &&
+            success;
+  success = compareMatrices(getJacobianMatrix(*problem),
+                            getJacobianMatrix(*reference), 1e-12,
+                            "NumberOfThreads") &&
+            success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
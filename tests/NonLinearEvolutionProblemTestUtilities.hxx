@@ -0,0 +1,404 @@
+/*!
+ * \file   NonLinearEvolutionProblemTestUtilities.hxx
+ * \brief
+ * This file gathers utilities used by the tests of the features of the non
+ * linear evolution problem and of the Newton solver. Those tests are based on
+ * a small uniaxial tensile test whose results are compared to the ones
+ * obtained using the default settings.
+ *
+ * The loading is monotonic and the state of the material is homogeneous, so
+ * that the results of the plasticity behaviour do not depend on the time
+ * discretisation.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#ifndef LIB_MFEM_MGIS_NONLINEAREVOLUTIONPROBLEMTESTUTILITIES_HXX
+#define LIB_MFEM_MGIS_NONLINEAREVOLUTIONPROBLEMTESTUTILITIES_HXX
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <algorithm>
+#include "mfem/general/optparser.hpp"
+#include "mfem/linalg/sparsemat.hpp"
+#include "mfem/linalg/solvers.hpp"
+#include "MFEMMGIS/Config.hxx"
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/Parameters.hxx"
+#include "MFEMMGIS/Material.hxx"
+#include "MFEMMGIS/UniformDirichletBoundaryCondition.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblemImplementation.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+
+namespace mfem_mgis::unit_tests {
+
+  struct FeatureTestParameters {
+    const char* mesh_file = nullptr;
+    const char* library = nullptr;
+    const char* behaviour = "Plasticity";
+    int number_of_threads = 1;
+    int finite_element_order = 1;
+  };  // end of struct FeatureTestParameters
+
+  //! \brief results of a resolution at the end of the last time step
+  struct FeatureTestResults {
+    //! \brief unknowns
+    std::vector<real> u;
+    //! \brief thermodynamic forces
+    std::vector<real> thermodynamic_forces;
+    //! \brief internal state variables
+    std::vector<real> internal_state_variables;
+  };  // end of struct FeatureTestResults
+
+  //! \brief statistics of the resolution of a sequence of time steps
+  struct ResolutionStatistics {
+    //! \brief status of the resolution
+    bool status = true;
+    //! \brief number of iterations of the Newton solver at each time step
+    std::vector<size_type> iterations;
+    //! \brief total number of iterations of the linear solver
+    size_type linear_solver_iterations = size_type{};
+    /*!
+     * \brief total estimate of the number of iterations of the linear solver
+     * saved by the choice of the forcing terms
+     */
+    size_type estimated_saved_linear_solver_iterations = size_type{};
+    //! \brief output of the last resolution
+    NonLinearResolutionOutput last_output;
+  };  // end of struct ResolutionStatistics
+
+  /*!
+   * \brief a conjugate gradient solver counting the number of operators
+   * passed to it, i.e. the number of updates of the jacobian matrix by the
+   * Newton solver. This solver also records the largest relative tolerance
+   * used by its resolutions, which may be modified by the Newton solver (see
+   * the `ForcingTerm` parameter).
+   */
+  struct CountingCGSolver final : mfem::CGSolver {
+    //! \brief default constructor
+    CountingCGSolver() {
+      this->SetPrintLevel(0);
+      this->SetAbsTol(1e-12);
+      this->SetRelTol(1e-12);
+      this->SetMaxIter(300);
+    }  // end of CountingCGSolver
+    //
+    void SetOperator(const mfem::Operator& op) override {
+      ++(this->number_of_operators);
+      mfem::CGSolver::SetOperator(op);
+    }  // end of SetOperator
+    //
+    void Mult(const mfem::Vector& b, mfem::Vector& x) const override {
+      this->maximum_relative_tolerance =
+          std::max(this->maximum_relative_tolerance, this->rel_tol);
+      mfem::CGSolver::Mult(b, x);
+    }  // end of Mult
+    //! \return the current relative tolerance
+    real getRelativeTolerance() const { return this->rel_tol; }
+    //! \brief number of operators passed to the solver
+    size_type number_of_operators = size_type{};
+    //! \brief largest relative tolerance used by the resolutions
+    mutable real maximum_relative_tolerance = real{0};
+  };  // end of struct CountingCGSolver
+
+  //! \brief initial time
+  static constexpr const auto t0 = real{0};
+  //! \brief final time
+  static constexpr const auto t1 = real{0.3};
+  //! \brief default number of time steps
+  static constexpr const auto nsteps = size_type{10};
+  //! \brief Young modulus of the plasticity behaviour
+  static constexpr const auto young_modulus = real{70e9};
+
+  [[maybe_unused]] static void parseCommandLineOptions(
+      FeatureTestParameters& params, int argc, char** argv) {
+    mfem::OptionsParser args(argc, argv);
+    args.AddOption(&params.mesh_file, "-m", "--mesh", "Mesh file to use.");
+    args.AddOption(&params.library, "-l", "--library", "Material library.");
+    args.AddOption(&params.behaviour, "-b", "--behaviour",
+                   "Name of the behaviour.");
+    args.AddOption(&params.number_of_threads, "-n", "--number-of-threads",
+                   "Number of threads.");
+    args.AddOption(&params.finite_element_order, "-o", "--order",
+                   "Finite element order.");
+    args.Parse();
+    if ((!args.Good()) || (params.mesh_file == nullptr) ||
+        (params.library == nullptr)) {
+      args.PrintUsage(getOutputStream());
+      mfem_mgis::abort(EXIT_FAILURE);
+    }
+  }  // end of parseCommandLineOptions
+
+  /*!
+   * \return a uniaxial tensile test
+   * \param[in] p: test parameters
+   * \param[in] problem_options: additional parameters of the problem
+   * \param[in] solver_options: additional parameters of the solver
+   */
+  [[maybe_unused]] static std::unique_ptr<NonLinearEvolutionProblem>
+  buildUniaxialTensileTest(const FeatureTestParameters& p,
+                           const Parameters& problem_options,
+                           const Parameters& solver_options) {
+    constexpr const auto dim = size_type{3};
+    auto problem_parameters =
+        Parameters{{"MeshFileName", p.mesh_file},
+                   {"FiniteElementFamily", "H1"},
+                   {"FiniteElementOrder", p.finite_element_order},
+                   {"UnknownsSize", dim},
+                   {"NumberOfUniformRefinements", 2},
+                   {"Hypothesis", "Tridimensional"},
+                   {"Parallel", false}};
+    problem_parameters.insert(problem_options);
+    auto problem =
+        std::make_unique<NonLinearEvolutionProblem>(problem_parameters);
+    problem->addBehaviourIntegrator("Mechanics", 1, p.library, p.behaviour);
+    auto& m1 = problem->getMaterial(1);
+    mgis::behaviour::setExternalStateVariable(m1.s0, "Temperature", 293.15);
+    mgis::behaviour::setExternalStateVariable(m1.s1, "Temperature", 293.15);
+    // boundary conditions (see UniaxialTensileTest.cxx)
+    const auto fed = problem->getFiniteElementDiscretizationPointer();
+    problem->addBoundaryCondition(
+        std::make_unique<UniformDirichletBoundaryCondition>(fed, 1, 1));
+    problem->addBoundaryCondition(
+        std::make_unique<UniformDirichletBoundaryCondition>(fed, 2, 2));
+    problem->addBoundaryCondition(
+        std::make_unique<UniformDirichletBoundaryCondition>(fed, 5, 0));
+    problem->addBoundaryCondition(
+        std::make_unique<UniformDirichletBoundaryCondition>(
+            fed, 3, 0, [](const auto t) { return 3e-2 * t; }));
+    // solver parameters
+    problem->setLinearSolver("CGSolver", {{"VerbosityLevel", 0},
+                                          {"AbsoluteTolerance", 1e-12},
+                                          {"RelativeTolerance", 1e-12},
+                                          {"MaximumNumberOfIterations", 300}});
+    auto solver_parameters = Parameters{{"VerbosityLevel", 0},
+                                        {"RelativeTolerance", 1e-12},
+                                        {"AbsoluteTolerance", 1e-2},
+                                        {"MaximumNumberOfIterations", 50}};
+    solver_parameters.insert(solver_options);
+    problem->setSolverParameters(solver_parameters);
+    return problem;
+  }  // end of buildUniaxialTensileTest
+
+  /*!
+   * \brief solve the problem using a constant time step
+   * \return the statistics of the resolution
+   * \param[in] problem: non linear evolution problem
+   * \param[in] ta: initial time
+   * \param[in] tb: final time
+   * \param[in] n: number of time steps
+   */
+  [[maybe_unused]] static ResolutionStatistics solve(
+      NonLinearEvolutionProblem& problem,
+      const real ta,
+      const real tb,
+      const size_type n) {
+    auto s = ResolutionStatistics{};
+    const auto dt = (tb - ta) / n;
+    auto t = ta;
+    for (size_type i = 0; i != n; ++i) {
+      s.last_output = problem.solve(t, dt);
+      if (!s.last_output.status) {
+        getErrorStream() << "non convergence at time " << t << '\n';
+        s.status = false;
+        return s;
+      }
+      s.iterations.push_back(s.last_output.iterations);
+      s.linear_solver_iterations += s.last_output.linear_solver_iterations;
+      s.estimated_saved_linear_solver_iterations +=
+          s.last_output.estimated_saved_linear_solver_iterations;
+      problem.update();
+      t += dt;
+    }
+    return s;
+  }  // end of solve
+
+  /*!
+   * \return the conjugate gradient solver used by the given problem, which
+   * counts the number of updates of the jacobian matrix.
+   * \param[in] problem: non linear evolution problem
+   */
+  [[maybe_unused]] static CountingCGSolver& setCountingCGSolver(
+      NonLinearEvolutionProblem& problem) {
+    auto s = std::make_unique<CountingCGSolver>();
+    auto& r = *s;
+    problem.getImplementation<false>().updateLinearSolver(std::move(s));
+    return r;
+  }  // end of setCountingCGSolver
+
+  //! \return the total number of iterations of the Newton solver
+  [[maybe_unused]] static size_type getTotalNumberOfIterations(
+      const ResolutionStatistics& s) {
+    return std::accumulate(s.iterations.begin(), s.iterations.end(),
+                           size_type{});
+  }  // end of getTotalNumberOfIterations
+
+  //! \return the results at the end of the last time step
+  [[maybe_unused]] static FeatureTestResults extractResults(
+      const NonLinearEvolutionProblem& problem) {
+    auto r = FeatureTestResults{};
+    const auto& u = problem.getUnknownsAtEndOfTheTimeStep();
+    r.u.assign(u.GetData(), u.GetData() + u.Size());
+    const auto& m1 = problem.getMaterial(1);
+    r.thermodynamic_forces.assign(m1.s1.thermodynamic_forces.begin(),
+                                  m1.s1.thermodynamic_forces.end());
+    r.internal_state_variables.assign(m1.s1.internal_state_variables.begin(),
+                                      m1.s1.internal_state_variables.end());
+    return r;
+  }  // end of extractResults
+
+  /*!
+   * \return true if the given values are equal to the reference values
+   * \param[in] v: values
+   * \param[in] vref: reference values
+   * \param[in] eps: absolute tolerance
+   * \param[in] msg: description of the values
+   */
+  [[maybe_unused]] static bool compareValues(const std::vector<real>& v,
+                                             const std::vector<real>& vref,
+                                             const real eps,
+                                             const std::string& msg) {
+    if (v.size() != vref.size()) {
+      getErrorStream() << msg << ": invalid number of values\n";
+      return false;
+    }
+    for (std::vector<real>::size_type i = 0; i != v.size(); ++i) {
+      if (std::abs(v[i] - vref[i]) > eps) {
+        getErrorStream() << msg << ": invalid value (" << v[i] << " vs "
+                         << vref[i] << ", error "
+                         << std::abs(v[i] - vref[i]) << ")\n";
+        return false;
+      }
+    }
+    return true;
+  }  // end of compareValues
+
+  /*!
+   * \return true if the given results are equal to the reference results
+   * \param[in] r: results
+   * \param[in] ref: reference results
+   * \param[in] msg: description of the results
+   */
+  [[maybe_unused]] static bool compareResults(const FeatureTestResults& r,
+                                              const FeatureTestResults& ref,
+                                              const std::string& msg) {
+    constexpr const auto eps = real(1.e-10);
+    const auto bu = compareValues(r.u, ref.u, eps, msg + " (unknowns)");
+    const auto bf = compareValues(r.thermodynamic_forces,
+                                  ref.thermodynamic_forces,
+                                  young_modulus * eps,
+                                  msg + " (thermodynamic forces)");
+    const auto bi = compareValues(r.internal_state_variables,
+                                  ref.internal_state_variables, eps,
+                                  msg + " (internal state variables)");
+    return bu && bf && bi;
+  }  // end of compareResults
+
+  /*!
+   * \return true if the given numbers of iterations are equal
+   * \param[in] s: statistics of the resolution
+   * \param[in] sref: statistics of the reference resolution
+   * \param[in] msg: description of the resolution
+   */
+  [[maybe_unused]] static bool compareNumberOfIterations(
+      const ResolutionStatistics& s,
+      const ResolutionStatistics& sref,
+      const std::string& msg) {
+    if (s.iterations != sref.iterations) {
+      getErrorStream() << msg << ": invalid number of iterations ("
+                       << getTotalNumberOfIterations(s) << " vs "
+                       << getTotalNumberOfIterations(sref) << ")\n";
+      return false;
+    }
+    return true;
+  }  // end of compareNumberOfIterations
+
+  /*!
+   * \return the jacobian matrix assembled from the tangent operators computed
+   * by the last integration of the behaviours.
+   * \param[in] problem: non linear evolution problem
+   *
+   * \note the rows and the columns associated with the degrees of freedom
+   * handled by Dirichlet boundary conditions are eliminated.
+   */
+  [[maybe_unused]] static mfem::SparseMatrix getJacobianMatrix(
+      NonLinearEvolutionProblem& problem) {
+    auto& pb = problem.getImplementation<false>();
+    const auto& u = problem.getUnknownsAtEndOfTheTimeStep();
+    const auto* const K =
+        dynamic_cast<const mfem::SparseMatrix*>(&(pb.GetGradient(u)));
+    if (K == nullptr) {
+      mfem_mgis::abort(
+          "getJacobianMatrix: the jacobian is not a sparse matrix");
+    }
+    return mfem::SparseMatrix(*K);
+  }  // end of getJacobianMatrix
+
+  /*!
+   * \return true if the entries of the given matrix are equal to the ones of
+   * the reference matrix, up to a tolerance relative to the largest entry of
+   * the reference matrix.
+   * \param[in] K: matrix
+   * \param[in] Kref: reference matrix
+   * \param[in] eps: relative tolerance
+   * \param[in] msg: description of the matrix
+   */
+  [[maybe_unused]] static bool compareMatrices(const mfem::SparseMatrix& K,
+                                               const mfem::SparseMatrix& Kref,
+                                               const real eps,
+                                               const std::string& msg) {
+    if ((K.Height() != Kref.Height()) || (K.Width() != Kref.Width())) {
+      getErrorStream() << msg << ": invalid matrix size\n";
+      return false;
+    }
+    const auto tolerance = eps * Kref.MaxNorm();
+    // check that the entries of A are equal to the ones of B. Entries which
+    // are not stored in B are null.
+    auto compare = [&tolerance, &msg](const mfem::SparseMatrix& A,
+                                      const mfem::SparseMatrix& B) {
+      for (int i = 0; i != A.Height(); ++i) {
+        const auto* const columns = A.GetRowColumns(i);
+        const auto* const values = A.GetRowEntries(i);
+        for (int j = 0; j != A.RowSize(i); ++j) {
+          const auto v = B.Elem(i, columns[j]);
+          if (std::abs(v - values[j]) > tolerance) {
+            getErrorStream() << msg << ": invalid entry (" << i << ", "
+                             << columns[j] << ") (" << values[j] << " vs "
+                             << v << ")\n";
+            return false;
+          }
+        }
+      }
+      return true;
+    };
+    return compare(K, Kref) && compare(Kref, K);
+  }  // end of compareMatrices
+
+  //! \return the results obtained with the default settings
+  [[maybe_unused]] static FeatureTestResults computeReferenceResults(
+      const FeatureTestParameters& p) {
+    auto problem = buildUniaxialTensileTest(p, {}, {});
+    if (!solve(*problem, t0, t1, nsteps).status) {
+      mfem_mgis::abort("computeReferenceResults: non convergence");
+    }
+    return extractResults(*problem);
+  }  // end of computeReferenceResults
+
+  //! \return true if multi-threaded computations are supported
+  [[maybe_unused]] static bool areMultiThreadedComputationsSupported() {
+#if defined _OPENMP && defined MFEM_THREAD_SAFE
+    return true;
+#else  /* defined _OPENMP && defined MFEM_THREAD_SAFE */
+    getOutputStream()
+        << "multi-threaded computations are not supported, test skipped\n";
+    return false;
+#endif /* defined _OPENMP && defined MFEM_THREAD_SAFE */
+  }  // end of areMultiThreadedComputationsSupported
+
+}  // end of namespace mfem_mgis::unit_tests
+
+#endif /* LIB_MFEM_MGIS_NONLINEAREVOLUTIONPROBLEMTESTUTILITIES_HXX */
@@ -0,0 +1,92 @@
+/*!
+ * \file   tests/PartialQuadratureSpaceTest.cxx
+ * \brief
+ * This test checks the partial quadrature spaces built from the partition of
+ * the elements by material: the elements, the offsets of the elements and
+ * the number of integration points are compared to the ones given by a
+ * traversal of all the elements of the mesh for each material.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <stdexcept>
+#include "mfem/fem/intrules.hpp"
+#include "mfem/fem/fespace.hpp"
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/Parameters.hxx"
+#include "MFEMMGIS/FiniteElementDiscretization.hxx"
+#include "MFEMMGIS/PartialQuadratureSpace.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+static bool checkQuadratureSpaces(const FeatureTestParameters& p) {
+  using size_type = mfem_mgis::size_type;
+  constexpr const auto dim = size_type{3};
+  // the offsets of the quadrature spaces, built from the partition of the
+  // elements by material, are compared to the ones given by a traversal of
+  // all the elements of the mesh for each material
+  const auto fed = std::make_shared<mfem_mgis::FiniteElementDiscretization>(
+      mfem_mgis::Parameters{{"MeshFileName", p.mesh_file},
+                            {"FiniteElementFamily", "H1"},
+                            {"FiniteElementOrder", 2},
+                            {"UnknownsSize", dim},
+                            {"Parallel", false}});
+  // this integration rule depends on the element transformation
+  const auto irs = [](const mfem::FiniteElement& e,
+                      const mfem::ElementTransformation& tr)
+      -> const mfem::IntegrationRule& {
+    return mfem::IntRules.Get(e.GetGeomType(), 2 * e.GetOrder() + tr.OrderW());
+  };
+  const auto& fespace = fed->getFiniteElementSpace<false>();
+  const auto& mesh = fed->getMesh<false>();
+  auto success = true;
+  auto report = [&success](const size_type id, const std::string& msg) {
+    mfem_mgis::getErrorStream()
+        << "QuadratureSpaces: " << msg << " for material " << id << '\n';
+    success = false;
+  };
+  for (int a = 0; a != mesh.attributes.Size(); ++a) {
+    const auto id = static_cast<size_type>(mesh.attributes[a]);
+    mfem_mgis::PartialQuadratureSpace qspace(*fed, id, irs);
+    auto elements = std::vector<size_type>{};
+    auto ng = size_type{};
+    for (size_type i = 0; i != fespace.GetNE(); ++i) {
+      if (fespace.GetAttribute(i) != id) {
+        // elements which do not belong to the material have no offset
+        try {
+          static_cast<void>(qspace.getOffset(i));
+          report(id, "unexpected offset for element " + std::to_string(i));
+        } catch (const std::runtime_error&) {
+          // expected
+        }
+        continue;
+      }
+      elements.push_back(i);
+      if (qspace.getOffset(i) != ng) {
+        report(id, "invalid offset of element " + std::to_string(i));
+      }
+      const auto& tr = *(fespace.GetElementTransformation(i));
+      ng += irs(*(fespace.GetFE(i)), tr).GetNPoints();
+    }
+    if (elements != qspace.getElements()) {
+      report(id, "invalid elements");
+    }
+    if (ng != qspace.getNumberOfIntegrationPoints()) {
+      report(id, "invalid number of integration points");
+    }
+  }
+  return success;
+}  // end of checkQuadratureSpaces
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  const auto success = checkQuadratureSpaces(p);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
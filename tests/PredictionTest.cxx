@@ -0,0 +1,70 @@
+/*!
+ * \file   tests/PredictionTest.cxx
+ * \brief
+ * This test checks the prediction of the unknowns at the end of the time
+ * step (see the `PredictionPolicy` parameter of the solver):
+ *
+ * - the prediction does not change the results.
+ * - the prediction reduces the number of iterations of the Newton solver.
+ * - in the elastic range, the prediction is exact and no iteration of the
+ *   Newton solver is required.
+ * - the prediction is not altered by the Jacobian-free Newton-Krylov method.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  if (!solve(*reference, t0, t1, nsteps).status) {
+    return EXIT_FAILURE;
+  }
+  const auto rref = extractResults(*reference);
+  auto success = true;
+  for (const auto jfnk : {false, true}) {
+    // the prediction is compared to a resolution using the same method to
+    // compute the Newton corrections
+    auto without_prediction = buildUniaxialTensileTest(
+        p, {}, {{"JacobianFreeNewtonKrylov", jfnk}});
+    const auto sref = solve(*without_prediction, t0, t1, nsteps);
+    if (!sref.status) {
+      return EXIT_FAILURE;
+    }
+    for (const auto* const policy : {"ElasticOperator", "TangentOperator"}) {
+      const auto msg = "PredictionPolicy (" + std::string{policy} +
+                       (jfnk ? ", JacobianFreeNewtonKrylov)" : ")");
+      auto problem = buildUniaxialTensileTest(
+          p, {},
+          {{"PredictionPolicy", policy}, {"JacobianFreeNewtonKrylov", jfnk}});
+      const auto s = solve(*problem, t0, t1, nsteps);
+      if (!s.status) {
+        return EXIT_FAILURE;
+      }
+      success = compareResults(extractResults(*problem), rref, msg) && success;
+      // the first time step is elastic
+      if (s.iterations.front() != 0) {
+        mfem_mgis::getErrorStream()
+            << msg << ": invalid prediction in the elastic range ("
+            << s.iterations.front() << " iterations)\n";
+        success = false;
+      }
+      if (getTotalNumberOfIterations(s) >= getTotalNumberOfIterations(sref)) {
+        mfem_mgis::getErrorStream()
+            << msg << ": the prediction did not reduce the number of "
+            << "iterations (" << getTotalNumberOfIterations(s) << " vs "
+            << getTotalNumberOfIterations(sref) << ")\n";
+        success = false;
+      }
+    }
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,155 @@
+/*!
+ * \file   tests/RotationMatrixCacheTest.cxx
+ * \brief
+ * This test checks the rotation matrices of an orthotropic material whose
+ * axes are defined by partial quadrature functions. Those rotation matrices
+ * are computed once for all at each integration point by the
+ * `setRotationMatrix` method of the `Material` class.
+ *
+ * The material axes are uniform, so that the results must be the ones
+ * obtained when the axes are given as fixed directions:
+ *
+ * - the rotation matrices are the same at each integration point.
+ * - the iterations of the Newton solver, the results and the jacobian matrix
+ *   are the same.
+ * - the rotation matrices are updated by a new call to the
+ *   `setRotationMatrix` method after a modification of the axes.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cmath>
+#include <array>
+#include <memory>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/Material.hxx"
+#include "MFEMMGIS/RotationMatrix.hxx"
+#include "MFEMMGIS/PartialQuadratureFunction.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+//! \brief first material axis
+static constexpr std::array<mfem_mgis::real, 3u> a1 = {0.6, 0.8, 0};
+//! \brief second material axis
+static constexpr std::array<mfem_mgis::real, 3u> a2 = {-0.8, 0.6, 0};
+
+/*!
+ * \return a partial quadrature function on the quadrature space of the given
+ * material, uniformly equal to the given vector
+ * \param[in] m: material
+ * \param[in] v: vector
+ */
+static std::shared_ptr<mfem_mgis::PartialQuadratureFunction> makeAxis(
+    const mfem_mgis::Material& m, const std::array<mfem_mgis::real, 3u>& v) {
+  auto f = std::make_shared<mfem_mgis::PartialQuadratureFunction>(
+      m.getPartialQuadratureSpacePointer(), 3);
+  for (mfem_mgis::size_type i = 0; i != static_cast<mfem_mgis::size_type>(m.n);
+       ++i) {
+    auto values = f->getIntegrationPointValues<3>(i);
+    std::copy(v.begin(), v.end(), values.begin());
+  }
+  return f;
+}  // end of makeAxis
+
+/*!
+ * \return true if the rotation matrices of the given material are equal to
+ * the given one at each integration point, up to rounding errors
+ * \param[in] m: material
+ * \param[in] r: expected rotation matrix
+ * \param[in] msg: description of the check
+ */
+static bool checkRotationMatrices(const mfem_mgis::Material& m,
+                                  const std::array<mfem_mgis::real, 9u>& r,
+                                  const std::string& msg) {
+  for (mfem_mgis::size_type i = 0; i != static_cast<mfem_mgis::size_type>(m.n);
+       ++i) {
+    const auto ri = m.getRotationMatrix(i);
+    if (!std::equal(ri.begin(), ri.end(), r.begin(),
+                    [](const mfem_mgis::real x, const mfem_mgis::real y) {
+                      return std::abs(x - y) < 1e-14;
+                    })) {
+      mfem_mgis::getErrorStream()
+          << msg << ": invalid rotation matrix at integration point " << i
+          << '\n';
+      return false;
+    }
+  }
+  return true;
+}  // end of checkRotationMatrices
+
+/*!
+ * \brief compare the resolution using the given definition of the material
+ * axes by partial quadrature functions to the reference resolution.
+ * \param[in] p: test parameters
+ * \param[in] both: if true, both axes are defined by partial quadrature
+ * functions. Otherwise, only the first one is.
+ */
+static bool checkRotationMatrixCache(const FeatureTestParameters& p,
+                                     const bool both) {
+  using mfem_mgis::MaterialAxis3D;
+  using mfem_mgis::RotationMatrix3D;
+  const auto msg = std::string{both ? "RotationMatrixCache (two functions)"
+                                    : "RotationMatrixCache (one function)"};
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  auto& mref = reference->getMaterial(1);
+  auto& m = problem->getMaterial(1);
+  mref.setRotationMatrix(RotationMatrix3D{
+      std::array<MaterialAxis3D, 2u>{MaterialAxis3D{a1}, MaterialAxis3D{a2}}});
+  const auto f1 = makeAxis(m, a1);
+  const auto f2 = makeAxis(m, a2);
+  m.setRotationMatrix(RotationMatrix3D{std::array<MaterialAxis3D, 2u>{
+      MaterialAxis3D{f1}, both ? MaterialAxis3D{f2} : MaterialAxis3D{a2}}});
+  // the rotation matrix of the reference material is uniform
+  const auto r = mref.getRotationMatrix(0);
+  auto success = checkRotationMatrices(m, r, msg);
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return false;
+  }
+  success = compareNumberOfIterations(s, sref, msg) && success;
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference), msg) &&
+            success;
+  success = compareMatrices(getJacobianMatrix(*problem),
+                            getJacobianMatrix(*reference), 1e-12, msg) &&
+            success;
+  // modification of the material axes: the axes are swapped, which changes
+  // the rotation matrices
+  for (mfem_mgis::size_type i = 0; i != static_cast<mfem_mgis::size_type>(m.n);
+       ++i) {
+    auto v1 = f1->getIntegrationPointValues<3>(i);
+    std::copy(a2.begin(), a2.end(), v1.begin());
+    auto v2 = f2->getIntegrationPointValues<3>(i);
+    std::copy(a1.begin(), a1.end(), v2.begin());
+  }
+  mref.setRotationMatrix(RotationMatrix3D{
+      std::array<MaterialAxis3D, 2u>{MaterialAxis3D{a2}, MaterialAxis3D{a1}}});
+  m.setRotationMatrix(RotationMatrix3D{std::array<MaterialAxis3D, 2u>{
+      MaterialAxis3D{f1}, both ? MaterialAxis3D{f2} : MaterialAxis3D{a1}}});
+  const auto r2 = mref.getRotationMatrix(0);
+  if (r2 == r) {
+    mfem_mgis::getErrorStream()
+        << msg << ": the rotation matrix shall have been modified\n";
+    success = false;
+  }
+  success = checkRotationMatrices(m, r2, msg + " (modified axes)") &&
+            success;
+  return success;
+}  // end of checkRotationMatrixCache
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  p.behaviour = "OrthotropicElasticity";
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto success = checkRotationMatrixCache(p, false);
+  success = checkRotationMatrixCache(p, true) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,71 @@
+/*!
+ * \file   tests/ScatterMapsBenchmark.cxx
+ * \brief
+ * This benchmark measures the time spent in the assembly of the jacobian
+ * matrix:
+ *
+ * - using the scatter maps (see the `UseScatterMaps` parameter), i.e. by
+ *   adding the element stiffness matrices at positions in the values of the
+ *   sparse matrix computed once for all.
+ * - using the `AddSubMatrix` method of the `mfem::SparseMatrix` class, which
+ *   searches the columns of each entry of the element stiffness matrices.
+ *
+ * The jacobian matrices are assembled after the resolution of a uniaxial
+ * tensile test, which is also timed. Both timings include the computation
+ * of the element stiffness matrices, which does not depend on the assembly
+ * method. This benchmark is not part of the test suite.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+//! \brief number of assemblies of the jacobian matrix
+static constexpr const auto number_of_repetitions = 20;
+
+/*!
+ * \brief measure the time spent in the resolution of the uniaxial tensile
+ * test and in the assembly of the jacobian matrix
+ * \param[in] p: benchmark parameters
+ * \param[in] b: use the scatter maps
+ */
+static bool measure(const mfem_mgis::unit_tests::FeatureTestParameters& p,
+                    const bool b) {
+  using namespace mfem_mgis::unit_tests;
+  const auto* const name = b ? "scatter maps" : "AddSubMatrix";
+  auto problem = buildUniaxialTensileTest(p, {{"UseScatterMaps", b}}, {});
+  const auto start = std::chrono::steady_clock::now();
+  if (!solve(*problem, t0, t1, nsteps).status) {
+    return false;
+  }
+  const auto middle = std::chrono::steady_clock::now();
+  auto& pb = problem->getImplementation<false>();
+  const auto& u = problem->getUnknownsAtEndOfTheTimeStep();
+  for (int r = 0; r != number_of_repetitions; ++r) {
+    static_cast<void>(pb.GetGradient(u));
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto dt1 = std::chrono::duration<double>(middle - start).count();
+  const auto dt2 = std::chrono::duration<double>(end - middle).count();
+  mfem_mgis::getOutputStream()
+      << name << ": resolution " << dt1 << "s, assembly " << dt2 << "s ("
+      << number_of_repetitions << " repetitions, "
+      << pb.getFiniteElementSpace().GetTrueVSize() << " unknowns)\n";
+  return true;
+}  // end of measure
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  p.finite_element_order = 2;
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  if ((!measure(p, false)) || (!measure(p, true))) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+/*!
+ * \file   tests/ScatterMapsTest.cxx
+ * \brief
+ * This test checks the assembly of the jacobian matrix using scatter maps
+ * (see the `UseScatterMaps` parameter):
+ *
+ * - the sparsity pattern is built once for all.
+ * - the assembled jacobian matrix is the one assembled by `MFEM`.
+ * - the iterations of the Newton solver and the results are unchanged.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(p, {}, {});
+  auto problem = buildUniaxialTensileTest(p, {{"UseScatterMaps", true}}, {});
+  const auto sref = solve(*reference, t0, t1, nsteps);
+  const auto s = solve(*problem, t0, t1, nsteps);
+  if ((!sref.status) || (!s.status)) {
+    return EXIT_FAILURE;
+  }
+  auto success = compareNumberOfIterations(s, sref, "UseScatterMaps");
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference), "UseScatterMaps") &&
+            success;
+  success = compareMatrices(getJacobianMatrix(*problem),
+                            getJacobianMatrix(*reference), 1e-12,
+                            "UseScatterMaps") &&
+            success;
+  // the jacobian matrix is assembled again in the same sparsity pattern
+  auto& pb = problem->getImplementation<false>();
+  const auto& u = problem->getUnknownsAtEndOfTheTimeStep();
+  const auto* const K1 =
+      dynamic_cast<const mfem::SparseMatrix*>(&(pb.GetGradient(u)));
+  const auto* const J1 = K1->GetJ();
+  const auto* const K2 =
+      dynamic_cast<const mfem::SparseMatrix*>(&(pb.GetGradient(u)));
+  if ((K1 != K2) || (J1 != K2->GetJ())) {
+    mfem_mgis::getErrorStream()
+        << "UseScatterMaps: the sparsity pattern has been rebuilt\n";
+    success = false;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,149 @@
+/*!
+ * \file   tests/SnapshotsTest.cxx
+ * \brief
+ * This test checks the snapshots of the non linear evolution problem (see
+ * the `pushSnapshot`, `restoreSnapshot` and `popSnapshot` methods):
+ *
+ * - a computation resumed from a snapshot gives the same iterations and the
+ *   same results as the first resolution.
+ * - nested snapshots are restored in the reverse order of their creation.
+ * - a snapshot restored before any resolution leaves the state unchanged.
+ * - restoring or removing a snapshot from an empty stack is an error.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cstdlib>
+#include <stdexcept>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+/*!
+ * \return true if the problem has the given number of snapshots
+ * \param[in] problem: non linear evolution problem
+ * \param[in] n: expected number of snapshots
+ */
+static bool checkNumberOfSnapshots(
+    const mfem_mgis::NonLinearEvolutionProblem& problem,
+    const mfem_mgis::size_type n) {
+  if (problem.getNumberOfSnapshots() != n) {
+    mfem_mgis::getErrorStream()
+        << "Snapshots: invalid number of snapshots ("
+        << problem.getNumberOfSnapshots() << " vs " << n << ")\n";
+    return false;
+  }
+  return true;
+}  // end of checkNumberOfSnapshots
+
+static bool checkResumption(const FeatureTestParameters& p) {
+  // the second half of the computation is resumed from a snapshot
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  const auto tm = (t0 + t1) / 2;
+  if (!solve(*problem, t0, tm, nsteps / 2).status) {
+    return false;
+  }
+  problem->pushSnapshot();
+  const auto s1 = solve(*problem, tm, t1, nsteps / 2);
+  if (!s1.status) {
+    return false;
+  }
+  const auto r = extractResults(*problem);
+  problem->restoreSnapshot();
+  problem->popSnapshot();
+  auto success = checkNumberOfSnapshots(*problem, 0);
+  const auto s2 = solve(*problem, tm, t1, nsteps / 2);
+  if (!s2.status) {
+    return false;
+  }
+  success = compareResults(r, computeReferenceResults(p),
+                           "Snapshots (first resolution)") &&
+            success;
+  success =
+      compareResults(extractResults(*problem), r, "Snapshots (resumed)") &&
+      success;
+  success = compareNumberOfIterations(s2, s1, "Snapshots (resumed)") && success;
+  return success;
+}  // end of checkResumption
+
+static bool checkNestedSnapshots(const FeatureTestParameters& p) {
+  const auto dt = (t1 - t0) / nsteps;
+  const auto ta = t0 + 3 * dt;
+  const auto tb = t0 + 6 * dt;
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  // results at the end of the computation
+  auto solveUntilTheEnd = [&problem, dt](const mfem_mgis::real t) {
+    const auto n = static_cast<mfem_mgis::size_type>((t1 - t) / dt + 0.5);
+    if (!solve(*problem, t, t1, n).status) {
+      mfem_mgis::abort("Snapshots: non convergence");
+    }
+    return extractResults(*problem);
+  };
+  if (!solve(*problem, t0, ta, 3).status) {
+    return false;
+  }
+  problem->pushSnapshot();
+  if (!solve(*problem, ta, tb, 3).status) {
+    return false;
+  }
+  problem->pushSnapshot();
+  auto success = checkNumberOfSnapshots(*problem, 2);
+  const auto r = solveUntilTheEnd(tb);
+  // restoring a snapshot twice gives the same state
+  for (mfem_mgis::size_type i = 0; i != 2; ++i) {
+    problem->restoreSnapshot();
+    success = compareResults(solveUntilTheEnd(tb), r,
+                             "Snapshots (inner snapshot)") &&
+              success;
+  }
+  problem->popSnapshot();
+  problem->restoreSnapshot();
+  success = compareResults(solveUntilTheEnd(ta), r,
+                           "Snapshots (outer snapshot)") &&
+            success;
+  // a snapshot restored before any resolution leaves the state unchanged
+  problem->restoreSnapshot();
+  problem->pushSnapshot();
+  problem->restoreSnapshot();
+  problem->popSnapshot();
+  success = compareResults(solveUntilTheEnd(ta), r,
+                           "Snapshots (snapshot restored immediately)") &&
+            success;
+  problem->popSnapshot();
+  success = checkNumberOfSnapshots(*problem, 0) && success;
+  return success;
+}  // end of checkNestedSnapshots
+
+static bool checkEmptyStack(const FeatureTestParameters& p) {
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  auto success = true;
+  try {
+    problem->restoreSnapshot();
+    mfem_mgis::getErrorStream()
+        << "Snapshots: restoring a snapshot from an empty stack shall fail\n";
+    success = false;
+  } catch (const std::runtime_error&) {
+    // expected
+  }
+  try {
+    problem->popSnapshot();
+    mfem_mgis::getErrorStream()
+        << "Snapshots: removing a snapshot from an empty stack shall fail\n";
+    success = false;
+  } catch (const std::runtime_error&) {
+    // expected
+  }
+  return success;
+}  // end of checkEmptyStack
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto success = checkResumption(p);
+  success = checkNestedSnapshots(p) && success;
+  success = checkEmptyStack(p) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
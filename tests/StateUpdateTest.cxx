@@ -0,0 +1,169 @@
+/*!
+ * \file   tests/StateUpdateTest.cxx
+ * \brief
+ * This test checks the update and the revert of the states of the materials,
+ * which exchange buffers rather than copying values (see the
+ * `Material::updateStates` and `Material::revertStates` methods):
+ *
+ * - reverting a time step restores the state at the beginning of the time
+ *   step.
+ * - the state at the end of the time step does not hold stale values after
+ *   an update: in the elastic range, the prediction based on the elastic
+ *   operator is exact.
+ * - after an update, the states at the beginning and at the end of the time
+ *   step are aliases until the next resolution: values written in the state
+ *   at the end of the time step are the ones used at the beginning of the
+ *   next time step.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/Material.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+static bool checkUpdateRevert(const FeatureTestParameters& p) {
+  // each time step is first solved with a wrong time increment and reverted
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  const auto dt = (t1 - t0) / nsteps;
+  auto t = t0;
+  for (mfem_mgis::size_type i = 0; i != nsteps; ++i) {
+    if (!problem->solve(t, 2 * dt)) {
+      mfem_mgis::getErrorStream() << "UpdateRevert: non convergence\n";
+      return false;
+    }
+    problem->revert();
+    if (!problem->solve(t, dt)) {
+      mfem_mgis::getErrorStream() << "UpdateRevert: non convergence\n";
+      return false;
+    }
+    problem->update();
+    t += dt;
+  }
+  return compareResults(extractResults(*problem), computeReferenceResults(p),
+                        "UpdateRevert");
+}  // end of checkUpdateRevert
+
+static bool checkPredictionAfterUpdate(const FeatureTestParameters& p) {
+  // In the elastic range, the prediction based on the elastic operator is
+  // exact, and no iteration of the Newton solver is required. This is only
+  // true if the thermodynamic forces at the end of the time step used to
+  // compute the prediction are the ones of the beginning of the time step,
+  // i.e. if no stale values are left by the update of the state.
+  auto problem = buildUniaxialTensileTest(
+      p, {}, {{"PredictionPolicy", "ElasticOperator"}});
+  const auto dt = mfem_mgis::real{0.01};
+  auto t = t0;
+  for (mfem_mgis::size_type i = 0; i != 3; ++i) {
+    const auto output = problem->solve(t, dt);
+    if (!output.status) {
+      mfem_mgis::getErrorStream() << "PredictionAfterUpdate: non convergence\n";
+      return false;
+    }
+    if (output.iterations != 0) {
+      mfem_mgis::getErrorStream()
+          << "PredictionAfterUpdate: invalid prediction at time " << t << " ("
+          << output.iterations << " iterations)\n";
+      return false;
+    }
+    problem->update();
+    t += dt;
+  }
+  return true;
+}  // end of checkPredictionAfterUpdate
+
+/*!
+ * \return true if the equivalent plastic strain has the given value at all
+ * integration points of the given state
+ * \param[in] m: material
+ * \param[in] s: state
+ * \param[in] v: expected value
+ * \param[in] msg: description of the check
+ */
+static bool checkEquivalentPlasticStrain(
+    const mfem_mgis::Material& m,
+    const mfem_mgis::Material::StateSelection s,
+    const mfem_mgis::real v,
+    const char* const msg) {
+  const auto f = getInternalStateVariable(m, "EquivalentPlasticStrain", s);
+  for (mfem_mgis::size_type i = 0; i != m.n; ++i) {
+    const auto pv = f.getIntegrationPointValues(i)[0];
+    if (std::abs(pv - v) > 1e-14) {
+      mfem_mgis::getErrorStream()
+          << "StateAliasing: " << msg << " (" << pv << " vs " << v << ")\n";
+      return false;
+    }
+  }
+  return true;
+}  // end of checkEquivalentPlasticStrain
+
+static bool checkStateAliasing(const FeatureTestParameters& p) {
+  using mfem_mgis::Material;
+  constexpr const auto pv = mfem_mgis::real{1e-3};
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  auto& m = problem->getMaterial(1);
+  const auto dt = mfem_mgis::real{0.01};
+  if (!problem->solve(t0, dt)) {
+    return false;
+  }
+  problem->update();
+  if (m.s0.internal_state_variables.data() !=
+      m.s1.internal_state_variables.data()) {
+    mfem_mgis::getErrorStream()
+        << "StateAliasing: the states are not shared after the update\n";
+    return false;
+  }
+  // initialise the equivalent plastic strain through the state at the end
+  // of the time step
+  auto f = getInternalStateVariable(m, "EquivalentPlasticStrain",
+                                    Material::END_OF_TIME_STEP);
+  for (mfem_mgis::size_type i = 0; i != m.n; ++i) {
+    f.getIntegrationPointValues(i)[0] = pv;
+  }
+  auto success = checkEquivalentPlasticStrain(
+      m, Material::BEGINNING_OF_TIME_STEP, pv,
+      "the value written after the update is not the one of the beginning of "
+      "the time step");
+  // the next time step is elastic: the equivalent plastic strain is kept
+  if (!problem->solve(t0 + dt, dt)) {
+    return false;
+  }
+  if (m.s0.internal_state_variables.data() ==
+      m.s1.internal_state_variables.data()) {
+    mfem_mgis::getErrorStream()
+        << "StateAliasing: the states are still shared after a resolution\n";
+    success = false;
+  }
+  success = checkEquivalentPlasticStrain(
+                m, Material::BEGINNING_OF_TIME_STEP, pv,
+                "invalid value at the beginning of the time step") &&
+            success;
+  success = checkEquivalentPlasticStrain(
+                m, Material::END_OF_TIME_STEP, pv,
+                "invalid value at the end of the time step") &&
+            success;
+  // after a revert, both states are shared again
+  problem->revert();
+  if (m.s0.internal_state_variables.data() !=
+      m.s1.internal_state_variables.data()) {
+    mfem_mgis::getErrorStream()
+        << "StateAliasing: the states are not shared after the revert\n";
+    success = false;
+  }
+  return success;
+}  // end of checkStateAliasing
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto success = checkUpdateRevert(p);
+  success = checkPredictionAfterUpdate(p) && success;
+  success = checkStateAliasing(p) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,79 @@
+/*!
+ * \file   tests/SumFactorisationBenchmark.cxx
+ * \brief
+ * This benchmark measures the time spent in the computation of the product of
+ * the element stiffness matrices by a vector on high-order hexahedra:
+ *
+ * - by sum factorisation (see the `updateJacobianAction` method of the
+ *   behaviour integrators).
+ * - by building the element stiffness matrices and multiplying them by the
+ *   vector.
+ *
+ * The products are computed after the resolution of a uniaxial tensile test.
+ * This benchmark is not part of the test suite.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/BehaviourIntegrator.hxx"
+#include "MFEMMGIS/PartialQuadratureSpace.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+//! \brief number of products computed on each element
+static constexpr const auto number_of_repetitions = 100;
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  p.finite_element_order = 3;
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  if (!solve(*problem, t0, t1, 1).status) {
+    return EXIT_FAILURE;
+  }
+  auto& pb = problem->getImplementation<false>();
+  const auto& fes = pb.getFiniteElementSpace();
+  auto& bi = pb.getBehaviourIntegrator(1);
+  const auto& elements = bi.getPartialQuadratureSpace().getElements();
+  auto Ke = mfem::DenseMatrix{};
+  auto Xe = mfem::Vector{};
+  auto Ye = mfem::Vector{};
+  auto ue = mfem::Vector{};
+  // measure the time spent in the given functor, called on each element
+  auto measure = [&](const char* const name, const auto& f) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r != number_of_repetitions; ++r) {
+      for (const auto i : elements) {
+        const auto& e = *(fes.GetFE(i));
+        auto& tr = *(fes.GetElementTransformation(i));
+        const auto n = e.GetDof() * fes.GetVDim();
+        ue.SetSize(n);
+        ue = mfem_mgis::real{0};
+        Xe.SetSize(n);
+        Xe = mfem_mgis::real{1};
+        f(e, tr);
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const auto dt = std::chrono::duration<double>(end - start).count();
+    mfem_mgis::getOutputStream()
+        << name << ": " << dt << "s (" << elements.size() << " elements, "
+        << number_of_repetitions << " repetitions)\n";
+  };
+  measure("sum factorisation",
+          [&](const mfem::FiniteElement& e, mfem::ElementTransformation& tr) {
+            bi.updateJacobianAction(Ye, e, tr, ue, Xe);
+          });
+  measure("element stiffness matrix",
+          [&](const mfem::FiniteElement& e, mfem::ElementTransformation& tr) {
+            bi.updateJacobian(Ke, e, tr, ue);
+            Ye.SetSize(Ke.Height());
+            Ke.Mult(Xe, Ye);
+          });
+  return EXIT_SUCCESS;
+}
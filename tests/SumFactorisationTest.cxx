@@ -0,0 +1,85 @@
+/*!
+ * \file   tests/SumFactorisationTest.cxx
+ * \brief
+ * This test checks that, on high-order hexahedra, the product of the element
+ * stiffness matrix by a vector computed by sum factorisation (see the
+ * `updateJacobianAction` method of the behaviour integrators) is equal to the
+ * product of the element stiffness matrix by this vector.
+ *
+ * The test is run after the resolution of a uniaxial tensile test, so that the
+ * tangent operators stored at the integration points are the ones of plastic
+ * loadings.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/BehaviourIntegrator.hxx"
+#include "MFEMMGIS/PartialQuadratureSpace.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  if (p.finite_element_order < 2) {
+    mfem_mgis::getErrorStream()
+        << "SumFactorisation: sum factorisation is only used on high-order "
+        << "elements\n";
+    return EXIT_FAILURE;
+  }
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  if (!solve(*problem, t0, t1, nsteps).status) {
+    return EXIT_FAILURE;
+  }
+  auto& pb = problem->getImplementation<false>();
+  const auto& fes = pb.getFiniteElementSpace();
+  auto& bi = pb.getBehaviourIntegrator(1);
+  const auto& qspace = bi.getPartialQuadratureSpace();
+  auto success = true;
+  auto Ke = mfem::DenseMatrix{};
+  auto Xe = mfem::Vector{};
+  auto Ye = mfem::Vector{};
+  auto Yref = mfem::Vector{};
+  auto ue = mfem::Vector{};
+  for (const auto i : qspace.getElements()) {
+    const auto& e = *(fes.GetFE(i));
+    auto& tr = *(fes.GetElementTransformation(i));
+    const auto n = e.GetDof() * fes.GetVDim();
+    // the unknowns are not used: both methods rely on the tangent operators
+    // stored at the integration points
+    ue.SetSize(n);
+    ue = mfem_mgis::real{0};
+    bi.updateJacobian(Ke, e, tr, ue);
+    if ((Ke.Height() != n) || (Ke.Width() != n)) {
+      mfem_mgis::getErrorStream()
+          << "SumFactorisation: invalid element stiffness matrix size\n";
+      return EXIT_FAILURE;
+    }
+    const auto eps = 1e-12 * Ke.MaxMaxNorm() * n;
+    Xe.SetSize(n);
+    Xe.Randomize(static_cast<int>(i) + 1);
+    bi.updateJacobianAction(Ye, e, tr, ue, Xe);
+    Yref.SetSize(n);
+    Ke.Mult(Xe, Yref);
+    if (Ye.Size() != n) {
+      mfem_mgis::getErrorStream()
+          << "SumFactorisation: invalid size of the jacobian action\n";
+      return EXIT_FAILURE;
+    }
+    for (int j = 0; j != n; ++j) {
+      if (std::abs(Ye[j] - Yref[j]) > eps) {
+        mfem_mgis::getErrorStream()
+            << "SumFactorisation: invalid jacobian action on element " << i
+            << " (" << Ye[j] << " vs " << Yref[j] << ")\n";
+        success = false;
+        break;
+      }
+    }
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
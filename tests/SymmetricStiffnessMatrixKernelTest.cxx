@@ -0,0 +1,100 @@
+/*!
+ * \file   tests/SymmetricStiffnessMatrixKernelTest.cxx
+ * \brief
+ * This test checks that the element stiffness matrices computed by the
+ * symmetric kernels of the behaviour integrators are the ones computed by the
+ * generic kernels (see the `UseSymmetricStiffnessMatrixKernel` parameter).
+ *
+ * The jacobian matrices are compared at each time step, since the symmetric
+ * kernels are only used on elements where the tangent operators are
+ * symmetric. The test fails if those kernels are never used.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <cmath>
+#include <limits>
+#include <cstdlib>
+#include <algorithm>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/Material.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+/*!
+ * \return the number of integration points of the given material where the
+ * tangent operator is symmetric, using the same criterion as the behaviour
+ * integrators.
+ * \param[in] m: material
+ */
+static mfem_mgis::size_type countSymmetricTangentOperators(
+    const mfem_mgis::Material& m) {
+  using namespace mfem_mgis;
+  const auto gsize = static_cast<size_type>(m.s1.gradients_stride);
+  const auto ksize = static_cast<size_type>(m.K_stride);
+  if ((gsize != static_cast<size_type>(m.s1.thermodynamic_forces_stride)) ||
+      (ksize != gsize * gsize)) {
+    return 0;
+  }
+  constexpr auto eps = 100 * std::numeric_limits<real>::epsilon();
+  auto count = size_type{};
+  for (size_type i = 0; i != static_cast<size_type>(m.n); ++i) {
+    const auto* const Kip = m.K.data() + i * ksize;
+    auto mv = real{0};
+    for (size_type k = 0; k != ksize; ++k) {
+      mv = std::max(mv, std::abs(Kip[k]));
+    }
+    auto symmetric = true;
+    for (size_type r = 0; (r != gsize) && (symmetric); ++r) {
+      for (size_type c = r + 1; c != gsize; ++c) {
+        if (std::abs(Kip[r * gsize + c] - Kip[c * gsize + r]) > eps * mv) {
+          symmetric = false;
+          break;
+        }
+      }
+    }
+    if (symmetric) {
+      ++count;
+    }
+  }
+  return count;
+}  // end of countSymmetricTangentOperators
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference = buildUniaxialTensileTest(
+      p, {{"UseSymmetricStiffnessMatrixKernel", false}}, {});
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  const auto dt = (t1 - t0) / nsteps;
+  auto success = true;
+  auto nsymmetric = mfem_mgis::size_type{};
+  for (mfem_mgis::size_type i = 0; i != nsteps; ++i) {
+    const auto t = t0 + i * dt;
+    const auto sref = solve(*reference, t, t + dt, 1);
+    const auto s = solve(*problem, t, t + dt, 1);
+    if ((!sref.status) || (!s.status)) {
+      return EXIT_FAILURE;
+    }
+    nsymmetric += countSymmetricTangentOperators(problem->getMaterial(1));
+    success = compareNumberOfIterations(s, sref,
+                                        "UseSymmetricStiffnessMatrixKernel") &&
+              success;
+    success = compareMatrices(getJacobianMatrix(*problem),
+                              getJacobianMatrix(*reference), 1e-12,
+                              "UseSymmetricStiffnessMatrixKernel") &&
+              success;
+  }
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference),
+                           "UseSymmetricStiffnessMatrixKernel") &&
+            success;
+  if (nsymmetric == 0) {
+    mfem_mgis::getErrorStream() << "UseSymmetricStiffnessMatrixKernel: "
+                                << "the symmetric kernel was never used\n";
+    success = false;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,109 @@
+/*!
+ * \file   tests/TimeStepScalingFactorTest.cxx
+ * \brief
+ * This test checks the reporting of the time step scaling factors proposed
+ * by the behaviours (see the `time_step_scaling_factor` and
+ * `time_step_scaling_factors_histogram` members of the
+ * `NonLinearResolutionOutput` class) using a behaviour which proposes to
+ * halve the time step at the integration points where a plastic loading
+ * occurs.
+ *
+ * The uniaxial tensile test is homogeneous: all the integration points are
+ * in the elastic domain during the first time step and are plastic during
+ * the last one. With the batched integration of the behaviours, the
+ * histogram only holds the minimum of the values proposed on the material.
+ * \author Thomas Helfer
+ * \date   16/10/2026
+ */
+
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearResolutionOutput.hxx"
+#include "MFEMMGIS/TimeStepScalingFactorHistogram.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+using namespace mfem_mgis::unit_tests;
+
+/*!
+ * \return true if the given output reports the expected time step scaling
+ * factor in the expected number of values
+ * \param[in] o: output of the resolution
+ * \param[in] rdt: expected time step scaling factor
+ * \param[in] n: expected number of values in the histogram
+ * \param[in] msg: description of the check
+ */
+static bool check(const mfem_mgis::NonLinearResolutionOutput& o,
+                  const mfem_mgis::real rdt,
+                  const mfem_mgis::size_type n,
+                  const std::string& msg) {
+  using Histogram = mfem_mgis::TimeStepScalingFactorHistogram;
+  const auto& h = o.time_step_scaling_factors_histogram;
+  auto success = true;
+  if (o.time_step_scaling_factor != rdt) {
+    mfem_mgis::getErrorStream()
+        << msg << ": invalid time step scaling factor ("
+        << o.time_step_scaling_factor << " vs " << rdt << ")\n";
+    success = false;
+  }
+  if (h.number_of_failures != 0) {
+    mfem_mgis::getErrorStream() << msg << ": unexpected failures\n";
+    success = false;
+  }
+  if ((h.getNumberOfValues() != n) ||
+      (h.counts[Histogram::getBinIndex(rdt)] != n)) {
+    mfem_mgis::getErrorStream()
+        << msg << ": invalid histogram of the time step scaling factors ("
+        << h.counts[Histogram::getBinIndex(rdt)] << " values in the bin of "
+        << rdt << ", " << h.getNumberOfValues() << " values, " << n
+        << " expected)\n";
+    success = false;
+  }
+  return success;
+}  // end of check
+
+/*!
+ * \brief run the uniaxial tensile test and check the time step scaling
+ * factors reported at the first and last time steps
+ * \param[in] p: test parameters
+ * \param[in] batched: use the batched integration of the behaviours
+ */
+static bool checkTimeStepScalingFactors(const FeatureTestParameters& p,
+                                        const bool batched) {
+  const auto msg = std::string{batched ? "TimeStepScalingFactor (batched)"
+                                       : "TimeStepScalingFactor"};
+  auto problem = buildUniaxialTensileTest(
+      p, {{"UseBatchedBehaviourIntegration", batched}}, {});
+  // number of values expected in the histogram
+  const auto n =
+      batched ? mfem_mgis::size_type{1}
+              : static_cast<mfem_mgis::size_type>(problem->getMaterial(1).n);
+  const auto dt = (t1 - t0) / nsteps;
+  auto success = true;
+  for (mfem_mgis::size_type i = 0; i != nsteps; ++i) {
+    const auto t = t0 + i * dt;
+    const auto s = solve(*problem, t, t + dt, 1);
+    if (!s.status) {
+      return false;
+    }
+    if (i == 0) {
+      success = check(s.last_output, 1, n, msg + " (elastic loading)") &&
+                success;
+    } else if (i + 1 == nsteps) {
+      success = check(s.last_output, 0.5, n, msg + " (plastic loading)") &&
+                success;
+    }
+  }
+  return success;
+}  // end of checkTimeStepScalingFactors
+
+int main(int argc, char** argv) {
+  auto p = FeatureTestParameters{};
+  p.behaviour = "PlasticityWithTimeStepScalingFactor";
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto success = checkTimeStepScalingFactors(p, false);
+  success = checkTimeStepScalingFactors(p, true) && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
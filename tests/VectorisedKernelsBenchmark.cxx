@@ -0,0 +1,87 @@
+/*!
+ * \file   tests/VectorisedKernelsBenchmark.cxx
+ * \brief
+ * This benchmark measures the time spent in the computation of the
+ * gradients, of the inner forces and of the element stiffness matrices:
+ *
+ * - by the kernels treating all the nodes of an element at once, whose loop
+ *   over the nodes is vectorised.
+ * - by the per-node kernels (see the `setVectorisedKernelsUsage` method of
+ *   the behaviour integrators).
+ *
+ * The computations are performed after the resolution of a uniaxial tensile
+ * test, using the geometric cache so that the derivatives of the shape
+ * functions are not computed again. This benchmark is not part of the test
+ * suite.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ */
+
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/IntegrationType.hxx"
+#include "MFEMMGIS/BehaviourIntegrator.hxx"
+#include "MFEMMGIS/PartialQuadratureSpace.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+//! \brief number of computations performed on each element
+static constexpr const auto number_of_repetitions = 100;
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto problem =
+      buildUniaxialTensileTest(p, {{"UseGeometricCache", true}}, {});
+  if (!solve(*problem, t0, t1, 1).status) {
+    return EXIT_FAILURE;
+  }
+  auto& pb = problem->getImplementation<false>();
+  const auto& fes = pb.getFiniteElementSpace();
+  auto& bi = pb.getBehaviourIntegrator(1);
+  const auto& elements = bi.getPartialQuadratureSpace().getElements();
+  auto Ke = mfem::DenseMatrix{};
+  auto Fe = mfem::Vector{};
+  auto ue = mfem::Vector{};
+  // measure the time spent in the given functor, called on each element
+  auto measure = [&](const std::string& name, const auto& f) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r != number_of_repetitions; ++r) {
+      for (const auto i : elements) {
+        const auto& e = *(fes.GetFE(i));
+        auto& tr = *(fes.GetElementTransformation(i));
+        ue.SetSize(e.GetDof() * fes.GetVDim());
+        ue = mfem_mgis::real{0};
+        f(e, tr);
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const auto dt = std::chrono::duration<double>(end - start).count();
+    mfem_mgis::getOutputStream()
+        << name << ": " << dt << "s (" << elements.size() << " elements, "
+        << number_of_repetitions << " repetitions)\n";
+  };
+  for (const auto b : {true, false}) {
+    const auto kernels = std::string{b ? "vectorised" : "per-node"};
+    bi.setVectorisedKernelsUsage(b);
+    measure("gradients (" + kernels + " kernels)",
+            [&](const mfem::FiniteElement& e, mfem::ElementTransformation& tr) {
+              bi.computeGradients(
+                  e, tr, ue,
+                  mfem_mgis::IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR);
+            });
+    measure("inner forces (" + kernels + " kernels)",
+            [&](const mfem::FiniteElement& e, mfem::ElementTransformation& tr) {
+              bi.updateResidual(Fe, e, tr, ue);
+            });
+    measure("stiffness matrix (" + kernels + " kernels)",
+            [&](const mfem::FiniteElement& e, mfem::ElementTransformation& tr) {
+              bi.updateJacobian(Ke, e, tr, ue);
+            });
+  }
+  return EXIT_SUCCESS;
+}
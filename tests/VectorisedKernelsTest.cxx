@@ -0,0 +1,51 @@
+/*!
+ * \file   tests/VectorisedKernelsTest.cxx
+ * \brief
+ * This test checks that the kernels of the behaviour integrators treating
+ * all the nodes of an element at once, whose loop over the nodes is
+ * vectorised, give the same results as the per-node kernels (see the
+ * `UseVectorisedKernels` parameter).
+ *
+ * The jacobian matrices are compared at each time step. Linear hexahedra are
+ * treated by kernels in which the number of nodes is a compile-time
+ * constant, whereas quadratic hexahedra, which have 27 nodes, are treated by
+ * the generic vectorised kernels.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ */
+
+#include <cstdlib>
+#include "MFEMMGIS/Profiler.hxx"
+#include "MFEMMGIS/NonLinearEvolutionProblem.hxx"
+#include "NonLinearEvolutionProblemTestUtilities.hxx"
+
+int main(int argc, char** argv) {
+  using namespace mfem_mgis::unit_tests;
+  auto p = FeatureTestParameters{};
+  mfem_mgis::initialize(argc, argv);
+  parseCommandLineOptions(p, argc, argv);
+  auto reference =
+      buildUniaxialTensileTest(p, {{"UseVectorisedKernels", false}}, {});
+  auto problem = buildUniaxialTensileTest(p, {}, {});
+  const auto dt = (t1 - t0) / nsteps;
+  auto success = true;
+  for (mfem_mgis::size_type i = 0; i != nsteps; ++i) {
+    const auto t = t0 + i * dt;
+    const auto sref = solve(*reference, t, t + dt, 1);
+    const auto s = solve(*problem, t, t + dt, 1);
+    if ((!sref.status) || (!s.status)) {
+      return EXIT_FAILURE;
+    }
+    success =
+        compareNumberOfIterations(s, sref, "UseVectorisedKernels") && success;
+    success = compareMatrices(getJacobianMatrix(*problem),
+                              getJacobianMatrix(*reference), 1e-12,
+                              "UseVectorisedKernels") &&
+              success;
+  }
+  success = compareResults(extractResults(*problem),
+                           extractResults(*reference),
+                           "UseVectorisedKernels") &&
+            success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}